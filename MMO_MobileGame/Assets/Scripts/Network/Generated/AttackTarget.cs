@@ -0,0 +1,55 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network.Combat
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct AttackTarget : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static AttackTarget GetRootAsAttackTarget(ByteBuffer _bb) { return GetRootAsAttackTarget(_bb, new AttackTarget()); }
+  public static AttackTarget GetRootAsAttackTarget(ByteBuffer _bb, AttackTarget obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public AttackTarget __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public uint TargetId { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetUint(o + __p.bb_pos) : (uint)0; } }
+  public uint Troops { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUint(o + __p.bb_pos) : (uint)0; } }
+
+  public static Offset<MMO.Network.Combat.AttackTarget> CreateAttackTarget(FlatBufferBuilder builder,
+      uint target_id = 0,
+      uint troops = 0) {
+    builder.StartTable(2);
+    AttackTarget.AddTroops(builder, troops);
+    AttackTarget.AddTargetId(builder, target_id);
+    return AttackTarget.EndAttackTarget(builder);
+  }
+
+  public static void StartAttackTarget(FlatBufferBuilder builder) { builder.StartTable(2); }
+  public static void AddTargetId(FlatBufferBuilder builder, uint targetId) { builder.AddUint(0, targetId, 0); }
+  public static void AddTroops(FlatBufferBuilder builder, uint troops) { builder.AddUint(1, troops, 0); }
+  public static Offset<MMO.Network.Combat.AttackTarget> EndAttackTarget(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.Combat.AttackTarget>(o);
+  }
+}
+
+
+static public class AttackTargetVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*TargetId*/, 4 /*uint*/, 4, false)
+      && verifier.VerifyField(tablePos, 6 /*Troops*/, 4 /*uint*/, 4, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -0,0 +1,17 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network.Combat
+{
+
+public enum CombatEventKind : byte
+{
+  Engaged = 0,
+  Round = 1,
+  Victory = 2,
+  Defeat = 3,
+};
+
+
+}
@@ -0,0 +1,66 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MigrationCommit : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static MigrationCommit GetRootAsMigrationCommit(ByteBuffer _bb) { return GetRootAsMigrationCommit(_bb, new MigrationCommit()); }
+  public static MigrationCommit GetRootAsMigrationCommit(ByteBuffer _bb, MigrationCommit obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MigrationCommit __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public int KingdomId { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetInt(o + __p.bb_pos) : (int)0; } }
+  public uint FirstCommand { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUint(o + __p.bb_pos) : (uint)0; } }
+  public MMO.Network.MigrationCommand? Commands(int j) { int o = __p.__offset(8); return o != 0 ? (MMO.Network.MigrationCommand?)(new MMO.Network.MigrationCommand()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int CommandsLength { get { int o = __p.__offset(8); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<MMO.Network.MigrationCommit> CreateMigrationCommit(FlatBufferBuilder builder,
+      int kingdom_id = 0,
+      uint first_command = 0,
+      VectorOffset commandsOffset = default(VectorOffset)) {
+    builder.StartTable(3);
+    MigrationCommit.AddCommands(builder, commandsOffset);
+    MigrationCommit.AddFirstCommand(builder, first_command);
+    MigrationCommit.AddKingdomId(builder, kingdom_id);
+    return MigrationCommit.EndMigrationCommit(builder);
+  }
+
+  public static void StartMigrationCommit(FlatBufferBuilder builder) { builder.StartTable(3); }
+  public static void AddKingdomId(FlatBufferBuilder builder, int kingdomId) { builder.AddInt(0, kingdomId, 0); }
+  public static void AddFirstCommand(FlatBufferBuilder builder, uint firstCommand) { builder.AddUint(1, firstCommand, 0); }
+  public static void AddCommands(FlatBufferBuilder builder, VectorOffset commandsOffset) { builder.AddOffset(2, commandsOffset.Value, 0); }
+  public static VectorOffset CreateCommandsVector(FlatBufferBuilder builder, Offset<MMO.Network.MigrationCommand>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateCommandsVectorBlock(FlatBufferBuilder builder, Offset<MMO.Network.MigrationCommand>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateCommandsVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<MMO.Network.MigrationCommand>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateCommandsVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<MMO.Network.MigrationCommand>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartCommandsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<MMO.Network.MigrationCommit> EndMigrationCommit(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.MigrationCommit>(o);
+  }
+}
+
+
+static public class MigrationCommitVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*KingdomId*/, 4 /*int*/, 4, false)
+      && verifier.VerifyField(tablePos, 6 /*FirstCommand*/, 4 /*uint*/, 4, false)
+      && verifier.VerifyVectorOfTables(tablePos, 8 /*Commands*/, MMO.Network.MigrationCommandVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
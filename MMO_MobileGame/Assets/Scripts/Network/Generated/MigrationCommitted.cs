@@ -0,0 +1,60 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MigrationCommitted : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static MigrationCommitted GetRootAsMigrationCommitted(ByteBuffer _bb) { return GetRootAsMigrationCommitted(_bb, new MigrationCommitted()); }
+  public static MigrationCommitted GetRootAsMigrationCommitted(ByteBuffer _bb, MigrationCommitted obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MigrationCommitted __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public int KingdomId { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetInt(o + __p.bb_pos) : (int)0; } }
+  public bool Success { get { int o = __p.__offset(6); return o != 0 ? 0!=__p.bb.Get(o + __p.bb_pos) : (bool)false; } }
+  public uint AppliedCommands { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUint(o + __p.bb_pos) : (uint)0; } }
+
+  public static Offset<MMO.Network.MigrationCommitted> CreateMigrationCommitted(FlatBufferBuilder builder,
+      int kingdom_id = 0,
+      bool success = false,
+      uint applied_commands = 0) {
+    builder.StartTable(3);
+    MigrationCommitted.AddAppliedCommands(builder, applied_commands);
+    MigrationCommitted.AddKingdomId(builder, kingdom_id);
+    MigrationCommitted.AddSuccess(builder, success);
+    return MigrationCommitted.EndMigrationCommitted(builder);
+  }
+
+  public static void StartMigrationCommitted(FlatBufferBuilder builder) { builder.StartTable(3); }
+  public static void AddKingdomId(FlatBufferBuilder builder, int kingdomId) { builder.AddInt(0, kingdomId, 0); }
+  public static void AddSuccess(FlatBufferBuilder builder, bool success) { builder.AddBool(1, success, false); }
+  public static void AddAppliedCommands(FlatBufferBuilder builder, uint appliedCommands) { builder.AddUint(2, appliedCommands, 0); }
+  public static Offset<MMO.Network.MigrationCommitted> EndMigrationCommitted(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.MigrationCommitted>(o);
+  }
+}
+
+
+static public class MigrationCommittedVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*KingdomId*/, 4 /*int*/, 4, false)
+      && verifier.VerifyField(tablePos, 6 /*Success*/, 1 /*bool*/, 1, false)
+      && verifier.VerifyField(tablePos, 8 /*AppliedCommands*/, 4 /*uint*/, 4, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
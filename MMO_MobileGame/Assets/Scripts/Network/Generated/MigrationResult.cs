@@ -0,0 +1,66 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MigrationResult : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static MigrationResult GetRootAsMigrationResult(ByteBuffer _bb) { return GetRootAsMigrationResult(_bb, new MigrationResult()); }
+  public static MigrationResult GetRootAsMigrationResult(ByteBuffer _bb, MigrationResult obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MigrationResult __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public int KingdomId { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetInt(o + __p.bb_pos) : (int)0; } }
+  public bool Success { get { int o = __p.__offset(6); return o != 0 ? 0!=__p.bb.Get(o + __p.bb_pos) : (bool)false; } }
+  public string Message { get { int o = __p.__offset(8); return o != 0 ? __p.__string(o + __p.bb_pos) : null; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetMessageBytes() { return __p.__vector_as_span<byte>(8, 1); }
+#else
+  public ArraySegment<byte>? GetMessageBytes() { return __p.__vector_as_arraysegment(8); }
+#endif
+  public byte[] GetMessageArray() { return __p.__vector_as_array<byte>(8); }
+
+  public static Offset<MMO.Network.MigrationResult> CreateMigrationResult(FlatBufferBuilder builder,
+      int kingdom_id = 0,
+      bool success = false,
+      StringOffset messageOffset = default(StringOffset)) {
+    builder.StartTable(3);
+    MigrationResult.AddMessage(builder, messageOffset);
+    MigrationResult.AddKingdomId(builder, kingdom_id);
+    MigrationResult.AddSuccess(builder, success);
+    return MigrationResult.EndMigrationResult(builder);
+  }
+
+  public static void StartMigrationResult(FlatBufferBuilder builder) { builder.StartTable(3); }
+  public static void AddKingdomId(FlatBufferBuilder builder, int kingdomId) { builder.AddInt(0, kingdomId, 0); }
+  public static void AddSuccess(FlatBufferBuilder builder, bool success) { builder.AddBool(1, success, false); }
+  public static void AddMessage(FlatBufferBuilder builder, StringOffset messageOffset) { builder.AddOffset(2, messageOffset.Value, 0); }
+  public static Offset<MMO.Network.MigrationResult> EndMigrationResult(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.MigrationResult>(o);
+  }
+}
+
+
+static public class MigrationResultVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*KingdomId*/, 4 /*int*/, 4, false)
+      && verifier.VerifyField(tablePos, 6 /*Success*/, 1 /*bool*/, 1, false)
+      && verifier.VerifyString(tablePos, 8 /*Message*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -0,0 +1,46 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network.Movement
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MoveRequest : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static MoveRequest GetRootAsMoveRequest(ByteBuffer _bb) { return GetRootAsMoveRequest(_bb, new MoveRequest()); }
+  public static MoveRequest GetRootAsMoveRequest(ByteBuffer _bb, MoveRequest obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MoveRequest __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public uint EntityId { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetUint(o + __p.bb_pos) : (uint)0; } }
+  public MMO.Network.Movement.Vector2D? TargetPos { get { int o = __p.__offset(6); return o != 0 ? (MMO.Network.Movement.Vector2D?)(new MMO.Network.Movement.Vector2D()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+
+  public static void StartMoveRequest(FlatBufferBuilder builder) { builder.StartTable(2); }
+  public static void AddEntityId(FlatBufferBuilder builder, uint entityId) { builder.AddUint(0, entityId, 0); }
+  public static void AddTargetPos(FlatBufferBuilder builder, Offset<MMO.Network.Movement.Vector2D> targetPosOffset) { builder.AddStruct(1, targetPosOffset.Value, 0); }
+  public static Offset<MMO.Network.Movement.MoveRequest> EndMoveRequest(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.Movement.MoveRequest>(o);
+  }
+}
+
+
+static public class MoveRequestVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*EntityId*/, 4 /*uint*/, 4, false)
+      && verifier.VerifyField(tablePos, 6 /*TargetPos*/, 8 /*MMO.Network.Movement.Vector2D*/, 4, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
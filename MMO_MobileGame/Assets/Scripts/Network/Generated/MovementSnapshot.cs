@@ -0,0 +1,52 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network.Movement
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MovementSnapshot : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static MovementSnapshot GetRootAsMovementSnapshot(ByteBuffer _bb) { return GetRootAsMovementSnapshot(_bb, new MovementSnapshot()); }
+  public static MovementSnapshot GetRootAsMovementSnapshot(ByteBuffer _bb, MovementSnapshot obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MovementSnapshot __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public uint EntityId { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetUint(o + __p.bb_pos) : (uint)0; } }
+  public MMO.Network.Movement.Vector2D? CurrentPos { get { int o = __p.__offset(6); return o != 0 ? (MMO.Network.Movement.Vector2D?)(new MMO.Network.Movement.Vector2D()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public MMO.Network.Movement.Vector2D? Velocity { get { int o = __p.__offset(8); return o != 0 ? (MMO.Network.Movement.Vector2D?)(new MMO.Network.Movement.Vector2D()).__assign(o + __p.bb_pos, __p.bb) : null; } }
+  public bool IsMoving { get { int o = __p.__offset(10); return o != 0 ? 0!=__p.bb.Get(o + __p.bb_pos) : (bool)false; } }
+
+  public static void StartMovementSnapshot(FlatBufferBuilder builder) { builder.StartTable(4); }
+  public static void AddEntityId(FlatBufferBuilder builder, uint entityId) { builder.AddUint(0, entityId, 0); }
+  public static void AddCurrentPos(FlatBufferBuilder builder, Offset<MMO.Network.Movement.Vector2D> currentPosOffset) { builder.AddStruct(1, currentPosOffset.Value, 0); }
+  public static void AddVelocity(FlatBufferBuilder builder, Offset<MMO.Network.Movement.Vector2D> velocityOffset) { builder.AddStruct(2, velocityOffset.Value, 0); }
+  public static void AddIsMoving(FlatBufferBuilder builder, bool isMoving) { builder.AddBool(3, isMoving, false); }
+  public static Offset<MMO.Network.Movement.MovementSnapshot> EndMovementSnapshot(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.Movement.MovementSnapshot>(o);
+  }
+}
+
+
+static public class MovementSnapshotVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*EntityId*/, 4 /*uint*/, 4, false)
+      && verifier.VerifyField(tablePos, 6 /*CurrentPos*/, 8 /*MMO.Network.Movement.Vector2D*/, 4, false)
+      && verifier.VerifyField(tablePos, 8 /*Velocity*/, 8 /*MMO.Network.Movement.Vector2D*/, 4, false)
+      && verifier.VerifyField(tablePos, 10 /*IsMoving*/, 1 /*bool*/, 1, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -25,9 +25,19 @@ public enum Opcode : ushort
   C2S_BindSocialAccount = 112,
   S2C_BindSocialAccountResult = 113,
   C2S_SocialLogin = 114,
+  S2C_KingdomRedirect = 115,
   C2S_MoveRequest = 1000,
   S2C_MovementSnapshot = 1001,
+  S2C_ReplicationBatch = 1002,
   C2S_AttackTarget = 2000,
+  S2C_CombatEvents = 2001,
+  S2S_MigrationChunk = 3000,
+  S2S_MigrationResult = 3001,
+  S2S_ControlChallenge = 3002,
+  S2S_ControlHello = 3003,
+  S2S_ControlWelcome = 3004,
+  S2S_MigrationCommit = 3005,
+  S2S_MigrationCommitted = 3006,
 };
 
 
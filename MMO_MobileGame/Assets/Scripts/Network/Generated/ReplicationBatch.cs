@@ -0,0 +1,84 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network.Movement
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct ReplicationBatch : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static ReplicationBatch GetRootAsReplicationBatch(ByteBuffer _bb) { return GetRootAsReplicationBatch(_bb, new ReplicationBatch()); }
+  public static ReplicationBatch GetRootAsReplicationBatch(ByteBuffer _bb, ReplicationBatch obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public ReplicationBatch __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public MMO.Network.Movement.MovementSnapshot? Entered(int j) { int o = __p.__offset(4); return o != 0 ? (MMO.Network.Movement.MovementSnapshot?)(new MMO.Network.Movement.MovementSnapshot()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int EnteredLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public uint Left(int j) { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUint(__p.__vector(o) + j * 4) : (uint)0; }
+  public int LeftLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<uint> GetLeftBytes() { return __p.__vector_as_span<uint>(6, 4); }
+#else
+  public ArraySegment<byte>? GetLeftBytes() { return __p.__vector_as_arraysegment(6); }
+#endif
+  public uint[] GetLeftArray() { return __p.__vector_as_array<uint>(6); }
+  public MMO.Network.Movement.MovementSnapshot? Updated(int j) { int o = __p.__offset(8); return o != 0 ? (MMO.Network.Movement.MovementSnapshot?)(new MMO.Network.Movement.MovementSnapshot()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int UpdatedLength { get { int o = __p.__offset(8); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<MMO.Network.Movement.ReplicationBatch> CreateReplicationBatch(FlatBufferBuilder builder,
+      VectorOffset enteredOffset = default(VectorOffset),
+      VectorOffset leftOffset = default(VectorOffset),
+      VectorOffset updatedOffset = default(VectorOffset)) {
+    builder.StartTable(3);
+    ReplicationBatch.AddUpdated(builder, updatedOffset);
+    ReplicationBatch.AddLeft(builder, leftOffset);
+    ReplicationBatch.AddEntered(builder, enteredOffset);
+    return ReplicationBatch.EndReplicationBatch(builder);
+  }
+
+  public static void StartReplicationBatch(FlatBufferBuilder builder) { builder.StartTable(3); }
+  public static void AddEntered(FlatBufferBuilder builder, VectorOffset enteredOffset) { builder.AddOffset(0, enteredOffset.Value, 0); }
+  public static VectorOffset CreateEnteredVector(FlatBufferBuilder builder, Offset<MMO.Network.Movement.MovementSnapshot>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateEnteredVectorBlock(FlatBufferBuilder builder, Offset<MMO.Network.Movement.MovementSnapshot>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateEnteredVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<MMO.Network.Movement.MovementSnapshot>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateEnteredVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<MMO.Network.Movement.MovementSnapshot>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartEnteredVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddLeft(FlatBufferBuilder builder, VectorOffset leftOffset) { builder.AddOffset(1, leftOffset.Value, 0); }
+  public static VectorOffset CreateLeftVector(FlatBufferBuilder builder, uint[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddUint(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateLeftVectorBlock(FlatBufferBuilder builder, uint[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateLeftVectorBlock(FlatBufferBuilder builder, ArraySegment<uint> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateLeftVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<uint>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartLeftVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddUpdated(FlatBufferBuilder builder, VectorOffset updatedOffset) { builder.AddOffset(2, updatedOffset.Value, 0); }
+  public static VectorOffset CreateUpdatedVector(FlatBufferBuilder builder, Offset<MMO.Network.Movement.MovementSnapshot>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateUpdatedVectorBlock(FlatBufferBuilder builder, Offset<MMO.Network.Movement.MovementSnapshot>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateUpdatedVectorBlock(FlatBufferBuilder builder, ArraySegment<Offset<MMO.Network.Movement.MovementSnapshot>> data) { builder.StartVector(4, data.Count, 4); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateUpdatedVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<Offset<MMO.Network.Movement.MovementSnapshot>>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartUpdatedVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<MMO.Network.Movement.ReplicationBatch> EndReplicationBatch(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.Movement.ReplicationBatch>(o);
+  }
+}
+
+
+static public class ReplicationBatchVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfTables(tablePos, 4 /*Entered*/, MMO.Network.Movement.MovementSnapshotVerify.Verify, false)
+      && verifier.VerifyVectorOfData(tablePos, 6 /*Left*/, 4 /*uint*/, false)
+      && verifier.VerifyVectorOfTables(tablePos, 8 /*Updated*/, MMO.Network.Movement.MovementSnapshotVerify.Verify, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
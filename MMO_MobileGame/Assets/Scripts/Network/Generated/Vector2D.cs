@@ -0,0 +1,31 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network.Movement
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct Vector2D : IFlatbufferObject
+{
+  private Struct __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Struct(_i, _bb); }
+  public Vector2D __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public float X { get { return __p.bb.GetFloat(__p.bb_pos + 0); } }
+  public float Y { get { return __p.bb.GetFloat(__p.bb_pos + 4); } }
+
+  public static Offset<MMO.Network.Movement.Vector2D> CreateVector2D(FlatBufferBuilder builder, float X, float Y) {
+    builder.Prep(4, 8);
+    builder.PutFloat(Y);
+    builder.PutFloat(X);
+    return new Offset<MMO.Network.Movement.Vector2D>(builder.Offset);
+  }
+}
+
+
+}
@@ -0,0 +1,156 @@
+// Benchmark SpatialGrid : stockage sparse (hash maps) vs dense (tableau de cellules borne)
+// Insert, Move, QueryNeighbors (3x3), QueryRadius (filtre exact) et vue large (QueryRect vs QueryLod)
+// xmake build SpatialGridBench && xmake run SpatialGridBench [entites] [taille_carte]
+#include "world/SpatialGrid.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using MMO::Core::SpatialGrid;
+using Clock = std::chrono::steady_clock;
+
+namespace
+{
+    constexpr float CELL_SIZE = 100.0f;
+    constexpr int MOVE_ROUNDS = 20;
+    constexpr int QUERY_COUNT = 200000;
+    constexpr float QUERY_RADIUS = 150.0f;
+    constexpr int VIEW_COUNT = 200;
+    constexpr uint32_t VIEW_BUDGET = 256; // Noeuds affichables sur une vue dezoomee
+
+    struct Point
+    {
+        float x;
+        float y;
+    };
+
+    struct Result
+    {
+        double insertMs = 0.0;
+        double moveMs = 0.0;
+        double queryMs = 0.0;
+        double radiusMs = 0.0;
+        double wideRectMs = 0.0;
+        double wideLodMs = 0.0;
+        size_t wideEntities = 0;
+        size_t wideAggregates = 0;
+        size_t found = 0; // Empeche le compilateur d'eliminer les requetes
+    };
+
+    double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    Result Run(SpatialGrid& grid, float viewSize, const std::vector<entt::entity>& entities,
+               std::vector<Point> positions, const std::vector<Point>& steps, const std::vector<Point>& queries)
+    {
+        Result result;
+
+        auto start = Clock::now();
+        for (size_t i = 0; i < entities.size(); ++i)
+            grid.Insert(entities[i], positions[i].x, positions[i].y);
+        result.insertMs = ElapsedMs(start);
+
+        // Petits deplacements par tick, comme le MovementSystem : la plupart restent dans leur cellule
+        start = Clock::now();
+        for (int round = 0; round < MOVE_ROUNDS; ++round)
+        {
+            for (size_t i = 0; i < entities.size(); ++i)
+            {
+                positions[i].x += steps[i].x;
+                positions[i].y += steps[i].y;
+                grid.Move(entities[i], positions[i].x, positions[i].y);
+            }
+        }
+        result.moveMs = ElapsedMs(start);
+
+        std::vector<entt::entity> out;
+        start = Clock::now();
+        for (const Point& q : queries)
+        {
+            out.clear();
+            grid.QueryNeighbors(q.x, q.y, out);
+            result.found += out.size();
+        }
+        result.queryMs = ElapsedMs(start);
+
+        start = Clock::now();
+        for (const Point& q : queries)
+        {
+            out.clear();
+            grid.QueryRadius(q.x, q.y, QUERY_RADIUS, out);
+            result.found += out.size();
+        }
+        result.radiusMs = ElapsedMs(start);
+
+        // Vue dezoomee sur un quart de la carte : toutes les entites vs agregats LOD
+        std::vector<MMO::Core::LodAggregate> aggregates;
+        start = Clock::now();
+        for (int i = 0; i < VIEW_COUNT; ++i)
+        {
+            out.clear();
+            grid.QueryRect(0.0f, 0.0f, viewSize, viewSize, out);
+            result.wideEntities = out.size();
+        }
+        result.wideRectMs = ElapsedMs(start);
+
+        start = Clock::now();
+        for (int i = 0; i < VIEW_COUNT; ++i)
+        {
+            out.clear();
+            aggregates.clear();
+            grid.QueryLod(0.0f, 0.0f, viewSize, viewSize, VIEW_BUDGET, out, aggregates);
+            result.wideAggregates = aggregates.size();
+        }
+        result.wideLodMs = ElapsedMs(start);
+
+        return result;
+    }
+
+    void Print(const char* name, const Result& r, size_t entityCount)
+    {
+        std::printf("%-7s insert %8.2f ms | move x%d %8.2f ms (%.1f ns/op) | query 3x3 x%d %8.2f ms | radius %.0f x%d %8.2f ms (%zu resultats)\n",
+            name, r.insertMs,
+            MOVE_ROUNDS, r.moveMs, r.moveMs * 1e6 / (static_cast<double>(entityCount) * MOVE_ROUNDS),
+            QUERY_COUNT, r.queryMs, QUERY_RADIUS, QUERY_COUNT, r.radiusMs, r.found);
+        std::printf("        vue large x%d : rect %8.2f ms (%zu entites) | lod %8.2f ms (%zu agregats)\n",
+            VIEW_COUNT, r.wideRectMs, r.wideEntities, r.wideLodMs, r.wideAggregates);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t entityCount = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 100000;
+    float mapSize = argc > 2 ? static_cast<float>(std::atof(argv[2])) : 10000.0f;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(0.0f, mapSize);
+    std::uniform_real_distribution<float> step(-5.0f, 5.0f);
+
+    std::vector<entt::entity> entities(entityCount);
+    std::vector<Point> positions(entityCount);
+    std::vector<Point> steps(entityCount);
+    for (size_t i = 0; i < entityCount; ++i)
+    {
+        entities[i] = static_cast<entt::entity>(i);
+        positions[i] = { coord(rng), coord(rng) };
+        steps[i] = { step(rng), step(rng) };
+    }
+
+    std::vector<Point> queries(QUERY_COUNT);
+    for (Point& q : queries)
+        q = { coord(rng), coord(rng) };
+
+    std::printf("SpatialGrid : %zu entites, carte %.0fx%.0f, cellules de %.0f\n", entityCount, mapSize, mapSize, CELL_SIZE);
+
+    SpatialGrid sparse(CELL_SIZE);
+    Print("sparse", Run(sparse, mapSize * 0.5f, entities, positions, steps, queries), entityCount);
+
+    SpatialGrid dense(CELL_SIZE, mapSize, mapSize);
+    Print("dense", Run(dense, mapSize * 0.5f, entities, positions, steps, queries), entityCount);
+
+    return 0;
+}
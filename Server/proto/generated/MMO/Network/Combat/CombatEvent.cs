@@ -0,0 +1,42 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network.Combat
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct CombatEvent : IFlatbufferObject
+{
+  private Struct __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Struct(_i, _bb); }
+  public CombatEvent __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public uint BattleId { get { return __p.bb.GetUint(__p.bb_pos + 0); } }
+  public uint TargetId { get { return __p.bb.GetUint(__p.bb_pos + 4); } }
+  public MMO.Network.Combat.CombatEventKind Kind { get { return (MMO.Network.Combat.CombatEventKind)__p.bb.Get(__p.bb_pos + 8); } }
+  public uint Attackers { get { return __p.bb.GetUint(__p.bb_pos + 12); } }
+  public uint Defenders { get { return __p.bb.GetUint(__p.bb_pos + 16); } }
+  public uint Troops { get { return __p.bb.GetUint(__p.bb_pos + 20); } }
+  public uint Losses { get { return __p.bb.GetUint(__p.bb_pos + 24); } }
+
+  public static Offset<MMO.Network.Combat.CombatEvent> CreateCombatEvent(FlatBufferBuilder builder, uint BattleId, uint TargetId, MMO.Network.Combat.CombatEventKind Kind, uint Attackers, uint Defenders, uint Troops, uint Losses) {
+    builder.Prep(4, 28);
+    builder.PutUint(Losses);
+    builder.PutUint(Troops);
+    builder.PutUint(Defenders);
+    builder.PutUint(Attackers);
+    builder.Pad(3);
+    builder.PutByte((byte)Kind);
+    builder.PutUint(TargetId);
+    builder.PutUint(BattleId);
+    return new Offset<MMO.Network.Combat.CombatEvent>(builder.Offset);
+  }
+}
+
+
+}
@@ -0,0 +1,52 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network.Combat
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct CombatEvents : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static CombatEvents GetRootAsCombatEvents(ByteBuffer _bb) { return GetRootAsCombatEvents(_bb, new CombatEvents()); }
+  public static CombatEvents GetRootAsCombatEvents(ByteBuffer _bb, CombatEvents obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public CombatEvents __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public MMO.Network.Combat.CombatEvent? Events(int j) { int o = __p.__offset(4); return o != 0 ? (MMO.Network.Combat.CombatEvent?)(new MMO.Network.Combat.CombatEvent()).__assign(__p.__vector(o) + j * 28, __p.bb) : null; }
+  public int EventsLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+
+  public static Offset<MMO.Network.Combat.CombatEvents> CreateCombatEvents(FlatBufferBuilder builder,
+      VectorOffset eventsOffset = default(VectorOffset)) {
+    builder.StartTable(1);
+    CombatEvents.AddEvents(builder, eventsOffset);
+    return CombatEvents.EndCombatEvents(builder);
+  }
+
+  public static void StartCombatEvents(FlatBufferBuilder builder) { builder.StartTable(1); }
+  public static void AddEvents(FlatBufferBuilder builder, VectorOffset eventsOffset) { builder.AddOffset(0, eventsOffset.Value, 0); }
+  public static void StartEventsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(28, numElems, 4); }
+  public static Offset<MMO.Network.Combat.CombatEvents> EndCombatEvents(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.Combat.CombatEvents>(o);
+  }
+}
+
+
+static public class CombatEventsVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfData(tablePos, 4 /*Events*/, 28 /*MMO.Network.Combat.CombatEvent*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -0,0 +1,79 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct ControlHello : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static ControlHello GetRootAsControlHello(ByteBuffer _bb) { return GetRootAsControlHello(_bb, new ControlHello()); }
+  public static ControlHello GetRootAsControlHello(ByteBuffer _bb, ControlHello obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public ControlHello __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public byte Mac(int j) { int o = __p.__offset(4); return o != 0 ? __p.bb.Get(__p.__vector(o) + j * 1) : (byte)0; }
+  public int MacLength { get { int o = __p.__offset(4); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetMacBytes() { return __p.__vector_as_span<byte>(4, 1); }
+#else
+  public ArraySegment<byte>? GetMacBytes() { return __p.__vector_as_arraysegment(4); }
+#endif
+  public byte[] GetMacArray() { return __p.__vector_as_array<byte>(4); }
+  public byte Nonce(int j) { int o = __p.__offset(6); return o != 0 ? __p.bb.Get(__p.__vector(o) + j * 1) : (byte)0; }
+  public int NonceLength { get { int o = __p.__offset(6); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetNonceBytes() { return __p.__vector_as_span<byte>(6, 1); }
+#else
+  public ArraySegment<byte>? GetNonceBytes() { return __p.__vector_as_arraysegment(6); }
+#endif
+  public byte[] GetNonceArray() { return __p.__vector_as_array<byte>(6); }
+
+  public static Offset<MMO.Network.ControlHello> CreateControlHello(FlatBufferBuilder builder,
+      VectorOffset macOffset = default(VectorOffset),
+      VectorOffset nonceOffset = default(VectorOffset)) {
+    builder.StartTable(2);
+    ControlHello.AddNonce(builder, nonceOffset);
+    ControlHello.AddMac(builder, macOffset);
+    return ControlHello.EndControlHello(builder);
+  }
+
+  public static void StartControlHello(FlatBufferBuilder builder) { builder.StartTable(2); }
+  public static void AddMac(FlatBufferBuilder builder, VectorOffset macOffset) { builder.AddOffset(0, macOffset.Value, 0); }
+  public static VectorOffset CreateMacVector(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); for (int i = data.Length - 1; i >= 0; i--) builder.AddByte(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateMacVectorBlock(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateMacVectorBlock(FlatBufferBuilder builder, ArraySegment<byte> data) { builder.StartVector(1, data.Count, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateMacVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<byte>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartMacVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(1, numElems, 1); }
+  public static void AddNonce(FlatBufferBuilder builder, VectorOffset nonceOffset) { builder.AddOffset(1, nonceOffset.Value, 0); }
+  public static VectorOffset CreateNonceVector(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); for (int i = data.Length - 1; i >= 0; i--) builder.AddByte(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateNonceVectorBlock(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateNonceVectorBlock(FlatBufferBuilder builder, ArraySegment<byte> data) { builder.StartVector(1, data.Count, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateNonceVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<byte>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartNonceVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(1, numElems, 1); }
+  public static Offset<MMO.Network.ControlHello> EndControlHello(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.ControlHello>(o);
+  }
+}
+
+
+static public class ControlHelloVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyVectorOfData(tablePos, 4 /*Mac*/, 1 /*byte*/, false)
+      && verifier.VerifyVectorOfData(tablePos, 6 /*Nonce*/, 1 /*byte*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
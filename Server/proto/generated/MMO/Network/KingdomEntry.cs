@@ -30,28 +30,42 @@ public struct KingdomEntry : IFlatbufferObject
   public int PlayerCount { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetInt(o + __p.bb_pos) : (int)0; } }
   public int MaxPlayers { get { int o = __p.__offset(10); return o != 0 ? __p.bb.GetInt(o + __p.bb_pos) : (int)0; } }
   public byte Status { get { int o = __p.__offset(12); return o != 0 ? __p.bb.Get(o + __p.bb_pos) : (byte)0; } }
+  public string Ip { get { int o = __p.__offset(14); return o != 0 ? __p.__string(o + __p.bb_pos) : null; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetIpBytes() { return __p.__vector_as_span<byte>(14, 1); }
+#else
+  public ArraySegment<byte>? GetIpBytes() { return __p.__vector_as_arraysegment(14); }
+#endif
+  public byte[] GetIpArray() { return __p.__vector_as_array<byte>(14); }
+  public ushort Port { get { int o = __p.__offset(16); return o != 0 ? __p.bb.GetUshort(o + __p.bb_pos) : (ushort)0; } }
 
   public static Offset<MMO.Network.KingdomEntry> CreateKingdomEntry(FlatBufferBuilder builder,
       int id = 0,
       StringOffset nameOffset = default(StringOffset),
       int player_count = 0,
       int max_players = 0,
-      byte status = 0) {
-    builder.StartTable(5);
+      byte status = 0,
+      StringOffset ipOffset = default(StringOffset),
+      ushort port = 0) {
+    builder.StartTable(7);
+    KingdomEntry.AddIp(builder, ipOffset);
     KingdomEntry.AddMaxPlayers(builder, max_players);
     KingdomEntry.AddPlayerCount(builder, player_count);
     KingdomEntry.AddName(builder, nameOffset);
     KingdomEntry.AddId(builder, id);
+    KingdomEntry.AddPort(builder, port);
     KingdomEntry.AddStatus(builder, status);
     return KingdomEntry.EndKingdomEntry(builder);
   }
 
-  public static void StartKingdomEntry(FlatBufferBuilder builder) { builder.StartTable(5); }
+  public static void StartKingdomEntry(FlatBufferBuilder builder) { builder.StartTable(7); }
   public static void AddId(FlatBufferBuilder builder, int id) { builder.AddInt(0, id, 0); }
   public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(1, nameOffset.Value, 0); }
   public static void AddPlayerCount(FlatBufferBuilder builder, int playerCount) { builder.AddInt(2, playerCount, 0); }
   public static void AddMaxPlayers(FlatBufferBuilder builder, int maxPlayers) { builder.AddInt(3, maxPlayers, 0); }
   public static void AddStatus(FlatBufferBuilder builder, byte status) { builder.AddByte(4, status, 0); }
+  public static void AddIp(FlatBufferBuilder builder, StringOffset ipOffset) { builder.AddOffset(5, ipOffset.Value, 0); }
+  public static void AddPort(FlatBufferBuilder builder, ushort port) { builder.AddUshort(6, port, 0); }
   public static Offset<MMO.Network.KingdomEntry> EndKingdomEntry(FlatBufferBuilder builder) {
     int o = builder.EndTable();
     return new Offset<MMO.Network.KingdomEntry>(o);
@@ -69,6 +83,8 @@ static public class KingdomEntryVerify
       && verifier.VerifyField(tablePos, 8 /*PlayerCount*/, 4 /*int*/, 4, false)
       && verifier.VerifyField(tablePos, 10 /*MaxPlayers*/, 4 /*int*/, 4, false)
       && verifier.VerifyField(tablePos, 12 /*Status*/, 1 /*byte*/, 1, false)
+      && verifier.VerifyString(tablePos, 14 /*Ip*/, false)
+      && verifier.VerifyField(tablePos, 16 /*Port*/, 2 /*ushort*/, 2, false)
       && verifier.VerifyTableEnd(tablePos);
   }
 }
@@ -0,0 +1,66 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct KingdomRedirect : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static KingdomRedirect GetRootAsKingdomRedirect(ByteBuffer _bb) { return GetRootAsKingdomRedirect(_bb, new KingdomRedirect()); }
+  public static KingdomRedirect GetRootAsKingdomRedirect(ByteBuffer _bb, KingdomRedirect obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public KingdomRedirect __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public int KingdomId { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetInt(o + __p.bb_pos) : (int)0; } }
+  public string Ip { get { int o = __p.__offset(6); return o != 0 ? __p.__string(o + __p.bb_pos) : null; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetIpBytes() { return __p.__vector_as_span<byte>(6, 1); }
+#else
+  public ArraySegment<byte>? GetIpBytes() { return __p.__vector_as_arraysegment(6); }
+#endif
+  public byte[] GetIpArray() { return __p.__vector_as_array<byte>(6); }
+  public ushort Port { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUshort(o + __p.bb_pos) : (ushort)0; } }
+
+  public static Offset<MMO.Network.KingdomRedirect> CreateKingdomRedirect(FlatBufferBuilder builder,
+      int kingdom_id = 0,
+      StringOffset ipOffset = default(StringOffset),
+      ushort port = 0) {
+    builder.StartTable(3);
+    KingdomRedirect.AddIp(builder, ipOffset);
+    KingdomRedirect.AddKingdomId(builder, kingdom_id);
+    KingdomRedirect.AddPort(builder, port);
+    return KingdomRedirect.EndKingdomRedirect(builder);
+  }
+
+  public static void StartKingdomRedirect(FlatBufferBuilder builder) { builder.StartTable(3); }
+  public static void AddKingdomId(FlatBufferBuilder builder, int kingdomId) { builder.AddInt(0, kingdomId, 0); }
+  public static void AddIp(FlatBufferBuilder builder, StringOffset ipOffset) { builder.AddOffset(1, ipOffset.Value, 0); }
+  public static void AddPort(FlatBufferBuilder builder, ushort port) { builder.AddUshort(2, port, 0); }
+  public static Offset<MMO.Network.KingdomRedirect> EndKingdomRedirect(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.KingdomRedirect>(o);
+  }
+}
+
+
+static public class KingdomRedirectVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*KingdomId*/, 4 /*int*/, 4, false)
+      && verifier.VerifyString(tablePos, 6 /*Ip*/, false)
+      && verifier.VerifyField(tablePos, 8 /*Port*/, 2 /*ushort*/, 2, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
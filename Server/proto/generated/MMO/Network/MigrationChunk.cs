@@ -0,0 +1,82 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MigrationChunk : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static MigrationChunk GetRootAsMigrationChunk(ByteBuffer _bb) { return GetRootAsMigrationChunk(_bb, new MigrationChunk()); }
+  public static MigrationChunk GetRootAsMigrationChunk(ByteBuffer _bb, MigrationChunk obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MigrationChunk __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public int KingdomId { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetInt(o + __p.bb_pos) : (int)0; } }
+  public uint Index { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUint(o + __p.bb_pos) : (uint)0; } }
+  public uint ChunkCount { get { int o = __p.__offset(8); return o != 0 ? __p.bb.GetUint(o + __p.bb_pos) : (uint)0; } }
+  public ulong SnapshotSize { get { int o = __p.__offset(10); return o != 0 ? __p.bb.GetUlong(o + __p.bb_pos) : (ulong)0; } }
+  public byte Data(int j) { int o = __p.__offset(12); return o != 0 ? __p.bb.Get(__p.__vector(o) + j * 1) : (byte)0; }
+  public int DataLength { get { int o = __p.__offset(12); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetDataBytes() { return __p.__vector_as_span<byte>(12, 1); }
+#else
+  public ArraySegment<byte>? GetDataBytes() { return __p.__vector_as_arraysegment(12); }
+#endif
+  public byte[] GetDataArray() { return __p.__vector_as_array<byte>(12); }
+
+  public static Offset<MMO.Network.MigrationChunk> CreateMigrationChunk(FlatBufferBuilder builder,
+      int kingdom_id = 0,
+      uint index = 0,
+      uint chunk_count = 0,
+      ulong snapshot_size = 0,
+      VectorOffset dataOffset = default(VectorOffset)) {
+    builder.StartTable(5);
+    MigrationChunk.AddSnapshotSize(builder, snapshot_size);
+    MigrationChunk.AddData(builder, dataOffset);
+    MigrationChunk.AddChunkCount(builder, chunk_count);
+    MigrationChunk.AddIndex(builder, index);
+    MigrationChunk.AddKingdomId(builder, kingdom_id);
+    return MigrationChunk.EndMigrationChunk(builder);
+  }
+
+  public static void StartMigrationChunk(FlatBufferBuilder builder) { builder.StartTable(5); }
+  public static void AddKingdomId(FlatBufferBuilder builder, int kingdomId) { builder.AddInt(0, kingdomId, 0); }
+  public static void AddIndex(FlatBufferBuilder builder, uint index) { builder.AddUint(1, index, 0); }
+  public static void AddChunkCount(FlatBufferBuilder builder, uint chunkCount) { builder.AddUint(2, chunkCount, 0); }
+  public static void AddSnapshotSize(FlatBufferBuilder builder, ulong snapshotSize) { builder.AddUlong(3, snapshotSize, 0); }
+  public static void AddData(FlatBufferBuilder builder, VectorOffset dataOffset) { builder.AddOffset(4, dataOffset.Value, 0); }
+  public static VectorOffset CreateDataVector(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); for (int i = data.Length - 1; i >= 0; i--) builder.AddByte(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateDataVectorBlock(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDataVectorBlock(FlatBufferBuilder builder, ArraySegment<byte> data) { builder.StartVector(1, data.Count, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreateDataVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<byte>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartDataVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(1, numElems, 1); }
+  public static Offset<MMO.Network.MigrationChunk> EndMigrationChunk(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.MigrationChunk>(o);
+  }
+}
+
+
+static public class MigrationChunkVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*KingdomId*/, 4 /*int*/, 4, false)
+      && verifier.VerifyField(tablePos, 6 /*Index*/, 4 /*uint*/, 4, false)
+      && verifier.VerifyField(tablePos, 8 /*ChunkCount*/, 4 /*uint*/, 4, false)
+      && verifier.VerifyField(tablePos, 10 /*SnapshotSize*/, 8 /*ulong*/, 8, false)
+      && verifier.VerifyVectorOfData(tablePos, 12 /*Data*/, 1 /*byte*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
@@ -0,0 +1,77 @@
+// <auto-generated>
+//  automatically generated by the FlatBuffers compiler, do not modify
+// </auto-generated>
+
+namespace MMO.Network
+{
+
+using global::System;
+using global::System.Collections.Generic;
+using global::Google.FlatBuffers;
+
+public struct MigrationCommand : IFlatbufferObject
+{
+  private Table __p;
+  public ByteBuffer ByteBuffer { get { return __p.bb; } }
+  public static void ValidateVersion() { FlatBufferConstants.FLATBUFFERS_25_9_23(); }
+  public static MigrationCommand GetRootAsMigrationCommand(ByteBuffer _bb) { return GetRootAsMigrationCommand(_bb, new MigrationCommand()); }
+  public static MigrationCommand GetRootAsMigrationCommand(ByteBuffer _bb, MigrationCommand obj) { return (obj.__assign(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public void __init(int _i, ByteBuffer _bb) { __p = new Table(_i, _bb); }
+  public MigrationCommand __assign(int _i, ByteBuffer _bb) { __init(_i, _bb); return this; }
+
+  public int AccountId { get { int o = __p.__offset(4); return o != 0 ? __p.bb.GetInt(o + __p.bb_pos) : (int)0; } }
+  public uint Entity { get { int o = __p.__offset(6); return o != 0 ? __p.bb.GetUint(o + __p.bb_pos) : (uint)0; } }
+  public MMO.Network.Opcode Opcode { get { int o = __p.__offset(8); return o != 0 ? (MMO.Network.Opcode)__p.bb.GetUshort(o + __p.bb_pos) : MMO.Network.Opcode.None; } }
+  public byte Payload(int j) { int o = __p.__offset(10); return o != 0 ? __p.bb.Get(__p.__vector(o) + j * 1) : (byte)0; }
+  public int PayloadLength { get { int o = __p.__offset(10); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetPayloadBytes() { return __p.__vector_as_span<byte>(10, 1); }
+#else
+  public ArraySegment<byte>? GetPayloadBytes() { return __p.__vector_as_arraysegment(10); }
+#endif
+  public byte[] GetPayloadArray() { return __p.__vector_as_array<byte>(10); }
+
+  public static Offset<MMO.Network.MigrationCommand> CreateMigrationCommand(FlatBufferBuilder builder,
+      int account_id = 0,
+      uint entity = 0,
+      MMO.Network.Opcode opcode = MMO.Network.Opcode.None,
+      VectorOffset payloadOffset = default(VectorOffset)) {
+    builder.StartTable(4);
+    MigrationCommand.AddPayload(builder, payloadOffset);
+    MigrationCommand.AddEntity(builder, entity);
+    MigrationCommand.AddAccountId(builder, account_id);
+    MigrationCommand.AddOpcode(builder, opcode);
+    return MigrationCommand.EndMigrationCommand(builder);
+  }
+
+  public static void StartMigrationCommand(FlatBufferBuilder builder) { builder.StartTable(4); }
+  public static void AddAccountId(FlatBufferBuilder builder, int accountId) { builder.AddInt(0, accountId, 0); }
+  public static void AddEntity(FlatBufferBuilder builder, uint entity) { builder.AddUint(1, entity, 0); }
+  public static void AddOpcode(FlatBufferBuilder builder, MMO.Network.Opcode opcode) { builder.AddUshort(2, (ushort)opcode, 0); }
+  public static void AddPayload(FlatBufferBuilder builder, VectorOffset payloadOffset) { builder.AddOffset(3, payloadOffset.Value, 0); }
+  public static VectorOffset CreatePayloadVector(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); for (int i = data.Length - 1; i >= 0; i--) builder.AddByte(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreatePayloadVectorBlock(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreatePayloadVectorBlock(FlatBufferBuilder builder, ArraySegment<byte> data) { builder.StartVector(1, data.Count, 1); builder.Add(data); return builder.EndVector(); }
+  public static VectorOffset CreatePayloadVectorBlock(FlatBufferBuilder builder, IntPtr dataPtr, int sizeInBytes) { builder.StartVector(1, sizeInBytes, 1); builder.Add<byte>(dataPtr, sizeInBytes); return builder.EndVector(); }
+  public static void StartPayloadVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(1, numElems, 1); }
+  public static Offset<MMO.Network.MigrationCommand> EndMigrationCommand(FlatBufferBuilder builder) {
+    int o = builder.EndTable();
+    return new Offset<MMO.Network.MigrationCommand>(o);
+  }
+}
+
+
+static public class MigrationCommandVerify
+{
+  static public bool Verify(Google.FlatBuffers.Verifier verifier, uint tablePos)
+  {
+    return verifier.VerifyTableStart(tablePos)
+      && verifier.VerifyField(tablePos, 4 /*AccountId*/, 4 /*int*/, 4, false)
+      && verifier.VerifyField(tablePos, 6 /*Entity*/, 4 /*uint*/, 4, false)
+      && verifier.VerifyField(tablePos, 8 /*Opcode*/, 2 /*MMO.Network.Opcode*/, 2, false)
+      && verifier.VerifyVectorOfData(tablePos, 10 /*Payload*/, 1 /*byte*/, false)
+      && verifier.VerifyTableEnd(tablePos);
+  }
+}
+
+}
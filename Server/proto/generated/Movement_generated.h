@@ -25,6 +25,9 @@ struct MoveRequestBuilder;
 struct MovementSnapshot;
 struct MovementSnapshotBuilder;
 
+struct ReplicationBatch;
+struct ReplicationBatchBuilder;
+
 FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vector2D FLATBUFFERS_FINAL_CLASS {
  private:
   float x_;
@@ -170,6 +173,87 @@ inline ::flatbuffers::Offset<MovementSnapshot> CreateMovementSnapshot(
   return builder_.Finish();
 }
 
+struct ReplicationBatch FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ReplicationBatchBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ENTERED = 4,
+    VT_LEFT = 6,
+    VT_UPDATED = 8
+  };
+  const ::flatbuffers::Vector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>> *entered() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>> *>(VT_ENTERED);
+  }
+  const ::flatbuffers::Vector<uint32_t> *left() const {
+    return GetPointer<const ::flatbuffers::Vector<uint32_t> *>(VT_LEFT);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>> *updated() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>> *>(VT_UPDATED);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ENTERED) &&
+           verifier.VerifyVector(entered()) &&
+           verifier.VerifyVectorOfTables(entered()) &&
+           VerifyOffset(verifier, VT_LEFT) &&
+           verifier.VerifyVector(left()) &&
+           VerifyOffset(verifier, VT_UPDATED) &&
+           verifier.VerifyVector(updated()) &&
+           verifier.VerifyVectorOfTables(updated()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ReplicationBatchBuilder {
+  typedef ReplicationBatch Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_entered(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>>> entered) {
+    fbb_.AddOffset(ReplicationBatch::VT_ENTERED, entered);
+  }
+  void add_left(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> left) {
+    fbb_.AddOffset(ReplicationBatch::VT_LEFT, left);
+  }
+  void add_updated(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>>> updated) {
+    fbb_.AddOffset(ReplicationBatch::VT_UPDATED, updated);
+  }
+  explicit ReplicationBatchBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ReplicationBatch> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ReplicationBatch>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ReplicationBatch> CreateReplicationBatch(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>>> entered = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> left = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>>> updated = 0) {
+  ReplicationBatchBuilder builder_(_fbb);
+  builder_.add_updated(updated);
+  builder_.add_left(left);
+  builder_.add_entered(entered);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ReplicationBatch> CreateReplicationBatchDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>> *entered = nullptr,
+    const std::vector<uint32_t> *left = nullptr,
+    const std::vector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>> *updated = nullptr) {
+  auto entered__ = entered ? _fbb.CreateVector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>>(*entered) : 0;
+  auto left__ = left ? _fbb.CreateVector<uint32_t>(*left) : 0;
+  auto updated__ = updated ? _fbb.CreateVector<::flatbuffers::Offset<MMO::Network::Movement::MovementSnapshot>>(*updated) : 0;
+  return MMO::Network::Movement::CreateReplicationBatch(
+      _fbb,
+      entered__,
+      left__,
+      updated__);
+}
+
 }  // namespace Movement
 }  // namespace Network
 }  // namespace MMO
@@ -2,6 +2,7 @@
 #include "core/Config.h"
 #include "utils/Logger.h"
 #include <csignal>
+#include <cstdlib>
 #include <sodium.h>
 #include <string>
 #include <vector>
@@ -45,6 +46,83 @@ static MMO::ServerConfig ParseArgs(int argc, char* argv[])
         {
             config.maxPlayers = std::stoi(args[++i]);
         }
+        else if (args[i] == "--worker-threads" && i + 1 < args.size())
+        {
+            config.workerThreads = std::stoi(args[++i]);
+        }
+        else if (args[i] == "--path-threads" && i + 1 < args.size())
+        {
+            config.pathThreads = std::stoi(args[++i]);
+        }
+        else if (args[i] == "--tick-scheduler" && i + 1 < args.size())
+        {
+            config.tickScheduler = args[++i];
+        }
+        else if (args[i] == "--callback-budget" && i + 1 < args.size())
+        {
+            config.callbackBudgetMs = std::stof(args[++i]);
+        }
+        else if (args[i] == "--overload-policy" && i + 1 < args.size())
+        {
+            config.overloadPolicy = args[++i];
+        }
+        else if (args[i] == "--max-catchup" && i + 1 < args.size())
+        {
+            config.maxCatchUpSteps = std::stoi(args[++i]);
+        }
+        else if (args[i] == "--snapshot-dir" && i + 1 < args.size())
+        {
+            config.snapshotDir = args[++i];
+        }
+        else if (args[i] == "--snapshot-interval" && i + 1 < args.size())
+        {
+            config.snapshotIntervalSec = std::stoi(args[++i]);
+        }
+        else if (args[i] == "--shard")
+        {
+            config.shardMode = true;
+        }
+        else if (args[i] == "--public-ip" && i + 1 < args.size())
+        {
+            config.publicIp = args[++i];
+        }
+        else if (args[i] == "--shard-dir" && i + 1 < args.size())
+        {
+            config.shardDir = args[++i];
+        }
+        else if (args[i] == "--control-port" && i + 1 < args.size())
+        {
+            config.controlPort = static_cast<uint16_t>(std::stoi(args[++i]));
+        }
+        else if (args[i] == "--control-bind" && i + 1 < args.size())
+        {
+            config.controlBind = args[++i];
+        }
+        else if (args[i] == "--control-secret" && i + 1 < args.size())
+        {
+            config.controlSecret = args[++i];
+        }
+        else if (args[i] == "--hibernate-after" && i + 1 < args.size())
+        {
+            config.hibernateAfterSec = std::stoi(args[++i]);
+        }
+        else if (args[i] == "--record" && i + 1 < args.size())
+        {
+            config.recordPath = args[++i];
+        }
+        else if (args[i] == "--replay" && i + 1 < args.size())
+        {
+            config.replayPath = args[++i];
+        }
+    }
+
+    // Le secret n'apparait pas dans la liste des processus s'il vient de l'environnement
+    if (config.controlSecret.empty())
+    {
+        if (const char* secret = std::getenv("MMO_CONTROL_SECRET"))
+        {
+            config.controlSecret = secret;
+        }
     }
 
     return config;
@@ -64,7 +142,7 @@ int main(int argc, char* argv[])
     std::signal(SIGINT, SignalHandler);
     std::signal(SIGTERM, SignalHandler);
 
-    LOG_INFO("Port: {} | TickRate: {} | DB: {}", config.port, config.tickRate, config.dbPath);
+    LOG_INFO("Port: {} | TickRate: {} | DB: {} | Workers: {}", config.port, config.tickRate, config.dbPath, config.workerThreads);
 
     GameLoop serverLoop(config);
     g_serverLoop = &serverLoop;
@@ -5,14 +5,55 @@
 #include "network/handlers/LoginHandler.h"
 #include "network/handlers/ResourceHandler.h"
 #include "network/handlers/KingdomSelectHandler.h"
+#include "network/handlers/MovementHandler.h"
+#include "network/handlers/CombatHandler.h"
+#include "world/systems/MovementSystem.h"
+#include "world/systems/CombatSystem.h"
+#include "world/WorldSnapshot.h"
+#include "ecs/PlayerComponents.h"
+#include "ecs/CombatComponents.h"
 #include "utils/Logger.h"
 #include "utils/Time.h"
 #include "database/repositories/SqliteAccountRepository.h"
 #include "database/repositories/SqlitePlayerRepository.h"
-#include <thread>
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <span>
 
 
-GameLoop::GameLoop(const MMO::ServerConfig& config) : m_config(config), m_isRunning(false), m_tickDuration(1000 / config.tickRate) 
+namespace
+{
+    // Reaction de la boucle quand un ou plusieurs ticks ont pris du retard
+    enum class OverloadPolicy
+    {
+        CatchUp,    // Rejoue les ticks manques a dt fixe (plafonne a maxCatchUpSteps)
+        Stretch,    // Un seul tick avec un dt allonge (plafonne a maxCatchUpSteps * dt)
+        Drop        // Abandonne le temps perdu (comportement historique)
+    };
+
+    OverloadPolicy ParseOverloadPolicy(const std::string& name)
+    {
+        if (name == "catchup") return OverloadPolicy::CatchUp;
+        if (name == "stretch") return OverloadPolicy::Stretch;
+        if (name == "drop") return OverloadPolicy::Drop;
+
+        LOG_WARN("Politique de surcharge inconnue '{}'. Utilisation de 'catchup'.", name);
+        return OverloadPolicy::CatchUp;
+    }
+
+    const char* OverloadPolicyName(OverloadPolicy policy)
+    {
+        switch (policy)
+        {
+            case OverloadPolicy::Stretch: return "stretch";
+            case OverloadPolicy::Drop: return "drop";
+            default: return "catchup";
+        }
+    }
+}
+
+GameLoop::GameLoop(const MMO::ServerConfig& config) : m_config(config), m_isRunning(false), m_tickDuration(1000000 / config.tickRate) 
 {
 }
 
@@ -22,15 +63,31 @@ void GameLoop::Run()
 
     // --- Initialisation du reseau ---
     m_networkManager = std::make_unique<MMO::Network::NetworkManager>();
-    if (!m_networkManager->Initialize(m_config))
+    const bool isReplay = !m_config.replayPath.empty();
+    if (isReplay)
+    {
+        // Pas de socket : le trafic vient du fichier enregistre
+        if (!m_networkManager->StartReplay(m_config.replayPath))
+        {
+            LOG_ERROR("Echec de l'ouverture du replay. Arret du serveur.");
+            return;
+        }
+    }
+    else if (!m_networkManager->Initialize(m_config))
     {
         LOG_ERROR("Echec de l'initialisation du NetworkManager. Arret du serveur.");
         return;
     }
 
+    if (!m_config.recordPath.empty())
+    {
+        m_networkManager->StartRecording(m_config.recordPath, static_cast<uint16_t>(m_config.tickRate));
+    }
+
     // --- Initialisation de la base de donnees ---
     m_dbManager = std::make_shared<MMO::Database::DatabaseManager>();
-    if (!m_dbManager->Initialize(m_config.dbPath))
+    // En replay, les requetes DB s'executent au moment du paquet : leurs callbacks tombent toujours au meme tick
+    if (!m_dbManager->Initialize(m_config.dbPath, isReplay))
     {
         LOG_ERROR("Echec de l'initialisation de la Base de Donnees. Arret du serveur.");
         return;
@@ -42,11 +99,90 @@ void GameLoop::Run()
     // Nettoyage ECS a la deconnexion
     SetupDisconnectHandler();
 
+    // --- Pool de workers (tick parallele des royaumes et des systemes sans conflit) ---
+    if (m_config.workerThreads > 0)
+    {
+        m_workerPool = std::make_unique<MMO::Utils::ThreadPool>(static_cast<size_t>(m_config.workerThreads));
+        LOG_INFO("Tick parallele active ({} workers)", m_config.workerThreads);
+    }
+
+    // --- Pathfinding (threads dedies, resultats livres aux royaumes au debut du tick) ---
+    // En replay, calcul synchrone : chaque chemin est livre au tick qui suit sa requete, quelle que soit la machine
+    m_pathfinding = std::make_unique<MMO::Core::PathfindingService>(isReplay ? 0 : static_cast<size_t>(std::max(1, m_config.pathThreads)));
+
+    // --- E/S des snapshots (jamais en replay) : avant les royaumes, l'hibernation en depend ---
+    if (!isReplay && !m_config.snapshotDir.empty())
+    {
+        m_snapshotIO = std::make_unique<MMO::Utils::ThreadPool>(1);
+    }
+
+    // --- Mode shard : ce processus n'heberge que les royaumes a son adresse ---
+    if (!isReplay && m_config.shardMode)
+    {
+        // Canal de controle (migration) : port dedie, jamais expose aux clients
+        // Ecoute sur controlBind (loopback par defaut) ; sur toutes les interfaces, publicIp est l'adresse annoncee
+        const MMO::Core::ShardEndpoint self{ m_config.publicIp, m_config.port };
+        const bool isAnyInterface = m_config.controlBind == "0.0.0.0" || m_config.controlBind == "::";
+        MMO::Core::ShardEndpoint control{ isAnyInterface ? m_config.publicIp : m_config.controlBind,
+            m_config.controlPort != 0 ? m_config.controlPort : static_cast<uint16_t>(m_config.port + 1000) };
+
+        if (m_config.controlSecret.empty())
+        {
+            LOG_WARN("Migration des royaumes desactivee (aucun secret : --control-secret ou MMO_CONTROL_SECRET)");
+            control.port = 0;
+        }
+
+        // Le repertoire precede le canal : il filtre les liens entrants des le premier paquet
+        m_shards = std::make_unique<MMO::Core::ShardDirectory>(m_config.shardDir, self, control);
+        if (control.port != 0)
+        {
+            m_control = std::make_unique<MMO::Network::ControlHost>();
+            m_control->SetAuthorizer([shards = m_shards.get()](const MMO::Network::ControlAddress& remote)
+            {
+                return shards->FindShardByControlAddress(MMO::Core::ShardEndpoint{ remote.ip, remote.port }).has_value();
+            });
+
+            if (!m_control->Start(m_config.controlBind, control.port, m_config.controlSecret))
+            {
+                LOG_ERROR("Migration des royaumes desactivee (canal de controle indisponible)");
+                m_control.reset();
+
+                // Aucun bail n'est encore ecrit : le canal n'est jamais annonce
+                m_shards = std::make_unique<MMO::Core::ShardDirectory>(m_config.shardDir, self, MMO::Core::ShardEndpoint{});
+            }
+        }
+        m_shardIO = std::make_unique<MMO::Utils::ThreadPool>(1);
+    }
+
     // --- Chargement des royaumes ---
     LoadKingdoms();
 
+    // --- Redemarrage a chaud : etat des royaumes residents recharge depuis les snapshots ---
+    if (m_snapshotIO)
+    {
+        LoadSnapshots();
+        m_nextSnapshotTick = static_cast<uint64_t>(std::max(0, m_config.snapshotIntervalSec)) * m_config.tickRate;
+    }
+
     // --- Enregistrement de tous les handlers ---
     RegisterHandlers();
+    if (m_control)
+    {
+        CreateMigrationManager();
+    }
+
+    // Histogrammes des phases resolus une fois : ni verrou ni std::string dans les phases mesurees
+    m_phaseHistograms.networkIn = &m_profiler.Get("phase.network_in");
+    m_phaseHistograms.networkOut = &m_profiler.Get("phase.network_out");
+    m_phaseHistograms.callbacks = &m_profiler.Get("phase.callbacks");
+    m_phaseHistograms.kingdoms = &m_profiler.Get("phase.kingdoms");
+    m_phaseHistograms.total = &m_profiler.Get("tick.total");
+
+    if (isReplay)
+    {
+        RunReplay();
+        return;
+    }
 
     LOG_INFO("Demarrage du Serveur (Tickrate: {}, Port: {}, Royaumes: {})",
         m_config.tickRate, m_config.port, m_kingdoms.size());
@@ -54,56 +190,186 @@ void GameLoop::Run()
     // Demarrage du systeme de commandes console
     MMO::Core::CommandContext cmdCtx{
         m_config.dbPath,
-        [this]() { Stop(); }
+        [this]() { Stop(); },
+        &m_profiler,
+        &m_mainThreadCallbacks,
+        &m_replication,
+        m_pathfinding.get(),
+        [this]() { SaveSnapshots(false); },
+        [this]() { PrintKingdoms(); },
+        nullptr
     };
+    if (m_control)
+    {
+        cmdCtx.migrateKingdom = [this](int kingdomId, const std::string& ip, uint16_t port)
+        {
+            m_migrations->Start(kingdomId, MMO::Core::ShardEndpoint{ ip, port });
+        };
+    }
     MMO::Core::RegisterServerCommands(m_commandSystem, cmdCtx);
     m_commandSystem.Start();
 
     // --- Boucle principale a tick fixe ---
-    auto next_tick_time = std::chrono::steady_clock::now();
-    MMO::Time::Stopwatch tickTimer;
+    m_tickScheduler = MMO::Core::CreateTickScheduler(m_config.tickScheduler);
+    auto& jitterHistogram = m_profiler.Get("scheduler." + m_tickScheduler->GetName() + ".jitter");
+    LOG_INFO("Tick scheduler: {}", m_tickScheduler->GetName());
+
     const float dt = 1.0f / static_cast<float>(m_config.tickRate);
+    const OverloadPolicy overloadPolicy = ParseOverloadPolicy(m_config.overloadPolicy);
+    const int64_t maxCatchUpSteps = std::max(1, m_config.maxCatchUpSteps);
+    LOG_INFO("Politique de surcharge: {} (max {} ticks de retard)", OverloadPolicyName(overloadPolicy), maxCatchUpSteps);
 
-    while (m_isRunning) 
-    {
-        tickTimer.Reset();
+    // Retard du temps simule sur le temps reel au debut de chaque tick, et frequence des ticks degrades
+    auto& debtHistogram = m_profiler.Get("tick.sim_debt");
+    auto& degradedHistogram = m_profiler.Get(std::string("overload.") + OverloadPolicyName(overloadPolicy));
+    auto& droppedHistogram = m_profiler.Get("overload.dropped");
 
-        ProcessNetworkIn();
-        UpdateLogic(dt);
-        ProcessNetworkOut();
+    auto next_tick_time = std::chrono::steady_clock::now();
 
-        float timeTaken = tickTimer.ElapsedMilliseconds();
-        if (timeTaken > static_cast<float>(m_tickDuration.count())) 
+    while (m_isRunning) 
+    {
+        // Nombre de ticks dus depuis la derniere echeance (1 en regime normal)
+        auto lag = std::chrono::steady_clock::now() - next_tick_time;
+        if (lag < std::chrono::steady_clock::duration::zero())
         {
-            LOG_WARN("Serveur en surcharge ! Le tick a pris : {:.2f} ms", timeTaken);
+            lag = std::chrono::steady_clock::duration::zero();
         }
+        int64_t dueTicks = 1 + lag / m_tickDuration;
+        float lagMs = std::chrono::duration<float, std::milli>(lag).count();
+        debtHistogram.Record(lagMs);
 
-        next_tick_time += m_tickDuration;
-        auto now = std::chrono::steady_clock::now();
-        auto sleep_time = next_tick_time - now;
-
-        if (sleep_time > std::chrono::milliseconds::zero())
+        // Ticks simules ce tour-ci : rattrapage plafonne, ou un seul tick en mode drop
+        int64_t steps = 1;
+        if (dueTicks > 1)
         {
-            auto os_sleep_time = sleep_time - std::chrono::milliseconds(2);
-            if (os_sleep_time > std::chrono::milliseconds::zero()) 
+            degradedHistogram.Record(lagMs);
+
+            steps = overloadPolicy == OverloadPolicy::Drop ? 1 : std::min(dueTicks, maxCatchUpSteps);
+            if (steps < dueTicks)
             {
-                std::this_thread::sleep_for(os_sleep_time);
+                float droppedMs = std::chrono::duration<float, std::milli>(m_tickDuration * (dueTicks - steps)).count();
+                droppedHistogram.Record(droppedMs);
+                LOG_WARN("Surcharge : {:.0f} ms de temps simule abandonnes ({} ticks de retard)", droppedMs, dueTicks);
             }
-            while (std::chrono::steady_clock::now() < next_tick_time) 
+        }
+
+        float timeTaken = 0.0f;
+        if (overloadPolicy == OverloadPolicy::Stretch)
+        {
+            // Un seul tick avec un dt couvrant tout le retard conserve
+            timeTaken = ExecuteTick(dt * static_cast<float>(steps));
+        }
+        else
+        {
+            // Pas fixes : le dt vu par les systemes ne change jamais
+            for (int64_t step = 0; step < steps && m_isRunning; ++step)
             {
-                std::this_thread::yield();
+                timeTaken = std::max(timeTaken, ExecuteTick(dt));
             }
-        } 
-        else
+        }
+
+        if (timeTaken > std::chrono::duration<float, std::milli>(m_tickDuration).count()) 
         {
-            LOG_ERROR("Tick saute ! La boucle n'a pas pu se reposer.");
-            next_tick_time = std::chrono::steady_clock::now();
+            LOG_WARN("Serveur en surcharge ! Le tick a pris : {:.2f} ms", timeTaken);
+        }
+
+        // Les ticks dus sont consommes : rattrapes, etires ou abandonnes
+        next_tick_time += m_tickDuration * dueTicks;
+        if (next_tick_time > std::chrono::steady_clock::now())
+        {
+            m_tickScheduler->WaitUntil(next_tick_time);
+
+            // Retard du reveil par rapport a l'echeance
+            jitterHistogram.Record(std::chrono::duration<float, std::milli>(
+                std::chrono::steady_clock::now() - next_tick_time).count());
         }
     }
     
+    // Commit de migration sans reponse : le royaume reste gele, le prochain demarrage tranche selon son proprietaire
+    if (m_migrations)
+    {
+        for (int kingdomId : m_migrations->Shutdown())
+        {
+            SaveHandoffSnapshot(kingdomId);
+        }
+    }
+
+    // Snapshot d'arret : le prochain demarrage reprend les joueurs sans relire la DB
+    // Un royaume en cours d'hibernation a deja son ecriture dans la file
+    SaveSnapshots(true);
+    m_snapshotIO.reset(); // Attend la fin des ecritures
+
+    // Bail retire apres le dernier battement : nos royaumes passent hors ligne pour les autres processus
+    if (m_shards)
+    {
+        m_control.reset();
+        m_shardIO.reset();
+        m_shards->Withdraw();
+    }
+
     LOG_INFO("Game Loop arretee proprement.");
 }
 
+float GameLoop::ExecuteTick(float dt)
+{
+    MMO::Time::Stopwatch tickTimer;
+    m_networkManager->SetCurrentTick(m_tickCount);
+
+    {
+        MMO::Core::ScopedTimer phaseTimer(m_phaseHistograms.networkIn);
+        ProcessNetworkIn();
+    }
+    UpdateLogic(dt);
+    {
+        MMO::Core::ScopedTimer phaseTimer(m_phaseHistograms.networkOut);
+        ProcessNetworkOut();
+    }
+
+    float timeTaken = tickTimer.ElapsedMilliseconds();
+    m_phaseHistograms.total->Record(timeTaken);
+    ++m_tickCount;
+    return timeTaken;
+}
+
+void GameLoop::RunReplay()
+{
+    // Meme dt qu'a l'enregistrement, sinon la simulation diverge
+    int tickRate = m_networkManager->GetReplayTickRate();
+    if (tickRate <= 0)
+    {
+        tickRate = m_config.tickRate;
+    }
+    else if (tickRate != m_config.tickRate)
+    {
+        LOG_WARN("TickRate de l'enregistrement ({}) different de la config ({}). Utilisation de {}.",
+            tickRate, m_config.tickRate, tickRate);
+    }
+    const float dt = 1.0f / static_cast<float>(tickRate);
+
+    LOG_INFO("Demarrage du replay (Royaumes: {}, Workers: {})", m_kingdoms.size(), m_config.workerThreads);
+
+    // Ticks enchaines sans attente : la duree totale mesure le cout reel du traitement
+    MMO::Time::Stopwatch replayTimer;
+    while (m_isRunning && !m_networkManager->IsReplayFinished())
+    {
+        ExecuteTick(dt);
+    }
+
+    float elapsedMs = replayTimer.ElapsedMilliseconds();
+    float simulatedMs = static_cast<float>(m_tickCount) * dt * 1000.0f;
+    LOG_INFO("Replay termine : {} ticks en {:.1f} ms ({:.1f}x temps reel)",
+        m_tickCount, elapsedMs, elapsedMs > 0.0f ? simulatedMs / elapsedMs : 0.0f);
+
+    // DB synchrone : les derniers callbacks sont deja en file, quelques ticks les vident sans attente
+    static constexpr int MAX_DRAIN_TICKS = 1000;
+    for (int drained = 0; m_isRunning && m_mainThreadCallbacks.GetDepth() > 0 && drained < MAX_DRAIN_TICKS; ++drained)
+    {
+        ExecuteTick(dt);
+    }
+
+    m_profiler.PrintReport();
+}
+
 void GameLoop::Stop() 
 { 
     m_isRunning = false;
@@ -114,33 +380,136 @@ void GameLoop::Stop()
     }
 }
 
-void GameLoop::EnqueueMainThreadCallback(std::function<void()> callback)
+void GameLoop::EnqueueMainThreadCallback(std::function<void()> callback, MMO::Core::CallbackPriority priority)
 {
-    m_mainThreadCallbacks.Push(std::move(callback));
+    m_mainThreadCallbacks.Push(std::move(callback), priority);
 }
 
 void GameLoop::LoadKingdoms()
 {
     MMO::Core::KingdomRegistry kingdomRegistry;
-    if (!kingdomRegistry.LoadFromFile(m_config.kingdomsConfigPath))
+    if (kingdomRegistry.LoadFromFile(m_config.kingdomsConfigPath))
+    {
+        m_kingdomCatalog = kingdomRegistry.GetAll();
+    }
+    else
     {
         LOG_WARN("Impossible de charger le fichier royaumes: {}. Creation d'un royaume par defaut.", m_config.kingdomsConfigPath);
-        m_kingdoms[1] = std::make_unique<MMO::Core::KingdomWorld>(1, "Royaume Principal");
-        return;
     }
 
-    for (const auto& entry : kingdomRegistry.GetAll())
+    if (m_kingdomCatalog.empty())
     {
-        m_kingdoms[entry.id] = std::make_unique<MMO::Core::KingdomWorld>(entry.id, entry.name);
+        LOG_WARN("Aucun royaume charge. Creation d'un royaume par defaut.");
+        m_kingdomCatalog.push_back(MMO::Core::KingdomInfo{
+            .id = 1, .name = "Royaume Principal", .ip = m_config.publicIp, .port = m_config.port });
     }
 
-    if (m_kingdoms.empty())
+    // Mode shard : proprietaires enregistres par les migrations et baux deja publies, avant l'adresse de kingdoms.json
+    if (m_shards)
     {
-        LOG_WARN("Aucun royaume charge. Creation d'un royaume par defaut.");
-        m_kingdoms[1] = std::make_unique<MMO::Core::KingdomWorld>(1, "Royaume Principal");
+        m_shards->Refresh();
+    }
+
+    // Avec l'hibernation, un royaume deja sauvegarde reste sur disque jusqu'a la premiere selection
+    const bool isLazy = IsHibernationEnabled();
+    size_t hibernatedCount = 0;
+    std::vector<int> localKingdoms;
+    for (const auto& info : m_kingdomCatalog)
+    {
+        // Mode shard : un royaume hors de ce processus appartient a un autre (liste et redirection seulement)
+        if (m_shards)
+        {
+            const bool isLocal = m_shards->ResolveOwner(info.id, MMO::Core::ShardEndpoint{ info.ip, info.port }) == m_shards->GetSelf();
+            if (m_snapshotIO)
+            {
+                ResolveHandoffSnapshot(info.id, isLocal);
+            }
+            if (!isLocal)
+                continue;
+        }
+
+        localKingdoms.push_back(info.id);
+        auto& slot = m_kingdomSlots[info.id];
+        slot.info = info;
+
+        std::error_code error;
+        if (isLazy && std::filesystem::exists(GetSnapshotPath(info.id), error))
+        {
+            slot.residency = KingdomResidency::Hibernated;
+            hibernatedCount++;
+            continue;
+        }
+
+        CreateKingdom(info);
+    }
+
+    LOG_INFO("{} royaume(s) charge(s), {} hiberne(s).", m_kingdoms.size(), hibernatedCount);
+
+    if (m_shards)
+    {
+        m_shards->SetLocalKingdoms(localKingdoms);
+        LOG_INFO("Mode shard ({}:{}) : {} royaume(s) heberge(s) sur {}, baux dans '{}'",
+            m_config.publicIp, m_config.port, localKingdoms.size(), m_kingdomCatalog.size(), m_config.shardDir);
+
+        // Premier bail immediat : les autres processus redirigent vers nous sans attendre une seconde
+        PublishShardLease();
+    }
+}
+
+MMO::Core::KingdomWorld& GameLoop::CreateKingdom(const MMO::Core::KingdomInfo& info)
+{
+    return AttachKingdom(BuildKingdom(info, LoadKingdomMap(info)));
+}
+
+std::shared_ptr<const MMO::Core::WorldMap> GameLoop::LoadKingdomMap(const MMO::Core::KingdomInfo& info)
+{
+    if (info.mapPath.empty())
+        return nullptr;
+
+    // Carte projetee (ou deja projetee par un autre royaume)
+    auto map = m_mapCache.Load(info.mapPath);
+    if (!map)
+    {
+        LOG_WARN("Royaume {} : carte '{}' indisponible, monde sans terrain", info.id, info.mapPath);
+    }
+    return map;
+}
+
+std::unique_ptr<MMO::Core::KingdomWorld> GameLoop::BuildKingdom(const MMO::Core::KingdomInfo& info,
+    std::shared_ptr<const MMO::Core::WorldMap> map)
+{
+    // Les dimensions de la carte bornent la grille spatiale si le royaume ne les fixe pas
+    float mapWidth = info.mapWidth;
+    float mapHeight = info.mapHeight;
+    if (map && (mapWidth <= 0.0f || mapHeight <= 0.0f))
+    {
+        mapWidth = map->GetWorldWidth();
+        mapHeight = map->GetWorldHeight();
     }
 
-    LOG_INFO("{} royaume(s) charge(s).", m_kingdoms.size());
+    auto world = std::make_unique<MMO::Core::KingdomWorld>(info.id, info.name, mapWidth, mapHeight);
+    world->SetMap(std::move(map));
+
+    // Systemes de gameplay communs a tous les royaumes
+    world->AddSystem(std::make_unique<MMO::Core::MovementSystem>());
+    world->AddSystem(std::make_unique<MMO::Core::CombatSystem>());
+    return world;
+}
+
+MMO::Core::KingdomWorld& GameLoop::AttachKingdom(std::unique_ptr<MMO::Core::KingdomWorld> world)
+{
+    world->SetProfiler(&m_profiler);
+    world->SetJobPool(m_workerPool.get());
+    world->SetPathfinding(m_pathfinding.get());
+
+    auto& ref = *world;
+    int id = world->GetId();
+    m_kingdoms[id] = std::move(world);
+
+    auto& slot = m_kingdomSlots[id];
+    slot.residency = KingdomResidency::Resident;
+    slot.idleSinceTick = m_tickCount;
+    return ref;
 }
 
 void GameLoop::RegisterHandlers()
@@ -152,15 +521,38 @@ void GameLoop::RegisterHandlers()
     // TODO: Supprimer le parametre registry de RegisterPingHandler
     static entt::registry dummyRegistry;
 
-    auto runOnMainThread = [this](std::function<void()> cb) { EnqueueMainThreadCallback(std::move(cb)); };
+    // Les retours DB du login et de la selection de royaume passent apres le gameplay
+    auto runOnMainThread = [this](std::function<void()> cb)
+    {
+        EnqueueMainThreadCallback(std::move(cb), MMO::Core::CallbackPriority::Session);
+    };
 
     MMO::Network::RegisterPingHandler(dispatcher, dummyRegistry);
     MMO::Network::RegisterLoginHandler(dispatcher, sessionManager, m_accountRepo, runOnMainThread);
-    MMO::Network::RegisterKingdomSelectHandler(dispatcher, sessionManager, m_kingdoms,
-        m_accountRepo, m_playerRepo, runOnMainThread);
-    MMO::Network::RegisterResourceHandler(dispatcher, sessionManager, m_kingdoms, m_playerRepo);
+    // Un royaume hiberne est reveille a la selection, l'entree du joueur attend la fin du chargement
+    auto loadKingdom = [this](int kingdomId, std::function<void(bool)> onReady)
+    {
+        RequestKingdom(kingdomId, std::move(onReady));
+    };
 
-    LOG_INFO("Handlers reseau enregistres (Ping, Login, KingdomSelect, Resource)");
+    MMO::Network::RegisterKingdomSelectHandler(dispatcher, sessionManager, m_kingdoms, m_kingdomCatalog,
+        loadKingdom, m_shards.get(), m_accountRepo, m_playerRepo, runOnMainThread);
+
+    // Gameplay : session et royaume resolus par le routeur, paquets d'un royaume gele mis de cote
+    m_playerCommands = std::make_unique<MMO::Network::PlayerCommandRouter>(dispatcher, sessionManager, m_kingdoms);
+    m_playerCommands->SetDeferHandler([this](const MMO::Network::PlayerSession& session, MMO::Network::Opcode opcode,
+        std::span<const uint8_t> payload)
+    {
+        if (m_migrations)
+        {
+            m_migrations->DeferPlayerCommand(session, opcode, payload);
+        }
+    });
+    MMO::Network::RegisterResourceHandler(*m_playerCommands, m_playerRepo);
+    MMO::Network::RegisterMovementHandler(*m_playerCommands);
+    MMO::Network::RegisterCombatHandler(*m_playerCommands);
+
+    LOG_INFO("Handlers reseau enregistres (Ping, Login, KingdomSelect, Resource, Movement, Combat)");
 }
 
 void GameLoop::SetupDisconnectHandler()
@@ -170,53 +562,646 @@ void GameLoop::SetupDisconnectHandler()
         {
             if (session.entityID != MMO::INVALID_ENTITY && session.kingdomId >= 0)
             {
+                // Meme classe que l'entree en royaume : jamais reordonne avec elle, et la sauvegarde part
+                // avant la relecture d'une reconnexion
                 EnqueueMainThreadCallback([this, entityID = session.entityID,
                     playerID = session.playerID, kingdomId = session.kingdomId]()
                 {
                     auto it = m_kingdoms.find(kingdomId);
-                    if (it != m_kingdoms.end())
+                    if (it != m_kingdoms.end() && it->second->GetRegistry().valid(entityID))
                     {
-                        auto& registry = it->second->GetRegistry();
-                        if (registry.valid(entityID))
-                        {
-                            it->second->GetSpatialGrid().Remove(entityID);
-                            registry.destroy(entityID);
-                            LOG_INFO("Entite ECS detruite pour le joueur {} dans le royaume {}",
-                                playerID, kingdomId);
-                        }
+                        RemovePlayerEntity(*it->second, entityID);
+                        LOG_INFO("Joueur {} retire du royaume {}", playerID, kingdomId);
                     }
-                });
+                }, MMO::Core::CallbackPriority::Session);
             }
         });
 }
 
+void GameLoop::PersistResources(entt::registry& registry, entt::entity entity, int kingdomId)
+{
+    auto* res = registry.try_get<MMO::ECS::ResourcesComponent>(entity);
+    auto* info = registry.try_get<MMO::ECS::PlayerInfoComponent>(entity);
+    if (!res || !info || !m_playerRepo)
+        return;
+
+    // Reglement a la sauvegarde : la base repart de montants a jour, chacun avec sa fraction en cours
+    res->SettleAll(MMO::Time::UnixMilliseconds());
+    m_playerRepo->UpdateResources(info->accountID, kingdomId, MMO::Network::ToStoredResources(*res));
+
+    // Blesses sauvegardes comme gueris : leur timer ne survit pas a l'entite d'un joueur qui se deconnecte
+    if (auto* army = registry.try_get<MMO::ECS::ArmyComponent>(entity))
+    {
+        m_playerRepo->UpdateTroops(info->accountID, kingdomId, static_cast<int>(army->troops + army->wounded));
+    }
+}
+
+void GameLoop::RemovePlayerEntity(MMO::Core::KingdomWorld& world, entt::entity entity)
+{
+    auto& registry = world.GetRegistry();
+    PersistResources(registry, entity, world.GetId());
+
+    const auto* army = registry.try_get<MMO::ECS::ArmyComponent>(entity);
+    const auto* info = registry.try_get<MMO::ECS::PlayerInfoComponent>(entity);
+    if (army && info && army->deployed > 0)
+    {
+        world.KeepOfflinePlayer(info->accountID, entity);
+        LOG_INFO("Compte {} hors ligne dans le royaume {} : {} troupes encore engagees",
+            info->accountID, world.GetId(), army->deployed);
+        return;
+    }
+
+    registry.destroy(entity);
+}
+
+void GameLoop::ReleaseOfflinePlayers()
+{
+    std::vector<entt::entity> released;
+    for (auto& [id, world] : m_kingdoms)
+    {
+        if (!world->HasOfflinePlayers())
+            continue;
+
+        released.clear();
+        world->ReleaseOfflinePlayers(released);
+
+        auto& registry = world->GetRegistry();
+        for (entt::entity entity : released)
+        {
+            // Sauvegarde finale : pertes des batailles terminees depuis la deconnexion
+            PersistResources(registry, entity, id);
+            registry.destroy(entity);
+        }
+    }
+}
+
 void GameLoop::ProcessNetworkIn() 
 { 
     if (m_networkManager)
     {
         m_networkManager->ProcessEvents();
     }
+
+    if (m_control)
+    {
+        m_control->ProcessEvents();
+    }
 }
 
 void GameLoop::UpdateLogic(float dt) 
 {
-    // Traitement des callbacks main thread
-    while (auto callbackOpt = m_mainThreadCallbacks.TryPop())
+    // Traitement des callbacks main thread, sous budget (le reste est reporte au tick suivant)
+    {
+        MMO::Core::ScopedTimer phaseTimer(m_phaseHistograms.callbacks);
+        m_mainThreadCallbacks.Drain(m_config.callbackBudgetMs);
+    }
+
+    // Tick de chaque royaume (barriere avant ProcessNetworkOut)
+    {
+        MMO::Core::ScopedTimer phaseTimer(m_phaseHistograms.kingdoms);
+        TickKingdoms(dt);
+    }
+
+    // Snapshot periodique en arriere-plan : capture au debut d'un tick suivant, apres le gameplay et les entrees
+    // en royaume, entre deux ticks (aucune registry ne bouge pendant la capture)
+    if (m_nextSnapshotTick > 0 && m_tickCount >= m_nextSnapshotTick)
     {
-        if (callbackOpt.value())
+        EnqueueMainThreadCallback([this]()
         {
-            callbackOpt.value()();
-        }
+            SaveSnapshots(false);
+        }, MMO::Core::CallbackPriority::Background);
+        m_nextSnapshotTick = m_tickCount + static_cast<uint64_t>(m_config.snapshotIntervalSec) * m_config.tickRate;
     }
 
-    // Tick de chaque royaume
-    for (auto& [id, world] : m_kingdoms)
+    // Une fois par seconde : joueurs hors ligne, hibernation des royaumes vides, bail de shard
+    if (m_tickCount % static_cast<uint64_t>(m_config.tickRate) == 0)
     {
-        world->OnTick(dt);
+        ReleaseOfflinePlayers();
+        if (IsHibernationEnabled())
+        {
+            HibernateIdleKingdoms();
+        }
+        if (m_shards)
+        {
+            PublishShardLease();
+        }
+        if (m_migrations)
+        {
+            m_migrations->CheckTimeouts();
+        }
     }
 
     // Traitement des commandes console
     m_commandSystem.ProcessPending();
 }
 
-void GameLoop::ProcessNetworkOut() { /* TODO: batched broadcasts */ }
\ No newline at end of file
+void GameLoop::TickKingdoms(float dt)
+{
+    if (!m_workerPool)
+    {
+        for (auto& [id, world] : m_kingdoms)
+        {
+            world->OnTick(dt);
+        }
+        return;
+    }
+
+    // Chaque royaume a sa propre registry et sa propre grille : aucun etat partage entre les jobs
+    m_tickList.clear();
+    for (auto& [id, world] : m_kingdoms)
+    {
+        m_tickList.push_back(world.get());
+    }
+
+    m_workerPool->ParallelFor(m_tickList.size(), [this, dt](size_t index)
+    {
+        m_tickList[index]->OnTick(dt);
+    });
+}
+
+std::string GameLoop::GetSnapshotPath(int kingdomId) const
+{
+    return (std::filesystem::path(m_config.snapshotDir) / std::format("kingdom_{}.snap", kingdomId)).string();
+}
+
+void GameLoop::LoadSnapshots()
+{
+    MMO::Time::Stopwatch loadTimer;
+
+    m_tickList.clear();
+    for (auto& [id, world] : m_kingdoms)
+    {
+        m_tickList.push_back(world.get());
+    }
+
+    // Chaque royaume lit son fichier dans sa propre registry : chargements independants
+    std::atomic<size_t> restoredCount{ 0 };
+    auto loadKingdom = [this, &restoredCount](size_t index)
+    {
+        auto* world = m_tickList[index];
+        std::string path = GetSnapshotPath(world->GetId());
+        if (!world->LoadSnapshot(path))
+            return;
+
+        restoredCount++;
+
+        // Fichier consomme : un crash avant le prochain snapshot ne doit pas recharger un etat perime
+        ConsumeSnapshot(world->GetId());
+    };
+
+    if (m_workerPool)
+    {
+        m_workerPool->ParallelFor(m_tickList.size(), loadKingdom);
+    }
+    else
+    {
+        for (size_t i = 0; i < m_tickList.size(); ++i)
+        {
+            loadKingdom(i);
+        }
+    }
+
+    if (restoredCount > 0)
+    {
+        LOG_INFO("{} royaume(s) restaure(s) depuis '{}' en {:.1f} ms",
+            restoredCount.load(), m_config.snapshotDir, loadTimer.ElapsedMilliseconds());
+    }
+}
+
+void GameLoop::SaveSnapshots(bool isClean)
+{
+    if (!m_snapshotIO)
+        return;
+
+    MMO::Core::ScopedTimer captureTimer(&m_profiler.Get("snapshot.capture"));
+
+    m_tickList.clear();
+    for (auto& [id, world] : m_kingdoms)
+    {
+        m_tickList.push_back(world.get());
+    }
+
+    // Capture en memoire en parallele (registries independantes), ecriture disque hors du tick
+    std::vector<std::shared_ptr<std::vector<uint8_t>>> buffers(m_tickList.size());
+    auto captureKingdom = [this, &buffers, isClean](size_t index)
+    {
+        buffers[index] = std::make_shared<std::vector<uint8_t>>(m_tickList[index]->CaptureSnapshot(isClean));
+    };
+
+    if (m_workerPool)
+    {
+        m_workerPool->ParallelFor(m_tickList.size(), captureKingdom);
+    }
+    else
+    {
+        for (size_t i = 0; i < m_tickList.size(); ++i)
+        {
+            captureKingdom(i);
+        }
+    }
+
+    size_t totalBytes = 0;
+    for (size_t i = 0; i < m_tickList.size(); ++i)
+    {
+        totalBytes += buffers[i]->size();
+        m_snapshotIO->Enqueue([path = GetSnapshotPath(m_tickList[i]->GetId()), buffer = buffers[i]]()
+        {
+            MMO::Core::WriteWorldSnapshot(path, *buffer);
+        });
+    }
+
+    LOG_INFO("Snapshot {} de {} royaume(s) capture ({} Ko)",
+        isClean ? "d'arret" : "periodique", m_tickList.size(), totalBytes / 1024);
+}
+
+void GameLoop::SaveHandoffSnapshot(int kingdomId)
+{
+    auto slotIt = m_kingdomSlots.find(kingdomId);
+    if (!m_snapshotIO || slotIt == m_kingdomSlots.end() || !slotIt->second.parked)
+        return;
+
+    // Ressources des joueurs ecrites en base au gel : le snapshot est propre
+    auto buffer = std::make_shared<std::vector<uint8_t>>(slotIt->second.parked->CaptureSnapshot(true));
+    m_snapshotIO->Enqueue([path = GetSnapshotPath(kingdomId) + ".handoff", buffer]()
+    {
+        MMO::Core::WriteWorldSnapshot(path, *buffer);
+    });
+}
+
+void GameLoop::ResolveHandoffSnapshot(int kingdomId, bool isLocal)
+{
+    std::string path = GetSnapshotPath(kingdomId);
+    std::string handoffPath = path + ".handoff";
+    std::error_code error;
+    if (!std::filesystem::exists(handoffPath, error))
+        return;
+
+    if (isLocal)
+    {
+        std::filesystem::rename(handoffPath, path, error);
+        LOG_INFO("Royaume {} : migration interrompue non appliquee par la cible, etat du gel repris", kingdomId);
+        return;
+    }
+
+    std::filesystem::remove(handoffPath, error);
+    ConsumeSnapshot(kingdomId);
+    LOG_INFO("Royaume {} : migration interrompue appliquee par la cible, etat local abandonne", kingdomId);
+}
+
+void GameLoop::ConsumeSnapshot(int kingdomId)
+{
+    std::string path = GetSnapshotPath(kingdomId);
+    std::error_code error;
+    std::filesystem::rename(path, path + ".prev", error);
+}
+
+void GameLoop::NotifyKingdomWaiters(KingdomSlot& slot, bool isReady)
+{
+    // Un waiter peut redemander le royaume : la liste est videe avant les appels
+    auto waiters = std::move(slot.waiters);
+    slot.waiters.clear();
+    for (auto& onReady : waiters)
+    {
+        onReady(isReady);
+    }
+}
+
+void GameLoop::RequestKingdom(int kingdomId, std::function<void(bool)> onReady)
+{
+    auto it = m_kingdomSlots.find(kingdomId);
+    if (it == m_kingdomSlots.end())
+    {
+        onReady(false);
+        return;
+    }
+
+    auto& slot = it->second;
+    switch (slot.residency)
+    {
+        case KingdomResidency::Resident:
+            // Une entree en cours compte comme une activite (pas d'hibernation pendant les lectures DB)
+            slot.idleSinceTick = m_tickCount;
+            onReady(true);
+            break;
+
+        case KingdomResidency::Hibernated:
+            slot.waiters.push_back(std::move(onReady));
+            WakeKingdom(slot);
+            break;
+
+        case KingdomResidency::Hibernating:
+        case KingdomResidency::Waking:
+        case KingdomResidency::Migrating:
+            slot.waiters.push_back(std::move(onReady));
+            break;
+    }
+}
+
+void GameLoop::WakeKingdom(KingdomSlot& slot)
+{
+    slot.residency = KingdomResidency::Waking;
+    LOG_INFO("Reveil du royaume {} '{}'", slot.info.id, slot.info.name);
+
+    // La carte passe par le cache du main thread, la construction et la lecture du snapshot non
+    auto map = LoadKingdomMap(slot.info);
+    m_snapshotIO->Enqueue([this, info = slot.info, map = std::move(map), path = GetSnapshotPath(slot.info.id)]() mutable
+    {
+        MMO::Time::Stopwatch loadTimer;
+        auto world = BuildKingdom(info, std::move(map));
+        if (!world->LoadSnapshot(path))
+        {
+            world.reset();
+        }
+        m_profiler.Record("snapshot.wake", loadTimer.ElapsedMilliseconds());
+
+        // std::function exige un callable copiable
+        auto holder = std::make_shared<std::unique_ptr<MMO::Core::KingdomWorld>>(std::move(world));
+        EnqueueMainThreadCallback([this, kingdomId = info.id, holder]()
+        {
+            OnKingdomWoken(kingdomId, std::move(*holder));
+        }, MMO::Core::CallbackPriority::Gameplay);
+    });
+}
+
+void GameLoop::OnKingdomWoken(int kingdomId, std::unique_ptr<MMO::Core::KingdomWorld> world)
+{
+    auto& slot = m_kingdomSlots[kingdomId];
+
+    // Snapshot illisible : jamais consomme ni remplace par un monde vide, la prochaine selection reessaie
+    if (!world)
+    {
+        LOG_ERROR("Royaume {} '{}' : reveil impossible, le snapshot reste sur disque", kingdomId, slot.info.name);
+        slot.residency = KingdomResidency::Hibernated;
+        NotifyKingdomWaiters(slot, false);
+        return;
+    }
+
+    ConsumeSnapshot(kingdomId);
+
+    auto& ref = AttachKingdom(std::move(world));
+    LOG_INFO("Royaume {} '{}' reveille", kingdomId, ref.GetName());
+
+    NotifyKingdomWaiters(m_kingdomSlots[kingdomId], true);
+}
+
+std::unordered_map<int, int> GameLoop::CountSessionsByKingdom() const
+{
+    std::unordered_map<int, int> counts;
+    for (const auto& [peerId, session] : m_networkManager->GetSessionManager().GetAllSessions())
+    {
+        if (session.kingdomId >= 0)
+        {
+            counts[session.kingdomId]++;
+        }
+    }
+    return counts;
+}
+
+void GameLoop::PublishShardLease()
+{
+    m_shardIO->Enqueue([shards = m_shards.get(), playerCounts = CountSessionsByKingdom()]()
+    {
+        shards->Heartbeat(playerCounts);
+    });
+}
+
+void GameLoop::HibernateIdleKingdoms()
+{
+    auto sessionCounts = CountSessionsByKingdom();
+
+    const uint64_t idleTicks = static_cast<uint64_t>(m_config.hibernateAfterSec) * m_config.tickRate;
+    std::vector<int> idleKingdoms;
+    for (auto& [id, slot] : m_kingdomSlots)
+    {
+        if (slot.residency != KingdomResidency::Resident)
+            continue;
+
+        // Bataille d'un joueur hors ligne en cours : le royaume n'est pas inactif
+        auto worldIt = m_kingdoms.find(id);
+        if (sessionCounts.contains(id) || (worldIt != m_kingdoms.end() && worldIt->second->HasOfflinePlayers()))
+        {
+            slot.idleSinceTick = m_tickCount;
+        }
+        else if (m_tickCount - slot.idleSinceTick >= idleTicks)
+        {
+            idleKingdoms.push_back(id);
+        }
+    }
+
+    for (int id : idleKingdoms)
+    {
+        HibernateKingdom(id);
+    }
+}
+
+void GameLoop::HibernateKingdom(int kingdomId)
+{
+    auto it = m_kingdoms.find(kingdomId);
+    if (it == m_kingdoms.end())
+        return;
+
+    // Aucune session : toutes les ressources sont deja en base, le snapshot est propre
+    auto buffer = std::make_shared<std::vector<uint8_t>>(it->second->CaptureSnapshot(true));
+
+    // Le monde sort du tick mais reste en memoire tant que le fichier n'est pas ecrit
+    auto& slot = m_kingdomSlots[kingdomId];
+    slot.parked = std::move(it->second);
+    slot.residency = KingdomResidency::Hibernating;
+    m_kingdoms.erase(it);
+
+    LOG_INFO("Hibernation du royaume {} '{}' ({} Ko)", kingdomId, slot.info.name, buffer->size() / 1024);
+
+    m_snapshotIO->Enqueue([this, kingdomId, path = GetSnapshotPath(kingdomId), buffer]()
+    {
+        bool isWritten = MMO::Core::WriteWorldSnapshot(path, *buffer);
+        EnqueueMainThreadCallback([this, kingdomId, isWritten]()
+        {
+            OnKingdomHibernated(kingdomId, isWritten);
+        }, MMO::Core::CallbackPriority::Background);
+    });
+}
+
+void GameLoop::OnKingdomHibernated(int kingdomId, bool isWritten)
+{
+    auto& slot = m_kingdomSlots[kingdomId];
+
+    // Ecriture ratee ou joueur arrive entre-temps : le monde garde en memoire redevient resident
+    if (!isWritten || !slot.waiters.empty())
+    {
+        if (isWritten)
+        {
+            ConsumeSnapshot(kingdomId);
+        }
+        else
+        {
+            LOG_WARN("Royaume {} : snapshot d'hibernation non ecrit, le royaume reste en memoire", kingdomId);
+        }
+
+        AttachKingdom(std::move(slot.parked));
+        NotifyKingdomWaiters(slot, true);
+        return;
+    }
+
+    slot.parked.reset();
+    slot.residency = KingdomResidency::Hibernated;
+    LOG_INFO("Royaume {} '{}' hiberne", kingdomId, slot.info.name);
+}
+
+void GameLoop::PrintKingdoms() const
+{
+    auto residencyName = [](KingdomResidency residency)
+    {
+        switch (residency)
+        {
+            case KingdomResidency::Resident: return "resident";
+            case KingdomResidency::Hibernating: return "hibernation";
+            case KingdomResidency::Hibernated: return "hiberne";
+            case KingdomResidency::Waking: return "reveil";
+            case KingdomResidency::Migrating: return "migration";
+        }
+        return "?";
+    };
+
+    for (const auto& info : m_kingdomCatalog)
+    {
+        auto slotIt = m_kingdomSlots.find(info.id);
+        if (slotIt == m_kingdomSlots.end())
+        {
+            auto owner = m_shards ? m_shards->FindOwner(info.id) : std::nullopt;
+            if (owner)
+            {
+                LOG_INFO("Royaume {} '{}' : distant, {}:{} ({} joueurs)",
+                    info.id, info.name, owner->endpoint.ip, owner->endpoint.port, owner->playerCount);
+            }
+            else
+            {
+                LOG_INFO("Royaume {} '{}' : distant, hors ligne", info.id, info.name);
+            }
+            continue;
+        }
+
+        const auto& slot = slotIt->second;
+        auto it = m_kingdoms.find(info.id);
+        size_t entityCount = it != m_kingdoms.end()
+            ? it->second->GetRegistry().view<MMO::ECS::PositionComponent>().size() : 0;
+
+        LOG_INFO("Royaume {} '{}' : {} ({} entites, {} en attente)",
+            info.id, info.name, residencyName(slot.residency), entityCount, slot.waiters.size());
+    }
+}
+
+void GameLoop::CreateMigrationManager()
+{
+    MMO::Core::MigrationContext context;
+    context.control = m_control.get();
+    context.shards = m_shards.get();
+    context.shardIO = m_shardIO.get();
+    context.sessionManager = &m_networkManager->GetSessionManager();
+    context.playerCommands = m_playerCommands.get();
+    context.profiler = &m_profiler;
+    context.catalog = &m_kingdomCatalog;
+    context.tickCount = &m_tickCount;
+    context.tickRate = m_config.tickRate;
+
+    context.requestKingdom = [this](int kingdomId, std::function<void(bool)> onReady)
+    {
+        RequestKingdom(kingdomId, std::move(onReady));
+    };
+
+    context.findKingdom = [this](int kingdomId) -> MMO::Core::KingdomWorld*
+    {
+        auto it = m_kingdoms.find(kingdomId);
+        return it != m_kingdoms.end() ? it->second.get() : nullptr;
+    };
+
+    // Le monde sort du tick : les paquets de ses joueurs passent par le DeferHandler jusqu'a la redirection
+    context.freezeKingdom = [this](int kingdomId) -> MMO::Core::KingdomWorld*
+    {
+        auto it = m_kingdoms.find(kingdomId);
+        if (it == m_kingdoms.end())
+            return nullptr;
+
+        auto& slot = m_kingdomSlots[kingdomId];
+        slot.parked = std::move(it->second);
+        slot.residency = KingdomResidency::Migrating;
+        m_kingdoms.erase(it);
+        return slot.parked.get();
+    };
+
+    context.findFrozenKingdom = [this](int kingdomId) -> MMO::Core::KingdomWorld*
+    {
+        auto it = m_kingdomSlots.find(kingdomId);
+        if (it == m_kingdomSlots.end() || it->second.residency != KingdomResidency::Migrating)
+            return nullptr;
+        return it->second.parked.get();
+    };
+
+    context.thawKingdom = [this](int kingdomId) -> MMO::Core::KingdomWorld&
+    {
+        return AttachKingdom(std::move(m_kingdomSlots[kingdomId].parked));
+    };
+
+    context.notifyWaiters = [this](int kingdomId, bool isReady)
+    {
+        NotifyKingdomWaiters(m_kingdomSlots[kingdomId], isReady);
+    };
+
+    context.releaseKingdom = [this](int kingdomId)
+    {
+        auto slotIt = m_kingdomSlots.find(kingdomId);
+        NotifyKingdomWaiters(slotIt->second, false);
+        m_kingdomSlots.erase(slotIt);
+
+        // Un redemarrage ne doit pas recharger l'ancien etat : consomme apres toute ecriture deja en file
+        if (m_snapshotIO)
+        {
+            m_snapshotIO->Enqueue([this, kingdomId]()
+            {
+                ConsumeSnapshot(kingdomId);
+            });
+        }
+    };
+
+    context.adoptKingdom = [this](std::unique_ptr<MMO::Core::KingdomWorld> world) -> MMO::Core::KingdomWorld&
+    {
+        const int kingdomId = world->GetId();
+        auto it = std::find_if(m_kingdomCatalog.begin(), m_kingdomCatalog.end(),
+            [kingdomId](const MMO::Core::KingdomInfo& info) { return info.id == kingdomId; });
+        m_kingdomSlots[kingdomId].info = *it;
+        return AttachKingdom(std::move(world));
+    };
+
+    context.loadMap = [this](const MMO::Core::KingdomInfo& info)
+    {
+        return LoadKingdomMap(info);
+    };
+    context.buildKingdom = &GameLoop::BuildKingdom;
+
+    context.persistPlayer = [this](entt::registry& registry, entt::entity entity, int kingdomId)
+    {
+        PersistResources(registry, entity, kingdomId);
+    };
+
+    context.removePlayer = [this](MMO::Core::KingdomWorld& world, entt::entity entity)
+    {
+        RemovePlayerEntity(world, entity);
+    };
+
+    context.publishLease = [this]() { PublishShardLease(); };
+    context.runOnMainThread = [this](std::function<void()> callback, MMO::Core::CallbackPriority priority)
+    {
+        EnqueueMainThreadCallback(std::move(callback), priority);
+    };
+
+    m_migrations = std::make_unique<MMO::Core::MigrationManager>(std::move(context));
+    m_migrations->RegisterHandlers();
+}
+
+void GameLoop::ProcessNetworkOut()
+{
+    // Replication AOI : un lot par joueur (entrees, sorties, mouvements visibles)
+    if (m_networkManager)
+    {
+        m_replication.Replicate(m_networkManager->GetSessionManager(), m_kingdoms);
+    }
+}
\ No newline at end of file
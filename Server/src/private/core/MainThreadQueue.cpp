@@ -0,0 +1,113 @@
+#include "core/MainThreadQueue.h"
+#include "utils/Logger.h"
+#include "utils/Time.h"
+
+
+namespace MMO::Core
+{
+    static constexpr const char* PRIORITY_NAMES[] = { "gameplay", "session", "background" };
+
+    void MainThreadQueue::Push(Callback callback, CallbackPriority priority)
+    {
+        if (!callback)
+            return;
+
+        std::scoped_lock lock(m_mutex);
+        m_queues[static_cast<size_t>(priority)].push_back(std::move(callback));
+    }
+
+    MainThreadQueue::Callback MainThreadQueue::TryPop(size_t priorityIndex)
+    {
+        std::scoped_lock lock(m_mutex);
+
+        auto& queue = m_queues[priorityIndex];
+        if (queue.empty())
+            return nullptr;
+
+        Callback callback = std::move(queue.front());
+        queue.pop_front();
+        return callback;
+    }
+
+    size_t MainThreadQueue::Drain(float budgetMs)
+    {
+        MMO::Time::Stopwatch budgetTimer;
+        std::array<uint64_t, PRIORITY_COUNT> executed{};
+        size_t total = 0;
+
+        for (size_t p = 0; p < PRIORITY_COUNT; ++p)
+        {
+            // Le premier callback de chaque classe passe meme si le budget est deja consomme
+            bool isFirst = true;
+            while (isFirst || budgetTimer.ElapsedMilliseconds() < budgetMs)
+            {
+                Callback callback = TryPop(p);
+                if (!callback)
+                    break;
+
+                callback();
+                isFirst = false;
+                executed[p]++;
+                total++;
+            }
+        }
+
+        std::scoped_lock lock(m_mutex);
+
+        size_t remaining = 0;
+        for (size_t p = 0; p < PRIORITY_COUNT; ++p)
+        {
+            m_executed[p] += executed[p];
+            remaining += m_queues[p].size();
+        }
+
+        m_lastCarryOver = remaining;
+        if (remaining > 0)
+        {
+            m_carryOverTicks++;
+            m_totalCarriedOver += remaining;
+        }
+
+        return total;
+    }
+
+    size_t MainThreadQueue::GetDepth() const
+    {
+        std::scoped_lock lock(m_mutex);
+
+        size_t depth = 0;
+        for (const auto& queue : m_queues)
+            depth += queue.size();
+        return depth;
+    }
+
+    MainThreadQueue::Stats MainThreadQueue::GetStats() const
+    {
+        std::scoped_lock lock(m_mutex);
+
+        Stats stats;
+        for (size_t p = 0; p < PRIORITY_COUNT; ++p)
+        {
+            stats.depth[p] = m_queues[p].size();
+            stats.executed[p] = m_executed[p];
+        }
+        stats.lastCarryOver = m_lastCarryOver;
+        stats.carryOverTicks = m_carryOverTicks;
+        stats.totalCarriedOver = m_totalCarriedOver;
+        return stats;
+    }
+
+    void MainThreadQueue::PrintStats() const
+    {
+        Stats stats = GetStats();
+
+        LOG_INFO("=== Callbacks main thread ===");
+        for (size_t p = 0; p < PRIORITY_COUNT; ++p)
+        {
+            LOG_INFO("  {:<14} en attente={:<6} executes={}", PRIORITY_NAMES[p], stats.depth[p], stats.executed[p]);
+        }
+        LOG_INFO("  Reportes au dernier tick: {} | Ticks avec report: {} | Total reporte: {}",
+            stats.lastCarryOver, stats.carryOverTicks, stats.totalCarriedOver);
+        LOG_INFO("=============================");
+    }
+}
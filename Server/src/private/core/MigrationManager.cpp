@@ -0,0 +1,828 @@
+#include "core/MigrationManager.h"
+#include "network/handlers/KingdomSelectHandler.h"
+#include "Migration_generated.h"
+#include "ecs/PlayerComponents.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <unordered_set>
+
+
+namespace MMO::Core
+{
+    namespace
+    {
+        // Morceaux du snapshot sur le canal de controle, et delai total (connexion, transfert, chargement)
+        constexpr size_t MIGRATION_CHUNK_SIZE = 256 * 1024;
+        constexpr uint64_t MIGRATION_TIMEOUT_SEC = 30;
+
+        // Plus gros snapshot accepte par la cible : la taille annoncee par la source n'est jamais reservee au-dela
+        constexpr uint64_t MAX_MIGRATION_SNAPSHOT_BYTES = 64ull * 1024 * 1024;
+
+        // Paquets de gameplay gardes pendant le gel (au-dela ils sont ignores) : un commit tient dans un paquet de controle
+        constexpr size_t MAX_FROZEN_COMMANDS = 4096;
+        constexpr size_t MAX_FROZEN_COMMAND_BYTES = 1024 * 1024;
+
+        // Payload d'un message de controle, verifie avant lecture (comme l'Envelope dans Dispatch)
+        template<typename T>
+        const T* ReadPayload(const flatbuffers::Vector<uint8_t>* payload)
+        {
+            if (!payload)
+                return nullptr;
+
+            flatbuffers::Verifier verifier(payload->data(), payload->size());
+            if (!verifier.VerifyBuffer<T>(nullptr))
+                return nullptr;
+
+            return flatbuffers::GetRoot<T>(payload->data());
+        }
+
+        // Handler de controle qui ne recoit que des messages verifies
+        template<typename T, typename Handler>
+        Network::ControlHost::MessageHandler Verified(const char* name, Handler handler)
+        {
+            return [name, handler = std::move(handler)](Network::ControlLinkId link, const flatbuffers::Vector<uint8_t>* payload)
+            {
+                const T* message = ReadPayload<T>(payload);
+                if (!message)
+                {
+                    LOG_WARN("Canal de controle : {} invalide ignore (lien {})", name, link);
+                    return;
+                }
+                handler(link, *message);
+            };
+        }
+    }
+
+    MigrationManager::MigrationManager(MigrationContext context)
+        : m_context(std::move(context))
+    {
+    }
+
+    void MigrationManager::RegisterHandlers()
+    {
+        auto& control = *m_context.control;
+        control.RegisterHandler(Network::Opcode_S2S_MigrationChunk, Verified<Network::MigrationChunk>("MigrationChunk",
+            [this](Network::ControlLinkId link, const Network::MigrationChunk& chunk)
+            {
+                OnMigrationChunk(link, chunk);
+            }));
+
+        control.RegisterHandler(Network::Opcode_S2S_MigrationResult, Verified<Network::MigrationResult>("MigrationResult",
+            [this](Network::ControlLinkId link, const Network::MigrationResult& result)
+            {
+                OnMigrationResult(link, result);
+            }));
+
+        control.RegisterHandler(Network::Opcode_S2S_MigrationCommit, Verified<Network::MigrationCommit>("MigrationCommit",
+            [this](Network::ControlLinkId link, const Network::MigrationCommit& commit)
+            {
+                OnMigrationCommit(link, commit);
+            }));
+
+        control.RegisterHandler(Network::Opcode_S2S_MigrationCommitted, Verified<Network::MigrationCommitted>("MigrationCommitted",
+            [this](Network::ControlLinkId link, const Network::MigrationCommitted& committed)
+            {
+                OnMigrationCommitted(link, committed);
+            }));
+
+        control.SetLinkCallback([this](Network::ControlLinkId link, bool isConnected, const Network::ControlAddress& remote)
+        {
+            OnControlLink(link, isConnected, remote);
+        });
+    }
+
+    const KingdomInfo* MigrationManager::FindCatalogEntry(int kingdomId) const
+    {
+        const auto& catalog = *m_context.catalog;
+        auto it = std::find_if(catalog.begin(), catalog.end(),
+            [kingdomId](const KingdomInfo& info) { return info.id == kingdomId; });
+        return it != catalog.end() ? &*it : nullptr;
+    }
+
+    uint64_t MigrationManager::GetDeadlineTick() const
+    {
+        return *m_context.tickCount + MIGRATION_TIMEOUT_SEC * static_cast<uint64_t>(m_context.tickRate);
+    }
+
+    void MigrationManager::OnControlLink(Network::ControlLinkId link, bool isConnected, const Network::ControlAddress& remote)
+    {
+        // Processus distant du lien : seul le proprietaire d'un royaume peut le transferer
+        if (isConnected)
+        {
+            auto shard = m_context.shards->FindShardByControlAddress(ShardEndpoint{ remote.ip, remote.port });
+            if (!shard)
+            {
+                LOG_WARN("Lien de controle {}:{} sans bail frais, ferme", remote.ip, remote.port);
+                m_context.control->Disconnect(link);
+                return;
+            }
+            m_controlPeers[link] = *shard;
+        }
+        else
+        {
+            m_controlPeers.erase(link);
+        }
+
+        std::vector<int> kingdomIds;
+        for (const auto& [id, migration] : m_outgoing)
+        {
+            if (migration.link == link)
+            {
+                kingdomIds.push_back(id);
+            }
+        }
+
+        if (isConnected)
+        {
+            // Cible joignable : le gel commence des que le royaume est resident (reveil s'il hiberne)
+            for (int id : kingdomIds)
+            {
+                // Reconnexion apres un commit sans reponse : seul le commit est rejoue
+                if (m_outgoing[id].isCommitSent)
+                {
+                    SendMigrationCommit(id);
+                    continue;
+                }
+
+                FreezeWhenResident(id);
+            }
+            return;
+        }
+
+        // Connexion refusee ou perdue : la source reprend ses royaumes, la cible abandonne les transferts entrants
+        // (mondes prepares compris). Apres l'envoi du commit, la source ne sait pas s'il a ete applique :
+        // elle garde le royaume gele et redemande au prochain controle
+        for (int id : kingdomIds)
+        {
+            auto& migration = m_outgoing[id];
+            if (migration.isCommitSent)
+            {
+                migration.link = Network::INVALID_CONTROL_LINK;
+                continue;
+            }
+
+            AbortMigration(id, "lien de controle perdu");
+        }
+
+        std::erase_if(m_incoming, [link](const auto& entry)
+        {
+            if (entry.second.link != link)
+                return false;
+
+            LOG_WARN("Migration entrante du royaume {} abandonnee (lien de controle perdu avant le commit)", entry.first);
+            return true;
+        });
+    }
+
+    void MigrationManager::Start(int kingdomId, const ShardEndpoint& target)
+    {
+        const KingdomInfo* info = FindCatalogEntry(kingdomId);
+        if (!info || !m_context.shards->IsLocal(kingdomId))
+        {
+            LOG_WARN("migrate: royaume {} non heberge par ce processus", kingdomId);
+            return;
+        }
+
+        if (m_outgoing.contains(kingdomId))
+        {
+            LOG_WARN("migrate: migration du royaume {} deja en cours", kingdomId);
+            return;
+        }
+
+        if (target == m_context.shards->GetSelf())
+        {
+            LOG_WARN("migrate: {}:{} est ce processus", target.ip, target.port);
+            return;
+        }
+
+        // Seul un processus vivant (bail frais) peut recevoir le royaume
+        auto control = m_context.shards->FindControlAddress(target);
+        if (!control)
+        {
+            LOG_WARN("migrate: aucun processus vivant avec un canal de controle a {}:{}", target.ip, target.port);
+            return;
+        }
+
+        auto& migration = m_outgoing[kingdomId];
+        migration.target = target;
+        migration.link = m_context.control->Connect(control->ip, control->port);
+        migration.deadlineTick = GetDeadlineTick();
+
+        LOG_INFO("Migration du royaume {} '{}' vers {}:{} (controle {}:{})",
+            kingdomId, info->name, target.ip, target.port, control->ip, control->port);
+    }
+
+    void MigrationManager::FreezeWhenResident(int kingdomId)
+    {
+        Network::ControlLinkId link = m_outgoing[kingdomId].link;
+        m_context.requestKingdom(kingdomId, [this, kingdomId, link](bool isReady)
+        {
+            // Migration annulee (ou relancee) pendant le reveil
+            auto it = m_outgoing.find(kingdomId);
+            if (it == m_outgoing.end() || it->second.link != link || it->second.isFrozen)
+                return;
+
+            if (isReady)
+            {
+                SendKingdomSnapshot(kingdomId);
+            }
+            else
+            {
+                AbortMigration(kingdomId, "royaume indisponible");
+            }
+        });
+    }
+
+    void MigrationManager::SendKingdomSnapshot(int kingdomId)
+    {
+        auto& migration = m_outgoing[kingdomId];
+
+        // Batailles en cours : ni serialisees ni interrompues, le gel attend leur fin (nouvel essai chaque seconde)
+        KingdomWorld* resident = m_context.findKingdom(kingdomId);
+        if (resident && resident->HasActiveBattles())
+        {
+            if (!migration.isWaitingForBattles)
+            {
+                LOG_INFO("Migration du royaume {} : batailles en cours, gel differe", kingdomId);
+            }
+            migration.isWaitingForBattles = true;
+            return;
+        }
+        migration.isWaitingForBattles = false;
+
+        // Le monde sort du tick : les paquets de ses joueurs sont mis de cote jusqu'a la redirection
+        KingdomWorld* world = m_context.freezeKingdom(kingdomId);
+        if (!world)
+        {
+            AbortMigration(kingdomId, "royaume non resident");
+            return;
+        }
+        migration.freezeTimer.Reset();
+        migration.isFrozen = true;
+
+        // Ressources des joueurs en base au gel : DB et snapshot concordent, que la migration aboutisse ou non
+        auto& registry = world->GetRegistry();
+        for (const auto& [peerId, session] : m_context.sessionManager->GetAllSessions())
+        {
+            if (session.kingdomId == kingdomId && registry.valid(session.entityID))
+            {
+                m_context.persistPlayer(registry, session.entityID, kingdomId);
+                migration.onlineEntities.push_back(session.entityID);
+            }
+        }
+
+        // Aucune ecriture DB ne suit le gel : snapshot propre, les joueurs y sont repris par la cible
+        std::vector<uint8_t> snapshot = world->CaptureSnapshot(true);
+        migration.snapshotBytes = snapshot.size();
+
+        const uint32_t chunkCount = static_cast<uint32_t>((snapshot.size() + MIGRATION_CHUNK_SIZE - 1) / MIGRATION_CHUNK_SIZE);
+        for (uint32_t index = 0; index < chunkCount; ++index)
+        {
+            const size_t offset = static_cast<size_t>(index) * MIGRATION_CHUNK_SIZE;
+            const size_t size = std::min(MIGRATION_CHUNK_SIZE, snapshot.size() - offset);
+            m_context.control->Send(migration.link, Network::Opcode_S2S_MigrationChunk,
+                [&](flatbuffers::FlatBufferBuilder& fbb)
+                {
+                    auto data = fbb.CreateVector(snapshot.data() + offset, size);
+                    Network::MigrationChunkBuilder chunk(fbb);
+                    chunk.add_kingdom_id(kingdomId);
+                    chunk.add_index(index);
+                    chunk.add_chunk_count(chunkCount);
+                    chunk.add_snapshot_size(snapshot.size());
+                    chunk.add_data(data);
+                    fbb.Finish(chunk.Finish());
+                });
+        }
+
+        LOG_INFO("Royaume {} gele : snapshot de {} Ko envoye en {} morceau(x), {} joueur(s) en attente de redirection",
+            kingdomId, snapshot.size() / 1024, chunkCount, migration.onlineEntities.size());
+    }
+
+    void MigrationManager::OnMigrationResult(Network::ControlLinkId link, const Network::MigrationResult& result)
+    {
+        int kingdomId = result.kingdom_id();
+        auto it = m_outgoing.find(kingdomId);
+        if (it == m_outgoing.end() || it->second.link != link || !it->second.isFrozen || it->second.isCommitSent)
+            return;
+
+        if (!result.success())
+        {
+            AbortMigration(kingdomId, result.message() ? result.message()->str() : "refus de la cible");
+            return;
+        }
+
+        // Monde pret chez la cible : a partir d'ici, seule sa reponse au commit tranche
+        it->second.isCommitSent = true;
+        it->second.deadlineTick = GetDeadlineTick();
+        SendMigrationCommit(kingdomId);
+    }
+
+    void MigrationManager::DeferPlayerCommand(const Network::PlayerSession& session, Network::Opcode opcode,
+        std::span<const uint8_t> payload)
+    {
+        // Seul un royaume gele par une migration garde les paquets (hibernation : aucun joueur dedans)
+        auto it = m_outgoing.find(session.kingdomId);
+        KingdomWorld* world = it != m_outgoing.end() && it->second.isFrozen ? m_context.findFrozenKingdom(session.kingdomId) : nullptr;
+        if (!world)
+            return;
+
+        auto& migration = it->second;
+        if (migration.commands.size() >= MAX_FROZEN_COMMANDS || migration.commandBytes + payload.size() > MAX_FROZEN_COMMAND_BYTES)
+        {
+            LOG_WARN("Royaume {} gele : paquet du joueur {} ignore (file des commandes pleine)", session.kingdomId, session.playerID);
+            return;
+        }
+
+        // Le compte identifie le joueur chez la cible : l'entite y est la meme, son proprietaire est verifie
+        const auto& registry = world->GetRegistry();
+        const auto* info = registry.valid(session.entityID) ? registry.try_get<ECS::PlayerInfoComponent>(session.entityID) : nullptr;
+        if (!info)
+            return;
+
+        migration.commands.push_back(FrozenCommand{ info->accountID, session.entityID, opcode,
+            std::vector<uint8_t>(payload.begin(), payload.end()) });
+        migration.commandBytes += payload.size();
+    }
+
+    void MigrationManager::SendMigrationCommit(int kingdomId)
+    {
+        // Toutes les commandes que la cible n'a pas confirmees : un commit rejoue renvoie aussi les siennes
+        const auto& migration = m_outgoing[kingdomId];
+        m_context.control->Send(migration.link, Network::Opcode_S2S_MigrationCommit,
+            [&](flatbuffers::FlatBufferBuilder& fbb)
+            {
+                std::vector<flatbuffers::Offset<Network::MigrationCommand>> commands;
+                commands.reserve(migration.commands.size() - migration.appliedCommands);
+                for (size_t i = migration.appliedCommands; i < migration.commands.size(); ++i)
+                {
+                    const FrozenCommand& frozen = migration.commands[i];
+                    auto payload = fbb.CreateVector(frozen.payload.data(), frozen.payload.size());
+                    Network::MigrationCommandBuilder command(fbb);
+                    command.add_account_id(frozen.accountId);
+                    command.add_entity(static_cast<uint32_t>(frozen.entity));
+                    command.add_opcode(frozen.opcode);
+                    command.add_payload(payload);
+                    commands.push_back(command.Finish());
+                }
+                auto commandVector = fbb.CreateVector(commands);
+
+                Network::MigrationCommitBuilder commit(fbb);
+                commit.add_kingdom_id(kingdomId);
+                commit.add_first_command(migration.appliedCommands);
+                commit.add_commands(commandVector);
+                fbb.Finish(commit.Finish());
+            });
+    }
+
+    void MigrationManager::OnMigrationCommitted(Network::ControlLinkId link, const Network::MigrationCommitted& committed)
+    {
+        int kingdomId = committed.kingdom_id();
+        auto it = m_outgoing.find(kingdomId);
+        if (it == m_outgoing.end() || it->second.link != link || !it->second.isCommitSent)
+            return;
+
+        // Refus : la cible n'a pas (ou plus) le monde prepare, le royaume reste ici sans risque de doublon
+        if (!committed.success())
+        {
+            AbortMigration(kingdomId, "commit refuse par la cible");
+            return;
+        }
+
+        // Paquets arrives apres l'envoi du commit : un commit de plus, les joueurs restent geles jusqu'a leur application
+        auto& migration = it->second;
+        migration.appliedCommands = std::min(committed.applied_commands(), static_cast<uint32_t>(migration.commands.size()));
+        if (migration.appliedCommands < migration.commands.size())
+        {
+            SendMigrationCommit(kingdomId);
+            return;
+        }
+
+        CompleteMigration(kingdomId);
+    }
+
+    void MigrationManager::RetryMigrationCommit(int kingdomId)
+    {
+        auto& migration = m_outgoing[kingdomId];
+
+        // Bail de la cible expire : elle ne revendique plus le royaume, il est repris ici
+        // (une cible vivante mais muette sur son bail le garderait aussi : signale par ShardDirectory)
+        auto control = m_context.shards->FindControlAddress(migration.target);
+        if (!control)
+        {
+            AbortMigration(kingdomId, "cible hors ligne avant la confirmation du commit");
+            return;
+        }
+
+        if (migration.link != Network::INVALID_CONTROL_LINK)
+        {
+            m_context.control->Disconnect(migration.link);
+        }
+        migration.link = m_context.control->Connect(control->ip, control->port);
+        migration.deadlineTick = GetDeadlineTick();
+
+        LOG_WARN("Migration du royaume {} : commit sans reponse, nouvel essai vers {}:{}",
+            kingdomId, migration.target.ip, migration.target.port);
+    }
+
+    void MigrationManager::CompleteMigration(int kingdomId)
+    {
+        OutgoingMigration migration = std::move(m_outgoing[kingdomId]);
+        m_outgoing.erase(kingdomId);
+        m_received.erase(kingdomId);
+        m_context.control->Disconnect(migration.link);
+
+        // Le monde gele est libere ; une entree en attente repassera par SelectKingdom (redirection)
+        const std::string name = FindCatalogEntry(kingdomId)->name;
+        m_context.releaseKingdom(kingdomId);
+
+        // Le royaume est redirige vers la cible avant meme que son bail ne le revendique
+        m_context.shards->RemoveLocalKingdom(kingdomId, migration.target);
+        m_context.publishLease();
+
+        // Joueurs connectes : ils quittent le royaume ici et se reconnectent a la cible
+        auto& sessionManager = *m_context.sessionManager;
+        std::vector<ENetPeer*> peers;
+        for (const auto& [peerId, session] : sessionManager.GetAllSessions())
+        {
+            if (session.kingdomId == kingdomId)
+            {
+                peers.push_back(session.peer);
+            }
+        }
+
+        for (ENetPeer* peer : peers)
+        {
+            Network::SendKingdomRedirect(peer, kingdomId, migration.target);
+            sessionManager.OnLeaveKingdom(peer);
+        }
+
+        float freezeMs = migration.freezeTimer.ElapsedMilliseconds();
+        m_context.profiler->Record("migration.freeze", freezeMs);
+        LOG_INFO("Royaume {} '{}' migre vers {}:{} (gel {:.0f} ms, {} Ko, {} joueur(s) rediriges)",
+            kingdomId, name, migration.target.ip, migration.target.port, freezeMs,
+            migration.snapshotBytes / 1024, peers.size());
+    }
+
+    void MigrationManager::AbortMigration(int kingdomId, const std::string& reason)
+    {
+        auto it = m_outgoing.find(kingdomId);
+        if (it == m_outgoing.end())
+            return;
+
+        OutgoingMigration migration = std::move(it->second);
+        m_outgoing.erase(it);
+
+        // La cible abandonne un transfert a la deconnexion du lien
+        m_context.control->Disconnect(migration.link);
+        LOG_WARN("Migration du royaume {} annulee ({}) : le royaume reste ici", kingdomId, reason);
+
+        if (!migration.isFrozen || !m_context.findFrozenKingdom(kingdomId))
+            return;
+
+        auto& world = m_context.thawKingdom(kingdomId);
+        auto& sessionManager = *m_context.sessionManager;
+
+        // Joueur deconnecte pendant le gel : son entite n'a pas ete retiree (royaume hors du tick)
+        std::unordered_set<entt::entity> onlineEntities;
+        for (const auto& [peerId, session] : sessionManager.GetAllSessions())
+        {
+            if (session.kingdomId == kingdomId)
+            {
+                onlineEntities.insert(session.entityID);
+            }
+        }
+
+        // Paquets recus pendant le gel, dans l'ordre, avant le retrait des joueurs partis : rien n'est perdu
+        for (const FrozenCommand& frozen : migration.commands)
+        {
+            ENetPeer* peer = nullptr;
+            PlayerID playerID = INVALID_PLAYER;
+            for (const auto& [peerId, session] : sessionManager.GetAllSessions())
+            {
+                if (session.kingdomId == kingdomId && session.entityID == frozen.entity)
+                {
+                    peer = session.peer;
+                    playerID = session.playerID;
+                    break;
+                }
+            }
+
+            m_context.playerCommands->Apply(frozen.opcode, Network::PlayerCommand{ peer, &world, frozen.entity, kingdomId, playerID },
+                frozen.payload);
+        }
+
+        auto& registry = world.GetRegistry();
+        for (entt::entity entity : migration.onlineEntities)
+        {
+            if (!onlineEntities.contains(entity) && registry.valid(entity))
+            {
+                m_context.removePlayer(world, entity);
+            }
+        }
+
+        m_context.notifyWaiters(kingdomId, true);
+    }
+
+    void MigrationManager::CheckTimeouts()
+    {
+        const uint64_t tick = *m_context.tickCount;
+
+        // Avant le commit, la source peut annuler : la cible abandonne le monde prepare avec le lien
+        // Apres, elle redemande l'issue jusqu'a une reponse (ou la disparition de la cible)
+        std::vector<int> expired;
+        std::vector<int> inDoubt;
+        std::vector<int> waiting;
+        for (const auto& [id, migration] : m_outgoing)
+        {
+            if (migration.isCommitSent)
+            {
+                if (migration.link == Network::INVALID_CONTROL_LINK || tick >= migration.deadlineTick)
+                    inDoubt.push_back(id);
+            }
+            else if (tick >= migration.deadlineTick)
+            {
+                expired.push_back(id);
+            }
+            else if (migration.isWaitingForBattles)
+            {
+                waiting.push_back(id);
+            }
+        }
+
+        for (int id : expired)
+        {
+            AbortMigration(id, m_outgoing[id].isWaitingForBattles ? "batailles toujours en cours" : "delai depasse");
+        }
+        for (int id : inDoubt)
+        {
+            RetryMigrationCommit(id);
+        }
+        for (int id : waiting)
+        {
+            FreezeWhenResident(id);
+        }
+
+        // Monde prepare sans commit : la source a abandonne sans que le lien tombe
+        std::erase_if(m_incoming, [this, tick](const auto& entry)
+        {
+            if (tick < entry.second.deadlineTick)
+                return false;
+
+            LOG_WARN("Migration entrante du royaume {} abandonnee (delai depasse)", entry.first);
+            m_context.control->Disconnect(entry.second.link);
+            return true;
+        });
+    }
+
+    std::vector<int> MigrationManager::Shutdown()
+    {
+        std::vector<int> pending;
+        std::vector<int> inDoubt;
+        for (const auto& [id, migration] : m_outgoing)
+        {
+            (migration.isCommitSent ? inDoubt : pending).push_back(id);
+        }
+
+        // Sans commit, la cible abandonne le monde prepare : le royaume revient ici et fait partie du snapshot d'arret
+        for (int id : pending)
+        {
+            AbortMigration(id, "arret du serveur");
+        }
+
+        for (int id : inDoubt)
+        {
+            LOG_WARN("Arret pendant la migration du royaume {} : commit sans reponse, issue tranchee au prochain demarrage", id);
+        }
+        return inDoubt;
+    }
+
+    void MigrationManager::OnMigrationChunk(Network::ControlLinkId link, const Network::MigrationChunk& chunk)
+    {
+        if (!chunk.data())
+            return;
+
+        int kingdomId = chunk.kingdom_id();
+        if (chunk.index() == 0)
+        {
+            // Premier morceau : la cible accepte le royaume ou refuse tout de suite
+            // Le lien doit venir du processus dont le bail revendique le royaume : un autre ne peut pas le ceder
+            auto peerIt = m_controlPeers.find(link);
+            auto owner = m_context.shards->FindOwner(kingdomId);
+
+            std::string error;
+            if (!FindCatalogEntry(kingdomId))
+                error = "royaume absent du kingdoms.json de la cible";
+            else if (m_context.shards->IsLocal(kingdomId) || m_incoming.contains(kingdomId))
+                error = "royaume deja heberge par la cible";
+            else if (peerIt == m_controlPeers.end() || !owner || owner->endpoint != peerIt->second)
+                error = "la source ne possede pas le royaume";
+            else if (chunk.snapshot_size() == 0 || chunk.snapshot_size() > MAX_MIGRATION_SNAPSHOT_BYTES)
+                error = "taille de snapshot refusee";
+            else if (chunk.chunk_count() != (chunk.snapshot_size() + MIGRATION_CHUNK_SIZE - 1) / MIGRATION_CHUNK_SIZE)
+                error = "annonce de transfert invalide";
+
+            if (!error.empty())
+            {
+                LOG_WARN("Migration entrante du royaume {} refusee ({})", kingdomId, error);
+                SendMigrationResult(link, kingdomId, false, error);
+                return;
+            }
+
+            auto& incoming = m_incoming[kingdomId];
+            incoming.link = link;
+            incoming.source = peerIt->second;
+            incoming.deadlineTick = GetDeadlineTick();
+            incoming.snapshotSize = chunk.snapshot_size();
+            incoming.chunkCount = chunk.chunk_count();
+            incoming.buffer.reserve(static_cast<size_t>(incoming.snapshotSize));
+            LOG_INFO("Migration entrante du royaume {} ({} Ko)", kingdomId, incoming.snapshotSize / 1024);
+        }
+
+        // Transfert refuse, ou abandonne par une deconnexion
+        auto it = m_incoming.find(kingdomId);
+        if (it == m_incoming.end() || it->second.link != link)
+            return;
+
+        auto& incoming = it->second;
+        const auto* data = chunk.data();
+        if (chunk.index() != incoming.nextChunk || incoming.buffer.size() + data->size() > incoming.snapshotSize)
+        {
+            m_incoming.erase(it);
+            SendMigrationResult(link, kingdomId, false, "morceau de snapshot inattendu");
+            return;
+        }
+
+        incoming.buffer.insert(incoming.buffer.end(), data->data(), data->data() + data->size());
+        if (++incoming.nextChunk < incoming.chunkCount)
+            return;
+
+        if (incoming.buffer.size() != incoming.snapshotSize)
+        {
+            m_incoming.erase(it);
+            SendMigrationResult(link, kingdomId, false, "snapshot incomplet");
+            return;
+        }
+
+        LoadMigratedKingdom(kingdomId);
+    }
+
+    void MigrationManager::LoadMigratedKingdom(int kingdomId)
+    {
+        // Meme chemin que le reveil : carte via le cache du main thread, construction et chargement hors du tick
+        const KingdomInfo& info = *FindCatalogEntry(kingdomId);
+        auto map = m_context.loadMap(info);
+        auto buffer = std::make_shared<std::vector<uint8_t>>(std::move(m_incoming[kingdomId].buffer));
+
+        m_context.shardIO->Enqueue([this, info, map = std::move(map), buffer]() mutable
+        {
+            Time::Stopwatch loadTimer;
+            auto world = m_context.buildKingdom(info, std::move(map));
+            if (!world->LoadSnapshot(std::span<const uint8_t>(*buffer), "migration"))
+            {
+                world.reset();
+            }
+            m_context.profiler->Record("migration.load", loadTimer.ElapsedMilliseconds());
+
+            // std::function exige un callable copiable
+            auto holder = std::make_shared<std::unique_ptr<KingdomWorld>>(std::move(world));
+            m_context.runOnMainThread([this, kingdomId = info.id, holder]()
+            {
+                OnMigrationLoaded(kingdomId, std::move(*holder));
+            }, CallbackPriority::Gameplay);
+        });
+    }
+
+    void MigrationManager::OnMigrationLoaded(int kingdomId, std::unique_ptr<KingdomWorld> world)
+    {
+        // Source deconnectee pendant le chargement : elle a repris le royaume
+        auto it = m_incoming.find(kingdomId);
+        if (it == m_incoming.end())
+        {
+            LOG_WARN("Migration du royaume {} abandonnee par la source, monde charge ignore", kingdomId);
+            return;
+        }
+
+        Network::ControlLinkId link = it->second.link;
+        if (!world)
+        {
+            m_incoming.erase(it);
+            SendMigrationResult(link, kingdomId, false, "snapshot illisible par la cible");
+            return;
+        }
+
+        // Pret, mais gare : ni tick ni revendication avant le commit de la source
+        it->second.world = std::move(world);
+        SendMigrationResult(link, kingdomId, true, "");
+        LOG_INFO("Royaume {} charge, en attente du commit de la source", kingdomId);
+    }
+
+    void MigrationManager::SendMigrationResult(Network::ControlLinkId link, int kingdomId, bool isSuccess, const std::string& message)
+    {
+        m_context.control->Send(link, Network::Opcode_S2S_MigrationResult, [&](flatbuffers::FlatBufferBuilder& fbb)
+        {
+            auto text = fbb.CreateString(message);
+            Network::MigrationResultBuilder result(fbb);
+            result.add_kingdom_id(kingdomId);
+            result.add_success(isSuccess);
+            result.add_message(text);
+            fbb.Finish(result.Finish());
+        });
+    }
+
+    void MigrationManager::OnMigrationCommit(Network::ControlLinkId link, const Network::MigrationCommit& commit)
+    {
+        int kingdomId = commit.kingdom_id();
+        auto it = m_incoming.find(kingdomId);
+        if (it != m_incoming.end() && it->second.link == link && it->second.world)
+        {
+            // Actions des joueurs pendant le gel, appliquees avant que le monde ne reprenne le tick ici
+            auto& received = m_received[kingdomId];
+            received.source = it->second.source;
+            received.appliedCommands = 0;
+            ApplyMigratedCommands(*it->second.world, kingdomId, commit, received.appliedCommands);
+
+            auto& world = m_context.adoptKingdom(std::move(it->second.world));
+            m_incoming.erase(it);
+
+            // Revendique avant la reponse : les clients rediriges sont acceptes des leur arrivee
+            m_context.shards->AddLocalKingdom(kingdomId);
+            m_context.publishLease();
+            LOG_INFO("Royaume {} '{}' recu par migration ({} commande(s) du gel appliquee(s))",
+                kingdomId, world.GetName(), received.appliedCommands);
+
+            // Proprietaire enregistre avant la reponse : la source ne rend la main qu'une fois le transfert durable,
+            // et un redemarrage de l'un ou l'autre processus garde le royaume ici
+            m_context.shardIO->Enqueue([this, link, kingdomId, applied = received.appliedCommands]()
+            {
+                m_context.shards->RecordOwner(kingdomId, m_context.shards->GetSelf());
+                m_context.runOnMainThread([this, link, kingdomId, applied]()
+                {
+                    SendMigrationCommitted(link, kingdomId, true, applied);
+                }, CallbackPriority::Gameplay);
+            });
+            return;
+        }
+
+        // Commit rejoue apres une coupure, ou commandes arrivees apres le premier commit :
+        // deja applique si le royaume vient de ce processus (seules les nouvelles commandes le sont), perdu sinon
+        auto peerIt = m_controlPeers.find(link);
+        auto receivedIt = m_received.find(kingdomId);
+        if (peerIt == m_controlPeers.end() || receivedIt == m_received.end() || receivedIt->second.source != peerIt->second)
+        {
+            SendMigrationCommitted(link, kingdomId, false, 0);
+            return;
+        }
+
+        auto& received = receivedIt->second;
+        if (KingdomWorld* world = m_context.findKingdom(kingdomId))
+        {
+            ApplyMigratedCommands(*world, kingdomId, commit, received.appliedCommands);
+        }
+        SendMigrationCommitted(link, kingdomId, true, received.appliedCommands);
+    }
+
+    void MigrationManager::ApplyMigratedCommands(KingdomWorld& world, int kingdomId, const Network::MigrationCommit& commit,
+        uint32_t& applied)
+    {
+        const auto* commands = commit.commands();
+        if (!commands)
+            return;
+
+        // Les commandes se suivent : un trou (commit perdu) arrete l'application, la source renverra la suite
+        auto& registry = world.GetRegistry();
+        for (uint32_t i = 0; i < commands->size(); ++i)
+        {
+            const uint32_t index = commit.first_command() + i;
+            if (index < applied)
+                continue;
+            if (index > applied)
+                break;
+
+            applied = index + 1;
+            const auto* command = commands->Get(i);
+            if (!command || !command->payload())
+                continue;
+
+            // Entite du snapshot, toujours au meme compte : sinon la commande est ignoree
+            auto entity = static_cast<entt::entity>(command->entity());
+            const auto* info = registry.valid(entity) ? registry.try_get<ECS::PlayerInfoComponent>(entity) : nullptr;
+            if (!info || info->accountID != command->account_id())
+                continue;
+
+            m_context.playerCommands->Apply(command->opcode(), Network::PlayerCommand{ nullptr, &world, entity, kingdomId, INVALID_PLAYER },
+                std::span<const uint8_t>(command->payload()->data(), command->payload()->size()));
+        }
+    }
+
+    void MigrationManager::SendMigrationCommitted(Network::ControlLinkId link, int kingdomId, bool isSuccess, uint32_t appliedCommands)
+    {
+        m_context.control->Send(link, Network::Opcode_S2S_MigrationCommitted, [&](flatbuffers::FlatBufferBuilder& fbb)
+        {
+            Network::MigrationCommittedBuilder committed(fbb);
+            committed.add_kingdom_id(kingdomId);
+            committed.add_success(isSuccess);
+            committed.add_applied_commands(appliedCommands);
+            fbb.Finish(committed.Finish());
+        });
+    }
+}
@@ -1,4 +1,6 @@
 #include "core/ServerCommands.h"
+#include "core/Task.h"
+#include "world/WorldMap.h"
 #include "utils/Logger.h"
 #include <filesystem>
 
@@ -59,6 +61,129 @@ namespace MMO::Core
                 }
             });
 
+        // profile [reset] - Affiche ou remet a zero les histogrammes du tick
+        commandSystem.Register("profile", "Affiche les temps du tick (p50/p99/max). Usage: profile [reset]",
+            [ctx](const std::vector<std::string>& args)
+            {
+                if (!ctx.profiler)
+                    return;
+
+                if (!args.empty() && args[0] == "reset")
+                {
+                    ctx.profiler->Reset();
+                    return;
+                }
+
+                ctx.profiler->PrintReport();
+            });
+
+        // callbacks - Etat de la file de callbacks main thread
+        commandSystem.Register("callbacks", "Affiche la profondeur et les reports de la file de callbacks main thread",
+            [ctx](const std::vector<std::string>&)
+            {
+                if (ctx.mainThreadQueue)
+                    ctx.mainThreadQueue->PrintStats();
+            });
+
+        // replication - Volume de la replication AOI
+        commandSystem.Register("replication", "Affiche les lots de replication AOI envoyes (octets, entrees, sorties)",
+            [ctx](const std::vector<std::string>&)
+            {
+                if (ctx.replication)
+                    ctx.replication->PrintStats();
+            });
+
+        // paths - Compteurs du pathfinding
+        commandSystem.Register("paths", "Affiche les calculs de chemin (A*, flow fields, echecs, temps moyen)",
+            [ctx](const std::vector<std::string>&)
+            {
+                if (ctx.pathfinding)
+                    ctx.pathfinding->PrintStats();
+            });
+
+        // snapshot - Sauvegarde immediate de tous les royaumes
+        commandSystem.Register("snapshot", "Ecrit un snapshot de chaque royaume (recharge au prochain demarrage)",
+            [ctx](const std::vector<std::string>&)
+            {
+                if (ctx.saveSnapshots)
+                    ctx.saveSnapshots();
+            });
+
+        // kingdoms - Residence des royaumes (resident, hiberne...)
+        commandSystem.Register("kingdoms", "Affiche l'etat de chaque royaume (resident, hiberne, en reveil)",
+            [ctx](const std::vector<std::string>&)
+            {
+                if (ctx.printKingdoms)
+                    ctx.printKingdoms();
+            });
+
+        // migrate <id> <ip:port> - Deplace un royaume vers un autre processus (mode shard)
+        commandSystem.Register("migrate", "Deplace un royaume vivant vers un autre processus. Usage: migrate <id> <ip:port>",
+            [ctx](const std::vector<std::string>& args)
+            {
+                size_t separator = args.size() == 2 ? args[1].rfind(':') : std::string::npos;
+                if (separator == std::string::npos)
+                {
+                    LOG_WARN("Usage: migrate <id> <ip:port>");
+                    return;
+                }
+
+                if (!ctx.migrateKingdom)
+                {
+                    LOG_WARN("migrate: disponible uniquement en mode shard (--shard)");
+                    return;
+                }
+
+                try
+                {
+                    int kingdomId = std::stoi(args[0]);
+                    uint16_t port = static_cast<uint16_t>(std::stoul(args[1].substr(separator + 1)));
+                    ctx.migrateKingdom(kingdomId, args[1].substr(0, separator), port);
+                }
+                catch (const std::exception&)
+                {
+                    LOG_WARN("migrate: identifiant ou port invalide");
+                }
+            });
+
+        // tasks - Compteurs des coroutines (frames allouees, changements de thread)
+        commandSystem.Register("tasks", "Affiche les allocations et reprises des coroutines async",
+            [](const std::vector<std::string>&)
+            {
+                PrintTaskStats();
+            });
+
+        // genmap <fichier> <largeur> <hauteur> [graine] - Genere une carte statique procedurale
+        commandSystem.Register("genmap", "Genere une carte statique (tuiles de 10). Usage: genmap <fichier.map> <largeur> <hauteur> [graine]",
+            [](const std::vector<std::string>& args)
+            {
+                if (args.size() < 3)
+                {
+                    LOG_WARN("Usage: genmap <fichier.map> <largeur> <hauteur> [graine]");
+                    return;
+                }
+
+                try
+                {
+                    uint32_t width = static_cast<uint32_t>(std::stoul(args[1]));
+                    uint32_t height = static_cast<uint32_t>(std::stoul(args[2]));
+                    uint32_t seed = args.size() > 3 ? static_cast<uint32_t>(std::stoul(args[3])) : 1;
+                    if (width == 0 || height == 0 || width > 16384 || height > 16384)
+                    {
+                        LOG_WARN("genmap: dimensions entre 1 et 16384 tuiles");
+                        return;
+                    }
+
+                    auto builder = GenerateWorldMap(width, height, 10.0f, seed);
+                    if (builder.Save(args[0]))
+                        LOG_INFO("Carte {}x{} (graine {}) ecrite dans '{}'", width, height, seed, args[0]);
+                }
+                catch (const std::exception&)
+                {
+                    LOG_WARN("genmap: dimensions ou graine invalides");
+                }
+            });
+
         // stop - Arrete le serveur proprement
         commandSystem.Register("stop", "Arrete le serveur proprement",
             [ctx](const std::vector<std::string>&)
@@ -0,0 +1,76 @@
+#include "core/Task.h"
+#include "utils/Logger.h"
+#include <exception>
+#include <new>
+
+
+namespace MMO::Core
+{
+    namespace Detail
+    {
+        TaskCounters& GetTaskCounters()
+        {
+            static TaskCounters counters;
+            return counters;
+        }
+    }
+
+    void Task::promise_type::unhandled_exception() noexcept
+    {
+        Detail::GetTaskCounters().failures.fetch_add(1, std::memory_order_relaxed);
+        try
+        {
+            throw;
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Exception non rattrapee dans une coroutine: {}", e.what());
+        }
+        catch (...)
+        {
+            LOG_ERROR("Exception inconnue non rattrapee dans une coroutine");
+        }
+    }
+
+    void* Task::promise_type::operator new(std::size_t size)
+    {
+        auto& counters = Detail::GetTaskCounters();
+        counters.frameAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.frameBytes.fetch_add(size, std::memory_order_relaxed);
+        counters.live.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    void Task::promise_type::operator delete(void* ptr, std::size_t size) noexcept
+    {
+        Detail::GetTaskCounters().live.fetch_sub(1, std::memory_order_relaxed);
+        ::operator delete(ptr, size);
+    }
+
+    TaskStats GetTaskStats()
+    {
+        const auto& counters = Detail::GetTaskCounters();
+
+        TaskStats stats;
+        stats.started = counters.started.load(std::memory_order_relaxed);
+        stats.live = counters.live.load(std::memory_order_relaxed);
+        stats.frameAllocations = counters.frameAllocations.load(std::memory_order_relaxed);
+        stats.frameBytes = counters.frameBytes.load(std::memory_order_relaxed);
+        stats.executorHops = counters.executorHops.load(std::memory_order_relaxed);
+        stats.inlineResumes = counters.inlineResumes.load(std::memory_order_relaxed);
+        stats.failures = counters.failures.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void PrintTaskStats()
+    {
+        TaskStats stats = GetTaskStats();
+
+        LOG_INFO("=== Coroutines ===");
+        LOG_INFO("  Lancees: {} | En cours: {} | Echecs: {}", stats.started, stats.live, stats.failures);
+        LOG_INFO("  Frames: {} allocations, {} octets (moy {} o)", stats.frameAllocations, stats.frameBytes,
+            stats.frameAllocations > 0 ? stats.frameBytes / stats.frameAllocations : 0);
+        LOG_INFO("  Reprises: {} via executor (changement de thread), {} directes", stats.executorHops, stats.inlineResumes);
+        LOG_INFO("==================");
+    }
+}
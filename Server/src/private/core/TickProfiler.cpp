@@ -0,0 +1,128 @@
+#include "core/TickProfiler.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+
+namespace MMO::Core
+{
+    int TimingHistogram::BucketIndex(uint64_t micros)
+    {
+        if (micros < EXACT_BUCKETS)
+            return static_cast<int>(micros);
+
+        // Position du bit de poids fort (>= 3) puis 2 bits suivants pour le sous-bucket
+        int msb = std::bit_width(micros) - 1;
+        if (msb > 31)
+            return BUCKET_COUNT - 1;
+
+        int sub = static_cast<int>((micros >> (msb - 2)) & (SUB_BUCKETS - 1));
+        return EXACT_BUCKETS + (msb - 3) * SUB_BUCKETS + sub;
+    }
+
+    uint64_t TimingHistogram::BucketUpperBound(int index)
+    {
+        if (index < EXACT_BUCKETS)
+            return static_cast<uint64_t>(index);
+
+        int msb = (index - EXACT_BUCKETS) / SUB_BUCKETS + 3;
+        int sub = (index - EXACT_BUCKETS) % SUB_BUCKETS;
+        return ((static_cast<uint64_t>(SUB_BUCKETS + sub + 1)) << (msb - 2)) - 1;
+    }
+
+    void TimingHistogram::Record(float milliseconds)
+    {
+        uint64_t micros = static_cast<uint64_t>(std::max(0.0f, milliseconds) * 1000.0f);
+
+        m_buckets[BucketIndex(micros)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_totalMicros.fetch_add(micros, std::memory_order_relaxed);
+
+        uint64_t currentMax = m_maxMicros.load(std::memory_order_relaxed);
+        while (micros > currentMax && !m_maxMicros.compare_exchange_weak(currentMax, micros, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    float TimingHistogram::Percentile(float p) const
+    {
+        uint64_t count = GetCount();
+        if (count == 0)
+            return 0.0f;
+
+        uint64_t rank = static_cast<uint64_t>(std::ceil(static_cast<double>(p) * static_cast<double>(count)));
+        rank = std::max<uint64_t>(rank, 1);
+
+        uint64_t seen = 0;
+        for (int i = 0; i < BUCKET_COUNT; ++i)
+        {
+            seen += m_buckets[i].load(std::memory_order_relaxed);
+            if (seen >= rank)
+            {
+                // La borne haute du bucket ne peut pas depasser le max reel
+                uint64_t bound = std::min(BucketUpperBound(i), m_maxMicros.load(std::memory_order_relaxed));
+                return static_cast<float>(bound) / 1000.0f;
+            }
+        }
+
+        return GetMax();
+    }
+
+    float TimingHistogram::GetMean() const
+    {
+        uint64_t count = GetCount();
+        if (count == 0)
+            return 0.0f;
+
+        return static_cast<float>(m_totalMicros.load(std::memory_order_relaxed)) / static_cast<float>(count) / 1000.0f;
+    }
+
+    void TimingHistogram::Reset()
+    {
+        for (auto& bucket : m_buckets)
+            bucket.store(0, std::memory_order_relaxed);
+
+        m_count.store(0, std::memory_order_relaxed);
+        m_totalMicros.store(0, std::memory_order_relaxed);
+        m_maxMicros.store(0, std::memory_order_relaxed);
+    }
+
+    TimingHistogram& TickProfiler::Get(const std::string& key)
+    {
+        std::scoped_lock lock(m_mutex);
+
+        auto& histogram = m_histograms[key];
+        if (!histogram)
+            histogram = std::make_unique<TimingHistogram>();
+
+        return *histogram;
+    }
+
+    void TickProfiler::PrintReport() const
+    {
+        std::scoped_lock lock(m_mutex);
+
+        LOG_INFO("=== Profil du tick (ms) ===");
+        for (const auto& [key, histogram] : m_histograms)
+        {
+            if (histogram->GetCount() == 0)
+                continue;
+
+            LOG_INFO("  {:<32} n={:<8} moy={:>7.3f} p50={:>7.3f} p99={:>7.3f} max={:>7.3f}",
+                key, histogram->GetCount(), histogram->GetMean(),
+                histogram->Percentile(0.50f), histogram->Percentile(0.99f), histogram->GetMax());
+        }
+        LOG_INFO("===========================");
+    }
+
+    void TickProfiler::Reset()
+    {
+        std::scoped_lock lock(m_mutex);
+
+        for (auto& [key, histogram] : m_histograms)
+            histogram->Reset();
+
+        LOG_INFO("Profil du tick remis a zero.");
+    }
+}
@@ -0,0 +1,122 @@
+#include "core/TickScheduler.h"
+#include "utils/Logger.h"
+#include <thread>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#elif defined(__linux__)
+    #include <cerrno>
+    #include <ctime>
+    #include <sys/prctl.h>
+#endif
+
+
+namespace MMO::Core
+{
+    // --- Spin ---
+
+    void SpinTickScheduler::WaitUntil(TimePoint deadline)
+    {
+        auto sleepTime = deadline - std::chrono::steady_clock::now();
+        if (sleepTime <= std::chrono::steady_clock::duration::zero())
+            return;
+
+        auto osSleepTime = sleepTime - std::chrono::milliseconds(2);
+        if (osSleepTime > std::chrono::steady_clock::duration::zero())
+        {
+            std::this_thread::sleep_for(osSleepTime);
+        }
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // --- Precise ---
+
+    PreciseTickScheduler::PreciseTickScheduler()
+    {
+#if defined(_WIN32)
+        // Timer haute resolution (Windows 10 1803+) — repli sur un timer standard sinon
+        m_timerHandle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (!m_timerHandle)
+            m_timerHandle = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+#elif defined(__linux__)
+        // Reduit le timer slack du thread du tick (50 us par defaut) pour un reveil a la microseconde
+        prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+    }
+
+    PreciseTickScheduler::~PreciseTickScheduler()
+    {
+#if defined(_WIN32)
+        if (m_timerHandle)
+            CloseHandle(m_timerHandle);
+#endif
+    }
+
+    void PreciseTickScheduler::WaitUntil(TimePoint deadline)
+    {
+#if defined(_WIN32)
+        auto remaining = deadline - std::chrono::steady_clock::now();
+        if (remaining <= std::chrono::steady_clock::duration::zero())
+            return;
+
+        if (!m_timerHandle)
+        {
+            std::this_thread::sleep_until(deadline);
+            return;
+        }
+
+        // Delai relatif en unites de 100 ns (valeur negative = relatif)
+        LARGE_INTEGER dueTime;
+        dueTime.QuadPart = -static_cast<LONGLONG>(std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count() / 100);
+        if (SetWaitableTimer(m_timerHandle, &dueTime, 0, nullptr, nullptr, FALSE))
+        {
+            WaitForSingleObject(m_timerHandle, INFINITE);
+        }
+        else
+        {
+            std::this_thread::sleep_until(deadline);
+        }
+#elif defined(__linux__)
+        // steady_clock repose sur CLOCK_MONOTONIC : l'echeance est utilisable telle quelle en absolu
+        auto sinceEpoch = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+
+        timespec ts;
+        ts.tv_sec = static_cast<time_t>(sinceEpoch / 1'000'000'000);
+        ts.tv_nsec = static_cast<long>(sinceEpoch % 1'000'000'000);
+
+        // Reprend apres un signal : l'echeance absolue ne derive pas
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+        {
+        }
+#else
+        // Autres POSIX (macOS...) : ni clock_nanosleep absolu ni timer slack, sleep standard sur l'echeance
+        std::this_thread::sleep_until(deadline);
+#endif
+    }
+
+    // --- LowPower ---
+
+    void LowPowerTickScheduler::WaitUntil(TimePoint deadline)
+    {
+        std::this_thread::sleep_until(deadline);
+    }
+
+    // --- Fabrique ---
+
+    std::unique_ptr<ITickScheduler> CreateTickScheduler(const std::string& mode)
+    {
+        if (mode == "spin")
+            return std::make_unique<SpinTickScheduler>();
+
+        if (mode == "lowpower")
+            return std::make_unique<LowPowerTickScheduler>();
+
+        if (mode != "precise")
+            LOG_WARN("Mode de tick scheduler inconnu '{}'. Utilisation de 'precise'.", mode);
+
+        return std::make_unique<PreciseTickScheduler>();
+    }
+}
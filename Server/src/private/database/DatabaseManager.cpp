@@ -13,7 +13,7 @@ namespace MMO::Database
         Shutdown();
     }
 
-    bool DatabaseManager::Initialize(const std::string& dbPath) 
+    bool DatabaseManager::Initialize(const std::string& dbPath, bool isSynchronous) 
     {
         try 
         {
@@ -25,7 +25,11 @@ namespace MMO::Database
 
             // Demarrage du thread dedie aux operations DB
             m_isRunning = true;
-            m_workerThread = std::thread(&DatabaseManager::WorkerThreadMain, this);
+            m_isSynchronous = isSynchronous;
+            if (!m_isSynchronous)
+            {
+                m_workerThread = std::thread(&DatabaseManager::WorkerThreadMain, this);
+            }
             
             return true;
         } 
@@ -56,10 +60,16 @@ namespace MMO::Database
 
     void DatabaseManager::EnqueueJob(DatabaseJob job) 
     {
-        if (m_isRunning) 
+        if (!m_isRunning)
+            return;
+
+        if (m_isSynchronous)
         {
-            m_jobQueue.Push(std::move(job));
+            RunJob(job);
+            return;
         }
+
+        m_jobQueue.Push(std::move(job));
     }
 
     // Boucle du worker : attend et execute les jobs un par un
@@ -73,18 +83,23 @@ namespace MMO::Database
             
             if (!m_isRunning)
                 break;
-                
-            try 
-            {
-                if (m_db && job) 
-                {
-                    job(*m_db);
-                }
-            } 
-            catch (const std::exception& e) 
+
+            RunJob(job);
+        }
+    }
+
+    void DatabaseManager::RunJob(const DatabaseJob& job)
+    {
+        try 
+        {
+            if (m_db && job) 
             {
-                LOG_ERROR("Erreur dans le Database Worker Thread: {}", e.what());
+                job(*m_db);
             }
+        } 
+        catch (const std::exception& e) 
+        {
+            LOG_ERROR("Erreur dans un job de la base de donnees: {}", e.what());
         }
     }
 
@@ -120,11 +135,31 @@ namespace MMO::Database
                     wood INTEGER DEFAULT 500,
                     stone INTEGER DEFAULT 200,
                     gold INTEGER DEFAULT 100,
+                    food_rate INTEGER DEFAULT 300,
+                    wood_rate INTEGER DEFAULT 300,
+                    stone_rate INTEGER DEFAULT 100,
+                    gold_rate INTEGER DEFAULT 50,
+                    food_settled_at INTEGER DEFAULT 0,
+                    wood_settled_at INTEGER DEFAULT 0,
+                    stone_settled_at INTEGER DEFAULT 0,
+                    gold_settled_at INTEGER DEFAULT 0,
+                    troops INTEGER DEFAULT 1000,
                     FOREIGN KEY (account_id) REFERENCES accounts(id),
                     UNIQUE(account_id, kingdom_id)
                 )
             )");
 
+            // Bases creees avant la production des ressources : colonnes ajoutees a la volee
+            AddColumnIfMissing("player_data", "food_rate", "INTEGER DEFAULT 300");
+            AddColumnIfMissing("player_data", "wood_rate", "INTEGER DEFAULT 300");
+            AddColumnIfMissing("player_data", "stone_rate", "INTEGER DEFAULT 100");
+            AddColumnIfMissing("player_data", "gold_rate", "INTEGER DEFAULT 50");
+            AddColumnIfMissing("player_data", "food_settled_at", "INTEGER DEFAULT 0");
+            AddColumnIfMissing("player_data", "wood_settled_at", "INTEGER DEFAULT 0");
+            AddColumnIfMissing("player_data", "stone_settled_at", "INTEGER DEFAULT 0");
+            AddColumnIfMissing("player_data", "gold_settled_at", "INTEGER DEFAULT 0");
+            AddColumnIfMissing("player_data", "troops", "INTEGER DEFAULT 1000");
+
             // Table des liaisons de comptes sociaux (Google, Apple, etc.)
             m_db->exec(R"(
                 CREATE TABLE IF NOT EXISTS account_bindings (
@@ -145,4 +180,18 @@ namespace MMO::Database
             throw;
         }
     }
+
+    // Ajoute une colonne a une table existante (CREATE TABLE IF NOT EXISTS ne touche pas aux anciennes bases)
+    void DatabaseManager::AddColumnIfMissing(const std::string& table, const std::string& column, const std::string& definition)
+    {
+        SQLite::Statement query(*m_db, "PRAGMA table_info(" + table + ")");
+        while (query.executeStep())
+        {
+            if (query.getColumn(1).getString() == column)
+                return;
+        }
+
+        m_db->exec("ALTER TABLE " + table + " ADD COLUMN " + column + " " + definition);
+        LOG_INFO("Migration: colonne {}.{} ajoutee", table, column);
+    }
 }
@@ -1,5 +1,6 @@
 #include "database/repositories/SqlitePlayerRepository.h"
 #include "utils/Logger.h"
+#include "utils/Time.h"
 
 
 namespace MMO::Database
@@ -16,7 +17,9 @@ namespace MMO::Database
             try
             {
                 SQLite::Statement query(db,
-                    "SELECT id, account_id, kingdom_id, pos_x, pos_y, food, wood, stone, gold "
+                    "SELECT id, account_id, kingdom_id, pos_x, pos_y, food, wood, stone, gold, "
+                    "food_rate, wood_rate, stone_rate, gold_rate, "
+                    "food_settled_at, wood_settled_at, stone_settled_at, gold_settled_at, troops "
                     "FROM player_data WHERE account_id = ? AND kingdom_id = ?");
                 query.bind(1, accountId);
                 query.bind(2, kingdomId);
@@ -33,6 +36,15 @@ namespace MMO::Database
                     data.wood      = query.getColumn(6).getInt();
                     data.stone     = query.getColumn(7).getInt();
                     data.gold      = query.getColumn(8).getInt();
+                    data.foodRate  = query.getColumn(9).getInt();
+                    data.woodRate  = query.getColumn(10).getInt();
+                    data.stoneRate = query.getColumn(11).getInt();
+                    data.goldRate  = query.getColumn(12).getInt();
+                    data.foodSettledAtMs  = query.getColumn(13).getInt64();
+                    data.woodSettledAtMs  = query.getColumn(14).getInt64();
+                    data.stoneSettledAtMs = query.getColumn(15).getInt64();
+                    data.goldSettledAtMs  = query.getColumn(16).getInt64();
+                    data.troops           = query.getColumn(17).getInt();
 
                     if (callback)
                         callback(data);
@@ -63,12 +75,19 @@ namespace MMO::Database
                 PlayerData data;
                 data.accountId = accountId;
                 data.kingdomId = kingdomId;
+                int64_t nowMs = Time::UnixMilliseconds();
+                data.foodSettledAtMs  = nowMs;
+                data.woodSettledAtMs  = nowMs;
+                data.stoneSettledAtMs = nowMs;
+                data.goldSettledAtMs  = nowMs;
 
                 SQLite::Transaction transaction(db);
 
                 SQLite::Statement query(db,
-                    "INSERT INTO player_data (account_id, kingdom_id, pos_x, pos_y, food, wood, stone, gold) "
-                    "VALUES (?, ?, ?, ?, ?, ?, ?, ?)");
+                    "INSERT INTO player_data (account_id, kingdom_id, pos_x, pos_y, food, wood, stone, gold, "
+                    "food_rate, wood_rate, stone_rate, gold_rate, "
+                    "food_settled_at, wood_settled_at, stone_settled_at, gold_settled_at, troops) "
+                    "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
                 query.bind(1, accountId);
                 query.bind(2, kingdomId);
                 query.bind(3, static_cast<double>(data.posX));
@@ -77,6 +96,15 @@ namespace MMO::Database
                 query.bind(6, data.wood);
                 query.bind(7, data.stone);
                 query.bind(8, data.gold);
+                query.bind(9, data.foodRate);
+                query.bind(10, data.woodRate);
+                query.bind(11, data.stoneRate);
+                query.bind(12, data.goldRate);
+                query.bind(13, data.foodSettledAtMs);
+                query.bind(14, data.woodSettledAtMs);
+                query.bind(15, data.stoneSettledAtMs);
+                query.bind(16, data.goldSettledAtMs);
+                query.bind(17, data.troops);
 
                 query.exec();
                 data.id = static_cast<int>(db.getLastInsertRowid());
@@ -97,21 +125,26 @@ namespace MMO::Database
     }
 
     // Sauvegarde les ressources en DB (fire-and-forget)
-    void SqlitePlayerRepository::UpdateResources(int accountId, int kingdomId, int food, int wood, int stone, int gold)
+    void SqlitePlayerRepository::UpdateResources(int accountId, int kingdomId, const StoredResources& resources)
     {
-        m_dbManager->EnqueueJob([accountId, kingdomId, food, wood, stone, gold](SQLite::Database& db)
+        m_dbManager->EnqueueJob([accountId, kingdomId, resources](SQLite::Database& db)
         {
             try
             {
                 SQLite::Statement query(db,
-                    "UPDATE player_data SET food = ?, wood = ?, stone = ?, gold = ? "
+                    "UPDATE player_data SET food = ?, wood = ?, stone = ?, gold = ?, "
+                    "food_settled_at = ?, wood_settled_at = ?, stone_settled_at = ?, gold_settled_at = ? "
                     "WHERE account_id = ? AND kingdom_id = ?");
-                query.bind(1, food);
-                query.bind(2, wood);
-                query.bind(3, stone);
-                query.bind(4, gold);
-                query.bind(5, accountId);
-                query.bind(6, kingdomId);
+                query.bind(1, resources.food.amount);
+                query.bind(2, resources.wood.amount);
+                query.bind(3, resources.stone.amount);
+                query.bind(4, resources.gold.amount);
+                query.bind(5, resources.food.settledAtMs);
+                query.bind(6, resources.wood.settledAtMs);
+                query.bind(7, resources.stone.settledAtMs);
+                query.bind(8, resources.gold.settledAtMs);
+                query.bind(9, accountId);
+                query.bind(10, kingdomId);
                 query.exec();
             }
             catch (const std::exception& e)
@@ -120,4 +153,25 @@ namespace MMO::Database
             }
         });
     }
+
+    // Sauvegarde l'armee en DB (fire-and-forget)
+    void SqlitePlayerRepository::UpdateTroops(int accountId, int kingdomId, int troops)
+    {
+        m_dbManager->EnqueueJob([accountId, kingdomId, troops](SQLite::Database& db)
+        {
+            try
+            {
+                SQLite::Statement query(db,
+                    "UPDATE player_data SET troops = ? WHERE account_id = ? AND kingdom_id = ?");
+                query.bind(1, troops);
+                query.bind(2, accountId);
+                query.bind(3, kingdomId);
+                query.exec();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("SqlitePlayerRepository::UpdateTroops erreur: {}", e.what());
+            }
+        });
+    }
 }
@@ -0,0 +1,451 @@
+#include "network/ControlHost.h"
+#include "Migration_generated.h"
+#include "utils/Logger.h"
+#include <sodium.h>
+
+
+namespace MMO::Network
+{
+    namespace
+    {
+        constexpr size_t MAX_CONTROL_LINKS = 32;
+
+        // Plus gros message accepte : un morceau de snapshot (256 Ko) et son enveloppe, avec de la marge
+        constexpr size_t MAX_CONTROL_PACKET_SIZE = 2 * 1024 * 1024;
+
+        // Un lien qui n'a pas fini l'authentification dans ce delai est ferme
+        constexpr auto HANDSHAKE_TIMEOUT = std::chrono::seconds(5);
+
+        // Tags des preuves HMAC : la reponse d'un sens ne peut pas etre rejouee dans l'autre
+        constexpr uint8_t MAC_TAG_HELLO = 1;
+        constexpr uint8_t MAC_TAG_WELCOME = 2;
+
+        // L'identifiant du lien voyage avec le peer ENet
+        ControlLinkId GetLinkId(const ENetPeer* peer)
+        {
+            return static_cast<ControlLinkId>(reinterpret_cast<uintptr_t>(peer->data));
+        }
+
+        void SetLinkId(ENetPeer* peer, ControlLinkId link)
+        {
+            peer->data = reinterpret_cast<void*>(static_cast<uintptr_t>(link));
+        }
+
+        ControlAddress GetRemoteAddress(const ENetPeer* peer)
+        {
+            char ip[64] = {};
+            enet_address_get_ip(&peer->address, ip, sizeof(ip));
+            return ControlAddress{ ip, peer->address.port };
+        }
+
+        // Payload d'un message d'authentification, verifie avant lecture (le pair n'est pas encore de confiance)
+        template<typename T>
+        const T* ReadAuthPayload(const ENetPacket* packet, Opcode expected)
+        {
+            flatbuffers::Verifier envVerifier(packet->data, packet->dataLength);
+            if (!VerifyEnvelopeBuffer(envVerifier))
+                return nullptr;
+
+            const Envelope* envelope = GetEnvelope(packet->data);
+            if (envelope->opcode() != expected || !envelope->payload_data())
+                return nullptr;
+
+            const auto* payload = envelope->payload_data();
+            flatbuffers::Verifier verifier(payload->data(), payload->size());
+            if (!verifier.VerifyBuffer<T>(nullptr))
+                return nullptr;
+
+            return flatbuffers::GetRoot<T>(payload->data());
+        }
+
+        bool HasSize(const flatbuffers::Vector<uint8_t>* bytes, size_t size)
+        {
+            return bytes && bytes->size() == size;
+        }
+    }
+
+    ControlHost::~ControlHost()
+    {
+        Stop();
+    }
+
+    bool ControlHost::Start(const std::string& bindIp, uint16_t port, const std::string& secret)
+    {
+        if (secret.empty())
+        {
+            LOG_ERROR("ControlHost: secret partage vide, canal de controle refuse");
+            return false;
+        }
+
+        ENetAddress address;
+        if (enet_address_set_ip(&address, bindIp.c_str()) < 0)
+        {
+            LOG_ERROR("ControlHost: adresse d'ecoute invalide '{}'", bindIp);
+            return false;
+        }
+        address.port = port;
+
+        m_host = enet_host_create(&address, MAX_CONTROL_LINKS, 1, 0, 0, 0);
+        if (m_host == nullptr)
+        {
+            LOG_ERROR("ControlHost: impossible d'ouvrir le port de controle {}:{}", bindIp, port);
+            return false;
+        }
+
+        // ENet refuse (et coupe) au-dela : un pair ne peut pas imposer une allocation arbitraire
+        m_host->maximumPacketSize = MAX_CONTROL_PACKET_SIZE;
+        m_secret = secret;
+
+        m_isRunning = true;
+        m_thread = std::thread(&ControlHost::NetworkMain, this);
+
+        LOG_INFO("Canal de controle inter-processus sur {}:{}", bindIp, port);
+        return true;
+    }
+
+    void ControlHost::Stop()
+    {
+        if (!m_thread.joinable())
+            return;
+
+        m_isRunning = false;
+        m_thread.join();
+
+        for (auto& [link, state] : m_links)
+        {
+            enet_peer_disconnect_now(state.peer, 0);
+        }
+        m_links.clear();
+
+        enet_host_destroy(m_host);
+        m_host = nullptr;
+    }
+
+    ControlLinkId ControlHost::Connect(const std::string& ip, uint16_t port)
+    {
+        ControlLinkId link = m_nextLinkId++;
+        m_commands.Push(Command{ CommandType::Connect, link, ip, port, {} });
+        return link;
+    }
+
+    void ControlHost::Disconnect(ControlLinkId link)
+    {
+        m_commands.Push(Command{ CommandType::Disconnect, link, {}, 0, {} });
+    }
+
+    void ControlHost::RegisterHandler(Opcode opcode, MessageHandler handler)
+    {
+        if (m_handlers.contains(opcode))
+        {
+            LOG_WARN("ControlHost: un handler est deja enregistre pour l'Opcode {}", static_cast<uint16_t>(opcode));
+            return;
+        }
+
+        m_handlers[opcode] = std::move(handler);
+    }
+
+    void ControlHost::ProcessEvents()
+    {
+        while (auto event = m_events.TryPop())
+        {
+            switch (event->type)
+            {
+                case EventType::Connected:
+                case EventType::Disconnected:
+                    if (m_onLink)
+                        m_onLink(event->link, event->type == EventType::Connected, event->remote);
+                    break;
+
+                case EventType::Message:
+                    Dispatch(event->link, event->data);
+                    break;
+            }
+        }
+    }
+
+    void ControlHost::NetworkMain()
+    {
+        while (m_isRunning)
+        {
+            while (auto command = m_commands.TryPop())
+            {
+                ExecuteCommand(*command);
+            }
+
+            // Liens bloques dans l'authentification
+            const auto now = std::chrono::steady_clock::now();
+            std::vector<ControlLinkId> expired;
+            for (const auto& [link, state] : m_links)
+            {
+                if (!state.isAuthenticated && now > state.deadline)
+                    expired.push_back(link);
+            }
+            for (ControlLinkId link : expired)
+            {
+                Reject(link, "authentification trop longue");
+            }
+
+            // Attente courte : une commande du main thread part en moins d'une milliseconde
+            ENetEvent event;
+            int timeoutMs = 1;
+            while (enet_host_service(m_host, &event, timeoutMs) > 0)
+            {
+                timeoutMs = 0;
+                switch (event.type)
+                {
+                    case ENET_EVENT_TYPE_CONNECT:
+                    {
+                        // Lien sortant : il attend le defi de l'accepteur
+                        ControlLinkId link = GetLinkId(event.peer);
+                        if (link != INVALID_CONTROL_LINK)
+                        {
+                            auto it = m_links.find(link);
+                            if (it != m_links.end())
+                                it->second.deadline = std::chrono::steady_clock::now() + HANDSHAKE_TIMEOUT;
+                            break;
+                        }
+
+                        // Lien entrant : seulement depuis un processus annonce dans le repertoire des shards
+                        const ControlAddress remote = GetRemoteAddress(event.peer);
+                        if (!m_authorizer || !m_authorizer(remote))
+                        {
+                            LOG_WARN("ControlHost: lien entrant refuse depuis {}:{} (processus inconnu)", remote.ip, remote.port);
+                            enet_peer_disconnect_now(event.peer, 0);
+                            break;
+                        }
+
+                        link = m_nextLinkId++;
+                        SetLinkId(event.peer, link);
+
+                        Link& state = m_links[link];
+                        state.peer = event.peer;
+                        state.deadline = std::chrono::steady_clock::now() + HANDSHAKE_TIMEOUT;
+                        randombytes_buf(state.nonce.data(), state.nonce.size());
+
+                        SendNow(event.peer, Opcode_S2S_ControlChallenge, [&](flatbuffers::FlatBufferBuilder& fbb)
+                        {
+                            auto nonce = fbb.CreateVector(state.nonce.data(), state.nonce.size());
+                            ControlChallengeBuilder challenge(fbb);
+                            challenge.add_nonce(nonce);
+                            fbb.Finish(challenge.Finish());
+                        });
+                        break;
+                    }
+
+                    case ENET_EVENT_TYPE_RECEIVE:
+                    {
+                        ControlLinkId link = GetLinkId(event.peer);
+                        auto it = m_links.find(link);
+                        if (it != m_links.end())
+                        {
+                            if (it->second.isAuthenticated)
+                            {
+                                m_events.Push(Event{ EventType::Message, link,
+                                    std::vector<uint8_t>(event.packet->data, event.packet->data + event.packet->dataLength) });
+                            }
+                            else if (!Authenticate(link, it->second, event.packet))
+                            {
+                                Reject(link, "authentification refusee");
+                            }
+                        }
+                        enet_packet_destroy(event.packet);
+                        break;
+                    }
+
+                    case ENET_EVENT_TYPE_DISCONNECT:
+                    case ENET_EVENT_TYPE_DISCONNECT_TIMEOUT:
+                    {
+                        // Aussi l'echec d'une connexion sortante
+                        ControlLinkId link = GetLinkId(event.peer);
+                        SetLinkId(event.peer, INVALID_CONTROL_LINK);
+
+                        auto it = m_links.find(link);
+                        if (it == m_links.end())
+                            break;
+
+                        // Le main thread ne connait que les liens authentifies et ceux qu'il a ouverts
+                        const bool isKnown = it->second.isOutbound || it->second.isAuthenticated;
+                        m_links.erase(it);
+                        if (isKnown)
+                            m_events.Push(Event{ EventType::Disconnected, link, {} });
+                        break;
+                    }
+
+                    case ENET_EVENT_TYPE_NONE:
+                        break;
+                }
+            }
+        }
+    }
+
+    void ControlHost::ExecuteCommand(Command& command)
+    {
+        switch (command.type)
+        {
+            case CommandType::Connect:
+            {
+                ENetAddress address;
+                enet_address_set_ip(&address, command.ip.c_str());
+                address.port = command.port;
+
+                ENetPeer* peer = enet_host_connect(m_host, &address, 1, 0);
+                if (!peer)
+                {
+                    LOG_ERROR("ControlHost: connexion vers {}:{} impossible", command.ip, command.port);
+                    m_events.Push(Event{ EventType::Disconnected, command.link, {} });
+                    return;
+                }
+
+                SetLinkId(peer, command.link);
+
+                Link& state = m_links[command.link];
+                state.peer = peer;
+                state.isOutbound = true;
+                state.deadline = std::chrono::steady_clock::now() + HANDSHAKE_TIMEOUT;
+                break;
+            }
+
+            case CommandType::Send:
+            {
+                // Rien ne part sur un lien avant la fin de l'authentification
+                auto it = m_links.find(command.link);
+                if (it == m_links.end() || !it->second.isAuthenticated)
+                    return;
+
+                ENetPacket* packet = enet_packet_create(command.data.data(), command.data.size(), ENET_PACKET_FLAG_RELIABLE);
+                if (enet_peer_send(it->second.peer, 0, packet) < 0)
+                {
+                    enet_packet_destroy(packet);
+                }
+                break;
+            }
+
+            case CommandType::Disconnect:
+            {
+                // La deconnexion est confirmee par un evenement DISCONNECT, qui retire le lien
+                auto it = m_links.find(command.link);
+                if (it != m_links.end())
+                {
+                    enet_peer_disconnect_later(it->second.peer, 0);
+                }
+                break;
+            }
+        }
+    }
+
+    bool ControlHost::Authenticate(ControlLinkId link, Link& state, const ENetPacket* packet)
+    {
+        if (state.isOutbound)
+        {
+            // 1. Defi de l'accepteur : prouver le secret et le defier en retour
+            if (const auto* challenge = ReadAuthPayload<ControlChallenge>(packet, Opcode_S2S_ControlChallenge))
+            {
+                if (!HasSize(challenge->nonce(), NONCE_SIZE))
+                    return false;
+
+                const Mac mac = ComputeMac(MAC_TAG_HELLO, challenge->nonce()->data(), NONCE_SIZE);
+                randombytes_buf(state.nonce.data(), state.nonce.size());
+
+                SendNow(state.peer, Opcode_S2S_ControlHello, [&](flatbuffers::FlatBufferBuilder& fbb)
+                {
+                    auto macVector = fbb.CreateVector(mac.data(), mac.size());
+                    auto nonce = fbb.CreateVector(state.nonce.data(), state.nonce.size());
+                    ControlHelloBuilder hello(fbb);
+                    hello.add_mac(macVector);
+                    hello.add_nonce(nonce);
+                    fbb.Finish(hello.Finish());
+                });
+                return true;
+            }
+
+            // 3. Preuve de l'accepteur : le lien est ouvert
+            const auto* welcome = ReadAuthPayload<ControlWelcome>(packet, Opcode_S2S_ControlWelcome);
+            if (!welcome || !HasSize(welcome->mac(), std::tuple_size_v<Mac>))
+                return false;
+
+            const Mac expected = ComputeMac(MAC_TAG_WELCOME, state.nonce.data(), state.nonce.size());
+            if (sodium_memcmp(expected.data(), welcome->mac()->data(), expected.size()) != 0)
+                return false;
+
+            state.isAuthenticated = true;
+            m_events.Push(Event{ EventType::Connected, link, {}, GetRemoteAddress(state.peer) });
+            return true;
+        }
+
+        // 2. Cote accepteur : reponse au defi, puis preuve en retour
+        const auto* hello = ReadAuthPayload<ControlHello>(packet, Opcode_S2S_ControlHello);
+        if (!hello || !HasSize(hello->mac(), std::tuple_size_v<Mac>) || !HasSize(hello->nonce(), NONCE_SIZE))
+            return false;
+
+        const Mac expected = ComputeMac(MAC_TAG_HELLO, state.nonce.data(), state.nonce.size());
+        if (sodium_memcmp(expected.data(), hello->mac()->data(), expected.size()) != 0)
+            return false;
+
+        const Mac mac = ComputeMac(MAC_TAG_WELCOME, hello->nonce()->data(), NONCE_SIZE);
+        SendNow(state.peer, Opcode_S2S_ControlWelcome, [&](flatbuffers::FlatBufferBuilder& fbb)
+        {
+            auto macVector = fbb.CreateVector(mac.data(), mac.size());
+            ControlWelcomeBuilder welcome(fbb);
+            welcome.add_mac(macVector);
+            fbb.Finish(welcome.Finish());
+        });
+
+        state.isAuthenticated = true;
+        m_events.Push(Event{ EventType::Connected, link, {}, GetRemoteAddress(state.peer) });
+        return true;
+    }
+
+    void ControlHost::Reject(ControlLinkId link, const char* reason)
+    {
+        auto it = m_links.find(link);
+        if (it == m_links.end())
+            return;
+
+        const ControlAddress remote = GetRemoteAddress(it->second.peer);
+        LOG_WARN("ControlHost: lien {}:{} ferme ({})", remote.ip, remote.port, reason);
+
+        // disconnect_now ne produit pas d'evenement DISCONNECT : le lien est retire ici
+        SetLinkId(it->second.peer, INVALID_CONTROL_LINK);
+        enet_peer_disconnect_now(it->second.peer, 0);
+
+        const bool isKnown = it->second.isOutbound;
+        m_links.erase(it);
+        if (isKnown)
+            m_events.Push(Event{ EventType::Disconnected, link, {} });
+    }
+
+    ControlHost::Mac ControlHost::ComputeMac(uint8_t tag, const uint8_t* nonce, size_t size) const
+    {
+        Mac mac{};
+        crypto_auth_hmacsha256_state state;
+        crypto_auth_hmacsha256_init(&state, reinterpret_cast<const unsigned char*>(m_secret.data()), m_secret.size());
+        crypto_auth_hmacsha256_update(&state, &tag, 1);
+        crypto_auth_hmacsha256_update(&state, nonce, size);
+        crypto_auth_hmacsha256_final(&state, mac.data());
+        return mac;
+    }
+
+    void ControlHost::Dispatch(ControlLinkId link, const std::vector<uint8_t>& data)
+    {
+        flatbuffers::Verifier verifier(data.data(), data.size());
+        if (!VerifyEnvelopeBuffer(verifier))
+        {
+            LOG_ERROR("ControlHost: message ignore (structure FlatBuffer invalide)");
+            return;
+        }
+
+        const Envelope* envelope = GetEnvelope(data.data());
+        if (!envelope)
+            return;
+
+        auto it = m_handlers.find(envelope->opcode());
+        if (it != m_handlers.end())
+        {
+            it->second(link, envelope->payload_data());
+        }
+        else
+        {
+            LOG_WARN("ControlHost: aucun handler pour l'Opcode {}", static_cast<uint16_t>(envelope->opcode()));
+        }
+    }
+}
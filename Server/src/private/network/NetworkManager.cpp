@@ -40,6 +40,8 @@ namespace MMO::Network
 
     void NetworkManager::Shutdown() 
     {
+        m_recorder.Close();
+
         if (m_host != nullptr) 
         {
             enet_host_destroy(m_host);
@@ -53,6 +55,12 @@ namespace MMO::Network
     // Traite les evenements ENet (connexion, reception, deconnexion)
     void NetworkManager::ProcessEvents() 
     {
+        if (m_replayReader)
+        {
+            ProcessReplayEvents();
+            return;
+        }
+
         if (!m_host)
             return;
 
@@ -86,12 +94,14 @@ namespace MMO::Network
     // Nouvelle connexion - cree une session via le SessionManager
     void NetworkManager::HandleConnect(const ENetEvent& event) 
     {
+        m_recorder.RecordConnect(event.peer->connectID);
         m_sessionManager.OnConnect(event.peer);
     }
 
     // Paquet recu - deserialise et dispatch vers le bon handler
     void NetworkManager::HandleReceive(const ENetEvent& event) 
     {
+        m_recorder.RecordReceive(event.peer->connectID, event.packet->data, event.packet->dataLength);
         m_dispatcher.Dispatch(event.peer, event.packet->data, event.packet->dataLength);
         enet_packet_destroy(event.packet);
     }
@@ -99,9 +109,75 @@ namespace MMO::Network
     // Deconnexion - supprime la session et notifie le GameLoop
     void NetworkManager::HandleDisconnect(const ENetEvent& event) 
     {
+        m_recorder.RecordDisconnect(event.peer->connectID);
         m_sessionManager.OnDisconnect(event.peer);
     }
 
+    bool NetworkManager::StartRecording(const std::string& path, uint16_t tickRate)
+    {
+        return m_recorder.Open(path, tickRate);
+    }
+
+    bool NetworkManager::StartReplay(const std::string& path)
+    {
+        auto reader = std::make_unique<TrafficReader>();
+        if (!reader->Open(path))
+            return false;
+
+        m_replayReader = std::move(reader);
+        m_hasReplayEvent = m_replayReader->Next(m_replayEvent);
+
+        LOG_INFO("Replay du trafic depuis '{}' (TickRate enregistre: {})", path, m_replayReader->GetTickRate());
+        return true;
+    }
+
+    void NetworkManager::SetCurrentTick(uint64_t tick)
+    {
+        m_currentTick = tick;
+        m_recorder.SetTick(tick);
+    }
+
+    // Meme chemin que les evenements ENet (session, dispatch) : seul le socket est remplace
+    void NetworkManager::ProcessReplayEvents()
+    {
+        while (m_hasReplayEvent && m_replayEvent.tick <= m_currentTick)
+        {
+            ENetEvent event{};
+            event.peer = GetReplayPeer(m_replayEvent.peerID);
+
+            switch (m_replayEvent.type)
+            {
+                case TrafficEventType::Connect:
+                    HandleConnect(event);
+                    break;
+
+                case TrafficEventType::Receive:
+                    // Copie dans un vrai ENetPacket : HandleReceive le libere comme en production
+                    event.packet = enet_packet_create(m_replayEvent.payload.data(), m_replayEvent.payload.size(), 0);
+                    HandleReceive(event);
+                    break;
+
+                case TrafficEventType::Disconnect:
+                    HandleDisconnect(event);
+                    break;
+            }
+
+            m_hasReplayEvent = m_replayReader->Next(m_replayEvent);
+        }
+    }
+
+    ENetPeer* NetworkManager::GetReplayPeer(uint32_t peerID)
+    {
+        auto& peer = m_replayPeers[peerID];
+        if (!peer)
+        {
+            // Etat DISCONNECTED : enet_peer_send refuse les paquets sans acceder a un host
+            peer = std::make_unique<ENetPeer>();
+            peer->connectID = peerID;
+        }
+        return peer.get();
+    }
+
     
     // Envoie un paquet a un client specifique
     void NetworkManager::SendPacket(ENetPeer* peer, std::span<const uint8_t> data, bool reliable) 
@@ -112,7 +188,11 @@ namespace MMO::Network
         uint32_t flags = reliable ? ENET_PACKET_FLAG_RELIABLE : ENET_PACKET_FLAG_UNSEQUENCED;
         ENetPacket* packet = enet_packet_create(data.data(), data.size(), flags);
         
-        enet_peer_send(peer, 0, packet);
+        if (enet_peer_send(peer, 0, packet) < 0)
+        {
+            // Peer non connecte : ENet ne prend pas possession du paquet
+            enet_packet_destroy(packet);
+        }
     }
 
     // Envoie un paquet a tous les clients connectes
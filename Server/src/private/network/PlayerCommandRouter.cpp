@@ -0,0 +1,57 @@
+#include "network/PlayerCommandRouter.h"
+#include "world/KingdomWorld.h"
+#include "utils/Logger.h"
+
+
+namespace MMO::Network
+{
+    PlayerCommandRouter::PlayerCommandRouter(PacketDispatcher& dispatcher, SessionManager& sessionManager,
+        std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>>& kingdoms)
+        : m_dispatcher(dispatcher), m_sessionManager(sessionManager), m_kingdoms(kingdoms)
+    {
+    }
+
+    void PlayerCommandRouter::RegisterHandler(Opcode opcode, const char* name, PlayerCommandHandler handler)
+    {
+        if (m_handlers.contains(opcode))
+        {
+            LOG_WARN("PlayerCommandRouter: un handler est deja enregistre pour l'Opcode {}", static_cast<uint16_t>(opcode));
+            return;
+        }
+        m_handlers[opcode] = std::move(handler);
+
+        m_dispatcher.RegisterHandler(opcode, [this, opcode, name](ENetPeer* peer, const flatbuffers::Vector<uint8_t>* payload)
+        {
+            if (!payload)
+                return;
+
+            auto* session = m_sessionManager.GetSession(peer);
+            if (!session || session->kingdomId < 0 || session->entityID == MMO::INVALID_ENTITY)
+            {
+                LOG_WARN("{}: peer non authentifie ou pas dans un royaume (PeerID: {})", name, peer->connectID);
+                return;
+            }
+
+            std::span<const uint8_t> bytes(payload->data(), payload->size());
+            auto kIt = m_kingdoms.find(session->kingdomId);
+            if (kIt == m_kingdoms.end())
+            {
+                if (m_onDefer)
+                    m_onDefer(*session, opcode, bytes);
+                return;
+            }
+
+            m_handlers[opcode](PlayerCommand{ peer, kIt->second.get(), session->entityID, session->kingdomId, session->playerID }, bytes);
+        });
+    }
+
+    bool PlayerCommandRouter::Apply(Opcode opcode, const PlayerCommand& command, std::span<const uint8_t> payload) const
+    {
+        auto it = m_handlers.find(opcode);
+        if (it == m_handlers.end())
+            return false;
+
+        it->second(command, payload);
+        return true;
+    }
+}
@@ -0,0 +1,189 @@
+#include "network/ReplicationManager.h"
+#include "network/PacketBuilder.h"
+#include "world/KingdomWorld.h"
+#include "ecs/PlayerComponents.h"
+#include "ecs/MovementComponents.h"
+#include "ecs/CombatComponents.h"
+#include "Movement_generated.h"
+#include "Combat_generated.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <iterator>
+
+
+namespace MMO::Network
+{
+    // Etat complet de deplacement d'une entite
+    static flatbuffers::Offset<Movement::MovementSnapshot> BuildSnapshot(flatbuffers::FlatBufferBuilder& fbb,
+        const entt::registry& registry, entt::entity entity)
+    {
+        const auto& position = registry.get<ECS::PositionComponent>(entity);
+        const auto* velocity = registry.try_get<ECS::VelocityComponent>(entity);
+
+        Movement::Vector2D currentPos(position.x, position.y);
+        Movement::Vector2D currentVelocity = velocity ? Movement::Vector2D(velocity->x, velocity->y) : Movement::Vector2D();
+
+        Movement::MovementSnapshotBuilder builder(fbb);
+        builder.add_entity_id(static_cast<uint32_t>(entity));
+        builder.add_current_pos(&currentPos);
+        builder.add_velocity(&currentVelocity);
+        builder.add_is_moving(velocity != nullptr);
+        return builder.Finish();
+    }
+
+    void ReplicationManager::Replicate(const SessionManager& sessionManager,
+        std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>>& kingdoms)
+    {
+        m_tick++;
+
+        for (const auto& [peerID, session] : sessionManager.GetAllSessions())
+        {
+            if (session.kingdomId < 0 || session.entityID == MMO::INVALID_ENTITY || !session.peer)
+                continue;
+
+            auto kIt = kingdoms.find(session.kingdomId);
+            if (kIt == kingdoms.end())
+                continue;
+
+            auto& view = m_views[peerID];
+            if (view.kingdomId != session.kingdomId)
+            {
+                // Nouveau royaume : tout est a renvoyer
+                view.kingdomId = session.kingdomId;
+                view.visible.clear();
+            }
+            view.lastTick = m_tick;
+
+            ReplicateClient(session, *kIt->second, view);
+            SendCombatEvents(session, kIt->second->GetRegistry());
+        }
+
+        // Clients deconnectes ou sortis d'un royaume
+        std::erase_if(m_views, [this](const auto& entry) { return entry.second.lastTick != m_tick; });
+
+        // Les marqueurs de mouvement et les bilans ne valent que pour ce tick
+        for (auto& [id, world] : kingdoms)
+        {
+            world->GetRegistry().clear<ECS::MovementDirtyTag>();
+            world->GetRegistry().clear<ECS::CombatReportComponent>();
+        }
+    }
+
+    void ReplicationManager::ReplicateClient(const PlayerSession& session, MMO::Core::KingdomWorld& world, ClientView& view)
+    {
+        auto& registry = world.GetRegistry();
+        if (!registry.valid(session.entityID) || !registry.all_of<ECS::PositionComponent>(session.entityID))
+            return;
+
+        // Ensemble visible de ce tick : 3x3 cellules autour du joueur
+        const auto& center = registry.get<ECS::PositionComponent>(session.entityID);
+        m_current.clear();
+        world.GetSpatialGrid().QueryNeighbors(center.x, center.y, m_current);
+
+        std::erase_if(m_current, [&registry](entt::entity entity)
+        {
+            return !registry.valid(entity) || !registry.all_of<ECS::PositionComponent>(entity);
+        });
+        std::sort(m_current.begin(), m_current.end());
+
+        // Differences avec le tick precedent
+        m_entered.clear();
+        m_left.clear();
+        m_updated.clear();
+        std::set_difference(m_current.begin(), m_current.end(), view.visible.begin(), view.visible.end(), std::back_inserter(m_entered));
+        std::set_difference(view.visible.begin(), view.visible.end(), m_current.begin(), m_current.end(), std::back_inserter(m_left));
+        std::set_intersection(m_current.begin(), m_current.end(), view.visible.begin(), view.visible.end(), std::back_inserter(m_updated));
+
+        std::erase_if(m_updated, [&registry](entt::entity entity) { return !registry.all_of<ECS::MovementDirtyTag>(entity); });
+
+        view.visible.swap(m_current);
+
+        if (m_entered.empty() && m_left.empty() && m_updated.empty())
+            return;
+
+        // Entrees, sorties et arrets doivent arriver : fiable. Les positions en marche sont remplacees au tick suivant
+        bool reliable = !m_entered.empty() || !m_left.empty()
+            || std::any_of(m_updated.begin(), m_updated.end(), [&registry](entt::entity entity)
+               {
+                   return !registry.all_of<ECS::VelocityComponent>(entity);
+               });
+
+        size_t payloadSize = 0;
+        PacketBuilder::SendResponse(session.peer, Opcode_S2C_ReplicationBatch,
+            [&](flatbuffers::FlatBufferBuilder& fbb)
+            {
+                std::vector<flatbuffers::Offset<Movement::MovementSnapshot>> entered;
+                entered.reserve(m_entered.size());
+                for (auto entity : m_entered)
+                    entered.push_back(BuildSnapshot(fbb, registry, entity));
+
+                std::vector<flatbuffers::Offset<Movement::MovementSnapshot>> updated;
+                updated.reserve(m_updated.size());
+                for (auto entity : m_updated)
+                    updated.push_back(BuildSnapshot(fbb, registry, entity));
+
+                std::vector<uint32_t> left;
+                left.reserve(m_left.size());
+                for (auto entity : m_left)
+                    left.push_back(static_cast<uint32_t>(entity));
+
+                auto enteredVec = fbb.CreateVector(entered);
+                auto leftVec = fbb.CreateVector(left);
+                auto updatedVec = fbb.CreateVector(updated);
+
+                Movement::ReplicationBatchBuilder builder(fbb);
+                builder.add_entered(enteredVec);
+                builder.add_left(leftVec);
+                builder.add_updated(updatedVec);
+                fbb.Finish(builder.Finish());
+
+                payloadSize = fbb.GetSize();
+            }, reliable);
+
+        m_stats.batches++;
+        m_stats.bytes += payloadSize;
+        m_stats.entered += m_entered.size();
+        m_stats.left += m_left.size();
+        m_stats.updated += m_updated.size();
+    }
+
+    void ReplicationManager::SendCombatEvents(const PlayerSession& session, const entt::registry& registry)
+    {
+        const auto* combat = registry.valid(session.entityID)
+            ? registry.try_get<ECS::CombatReportComponent>(session.entityID) : nullptr;
+        if (!combat || combat->reports.empty())
+            return;
+
+        PacketBuilder::SendResponse(session.peer, Opcode_S2C_CombatEvents,
+            [&](flatbuffers::FlatBufferBuilder& fbb)
+            {
+                std::vector<Combat::CombatEvent> events;
+                events.reserve(combat->reports.size());
+                for (const auto& report : combat->reports)
+                {
+                    events.emplace_back(report.battleId, static_cast<uint32_t>(report.target),
+                        static_cast<Combat::CombatEventKind>(report.kind),
+                        report.attackers, report.defenders, report.troops, report.losses);
+                }
+
+                auto eventsVec = fbb.CreateVectorOfStructs(events);
+                Combat::CombatEventsBuilder builder(fbb);
+                builder.add_events(eventsVec);
+                fbb.Finish(builder.Finish());
+            });
+
+        m_stats.combatBatches++;
+        m_stats.combatEvents += combat->reports.size();
+    }
+
+    void ReplicationManager::PrintStats() const
+    {
+        LOG_INFO("=== Replication AOI ===");
+        LOG_INFO("  Clients suivis: {} | Lots envoyes: {} | Octets: {} (moy {} o/lot)",
+            m_views.size(), m_stats.batches, m_stats.bytes,
+            m_stats.batches > 0 ? m_stats.bytes / m_stats.batches : 0);
+        LOG_INFO("  Entrees: {} | Sorties: {} | Mises a jour: {}", m_stats.entered, m_stats.left, m_stats.updated);
+        LOG_INFO("  Combat: {} lots, {} bilans", m_stats.combatBatches, m_stats.combatEvents);
+        LOG_INFO("=======================");
+    }
+}
@@ -150,6 +150,18 @@ namespace MMO::Network
             kingdomId, peer->connectID, it->second.playerID);
     }
 
+    void SessionManager::OnLeaveKingdom(ENetPeer* peer)
+    {
+        if (!peer) return;
+
+        auto it = m_sessions.find(peer->connectID);
+        if (it == m_sessions.end())
+            return;
+
+        it->second.kingdomId = -1;
+        it->second.entityID = INVALID_ENTITY;
+    }
+
     std::vector<const PlayerSession*> SessionManager::GetSessionsByKingdom(int kingdomId) const
     {
         std::vector<const PlayerSession*> result;
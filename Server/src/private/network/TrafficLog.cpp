@@ -0,0 +1,166 @@
+#include "network/TrafficLog.h"
+#include "utils/Logger.h"
+#include <cstring>
+
+
+namespace MMO::Network
+{
+    static constexpr char TRAFFIC_MAGIC[4] = { 'M', 'M', 'O', 'T' };
+    static constexpr uint16_t TRAFFIC_VERSION = 1;
+    static constexpr size_t WRITE_BUFFER_SIZE = 1 << 20;
+
+    // --- TrafficRecorder ---
+
+    bool TrafficRecorder::Open(const std::string& path, uint16_t tickRate)
+    {
+        Close();
+
+        // Le tampon doit etre installe avant l'ouverture du fichier
+        m_buffer.resize(WRITE_BUFFER_SIZE);
+        m_file.rdbuf()->pubsetbuf(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+        m_file.open(path, std::ios::binary | std::ios::trunc);
+        if (!m_file.is_open())
+        {
+            LOG_ERROR("Impossible de creer le fichier d'enregistrement reseau: {}", path);
+            return false;
+        }
+
+        m_file.write(TRAFFIC_MAGIC, sizeof(TRAFFIC_MAGIC));
+        m_file.write(reinterpret_cast<const char*>(&TRAFFIC_VERSION), sizeof(TRAFFIC_VERSION));
+        m_file.write(reinterpret_cast<const char*>(&tickRate), sizeof(tickRate));
+
+        m_currentTick = 0;
+        m_lastTick = 0;
+        m_eventCount = 0;
+
+        LOG_INFO("Enregistrement du trafic entrant dans '{}'", path);
+        return true;
+    }
+
+    void TrafficRecorder::Close()
+    {
+        if (!m_file.is_open())
+            return;
+
+        m_file.flush();
+        m_file.close();
+        LOG_INFO("Enregistrement reseau ferme ({} evenements).", m_eventCount);
+    }
+
+    void TrafficRecorder::RecordConnect(uint32_t peerID)
+    {
+        if (!IsOpen()) return;
+        WriteEventHeader(TrafficEventType::Connect, peerID);
+    }
+
+    void TrafficRecorder::RecordReceive(uint32_t peerID, const uint8_t* data, size_t size)
+    {
+        if (!IsOpen()) return;
+        WriteEventHeader(TrafficEventType::Receive, peerID);
+        WriteVarint(size);
+        m_file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    }
+
+    void TrafficRecorder::RecordDisconnect(uint32_t peerID)
+    {
+        if (!IsOpen()) return;
+        WriteEventHeader(TrafficEventType::Disconnect, peerID);
+    }
+
+    void TrafficRecorder::WriteEventHeader(TrafficEventType type, uint32_t peerID)
+    {
+        m_file.put(static_cast<char>(type));
+        WriteVarint(m_currentTick - m_lastTick);
+        WriteVarint(peerID);
+
+        m_lastTick = m_currentTick;
+        m_eventCount++;
+    }
+
+    void TrafficRecorder::WriteVarint(uint64_t value)
+    {
+        // LEB128 : 7 bits par octet, bit de poids fort = suite
+        while (value >= 0x80)
+        {
+            m_file.put(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        m_file.put(static_cast<char>(value));
+    }
+
+    // --- TrafficReader ---
+
+    bool TrafficReader::Open(const std::string& path)
+    {
+        m_file.open(path, std::ios::binary);
+        if (!m_file.is_open())
+        {
+            LOG_ERROR("Impossible d'ouvrir le fichier de replay: {}", path);
+            return false;
+        }
+
+        char magic[4] = {};
+        uint16_t version = 0;
+        m_file.read(magic, sizeof(magic));
+        m_file.read(reinterpret_cast<char*>(&version), sizeof(version));
+        m_file.read(reinterpret_cast<char*>(&m_tickRate), sizeof(m_tickRate));
+
+        if (!m_file || std::memcmp(magic, TRAFFIC_MAGIC, sizeof(magic)) != 0 || version != TRAFFIC_VERSION)
+        {
+            LOG_ERROR("Fichier de replay invalide ou version non supportee: {}", path);
+            m_file.close();
+            return false;
+        }
+
+        m_lastTick = 0;
+        return true;
+    }
+
+    bool TrafficReader::Next(TrafficEvent& out)
+    {
+        int type = m_file.get();
+        if (type == std::char_traits<char>::eof() || type > static_cast<int>(TrafficEventType::Disconnect))
+            return false;
+
+        uint64_t tickDelta = 0;
+        uint64_t peerID = 0;
+        if (!ReadVarint(tickDelta) || !ReadVarint(peerID))
+            return false;
+
+        m_lastTick += tickDelta;
+        out.tick = m_lastTick;
+        out.type = static_cast<TrafficEventType>(type);
+        out.peerID = static_cast<uint32_t>(peerID);
+        out.payload.clear();
+
+        if (out.type == TrafficEventType::Receive)
+        {
+            uint64_t size = 0;
+            if (!ReadVarint(size))
+                return false;
+
+            out.payload.resize(static_cast<size_t>(size));
+            m_file.read(reinterpret_cast<char*>(out.payload.data()), static_cast<std::streamsize>(size));
+            if (!m_file)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool TrafficReader::ReadVarint(uint64_t& value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            int byte = m_file.get();
+            if (byte == std::char_traits<char>::eof())
+                return false;
+
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,52 @@
+#include "network/handlers/CombatHandler.h"
+#include "world/KingdomWorld.h"
+#include "world/systems/CombatSystem.h"
+#include "ecs/PlayerComponents.h"
+#include "ecs/CombatComponents.h"
+#include "Combat_generated.h"
+#include "utils/Logger.h"
+#include <limits>
+
+
+namespace MMO::Network
+{
+    void RegisterCombatHandler(PlayerCommandRouter& router)
+    {
+        router.RegisterHandler(Opcode_C2S_AttackTarget, "AttackTarget",
+            [](const PlayerCommand& command, std::span<const uint8_t> payload)
+            {
+                auto req = flatbuffers::GetRoot<Combat::AttackTarget>(payload.data());
+                if (!req)
+                    return;
+
+                auto& registry = command.world->GetRegistry();
+                auto attacker = command.entity;
+                auto target = static_cast<entt::entity>(req->target_id());
+                if (target == attacker || !registry.valid(attacker) || !registry.valid(target)
+                    || !registry.all_of<ECS::ArmyComponent, ECS::PositionComponent>(target)
+                    || !registry.all_of<ECS::PositionComponent>(attacker))
+                {
+                    LOG_WARN("AttackTarget: cible {} refusee pour le joueur {}", req->target_id(), command.playerID);
+                    return;
+                }
+
+                // La cible doit etre a portee (zone visible du joueur)
+                const auto& from = registry.get<ECS::PositionComponent>(attacker);
+                const auto& to = registry.get<ECS::PositionComponent>(target);
+                float dx = to.x - from.x;
+                float dy = to.y - from.y;
+                if (dx * dx + dy * dy > ECS::ATTACK_RANGE * ECS::ATTACK_RANGE)
+                {
+                    LOG_WARN("AttackTarget: cible {} hors de portee pour le joueur {}", req->target_id(), command.playerID);
+                    return;
+                }
+
+                // Le serveur borne l'effectif aux troupes disponibles au moment de l'engagement
+                uint32_t troops = req->troops() > 0 ? req->troops() : std::numeric_limits<uint32_t>::max();
+                if (!Core::CombatSystem::QueueAttack(registry, attacker, target, troops))
+                {
+                    LOG_WARN("AttackTarget: aucune troupe disponible pour le joueur {}", command.playerID);
+                }
+            });
+    }
+}
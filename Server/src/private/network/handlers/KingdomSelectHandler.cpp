@@ -2,34 +2,69 @@
 #include "network/PacketBuilder.h"
 #include "world/KingdomWorld.h"
 #include "ecs/PlayerComponents.h"
+#include "ecs/CombatComponents.h"
+#include "core/Task.h"
 #include "Kingdom_generated.h"
 #include "Resources_generated.h"
 #include "utils/Logger.h"
+#include "utils/Time.h"
+#include <algorithm>
 
 
 namespace MMO::Network
 {
     // --- Helpers locaux ---
 
-    static void SendKingdomList(ENetPeer* peer,
-        const std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>>& kingdoms,
-        const SessionManager& sessionManager)
+    // Un royaume hiberne reste liste comme en ligne : il se reveille a la selection
+    // Un royaume distant (mode shard) porte l'adresse de son processus, et son etat vient du dernier bail lu
+    static void SendKingdomList(ENetPeer* peer, const std::vector<MMO::Core::KingdomInfo>& catalog,
+        const SessionManager& sessionManager, const MMO::Core::ShardDirectory* shards)
     {
+        // Un seul parcours des sessions, quel que soit le nombre de royaumes
+        std::unordered_map<int, int> playerCounts;
+        for (const auto& [peerID, session] : sessionManager.GetAllSessions())
+        {
+            if (session.kingdomId >= 0)
+                playerCounts[session.kingdomId]++;
+        }
+
         PacketBuilder::SendResponse(peer, Opcode_S2C_KingdomList,
-            [&kingdoms, &sessionManager](flatbuffers::FlatBufferBuilder& fbb)
+            [&catalog, &playerCounts, shards](flatbuffers::FlatBufferBuilder& fbb)
             {
                 std::vector<flatbuffers::Offset<KingdomEntry>> entries;
-                for (const auto& [id, world] : kingdoms)
+                for (const auto& info : catalog)
                 {
-                    auto sessions = sessionManager.GetSessionsByKingdom(id);
-                    auto nameOffset = fbb.CreateString(world->GetName());
+                    // Local : ip vide, le client reste sur cette connexion
+                    Core::ShardEndpoint endpoint;
+                    int playerCount = 0;
+                    bool isOnline = true;
+                    if (shards && !shards->IsLocal(info.id))
+                    {
+                        auto owner = shards->FindOwner(info.id);
+                        isOnline = owner.has_value();
+                        if (owner)
+                        {
+                            endpoint = owner->endpoint;
+                            playerCount = owner->playerCount;
+                        }
+                    }
+                    else if (auto countIt = playerCounts.find(info.id); countIt != playerCounts.end())
+                    {
+                        playerCount = countIt->second;
+                    }
+
+                    uint8_t status = !isOnline ? 0 : (playerCount >= info.maxPlayers ? 2 : 1); // Offline, Full, Online
+                    auto nameOffset = fbb.CreateString(info.name);
+                    auto ipOffset = fbb.CreateString(endpoint.ip);
 
                     KingdomEntryBuilder builder(fbb);
-                    builder.add_id(id);
+                    builder.add_id(info.id);
                     builder.add_name(nameOffset);
-                    builder.add_player_count(static_cast<int>(sessions.size()));
-                    builder.add_max_players(1000);
-                    builder.add_status(1); // Online
+                    builder.add_player_count(playerCount);
+                    builder.add_max_players(info.maxPlayers);
+                    builder.add_status(status);
+                    builder.add_ip(ipOffset);
+                    builder.add_port(endpoint.port);
                     entries.push_back(builder.Finish());
                 }
 
@@ -40,53 +75,206 @@ namespace MMO::Network
             });
     }
 
-    static void SendPlayerData(ENetPeer* peer, const Database::Account& account, const Database::PlayerData& data)
+    // Tout vient de l'entite : montants regles a l'entree (production hors ligne incluse)
+    static void SendPlayerData(ENetPeer* peer, const entt::registry& registry, entt::entity entity)
     {
+        const auto& info = registry.get<ECS::PlayerInfoComponent>(entity);
+        const auto& pos = registry.get<ECS::PositionComponent>(entity);
+        const auto& res = registry.get<ECS::ResourcesComponent>(entity);
+
         PacketBuilder::SendResponse(peer, Opcode_S2C_PlayerData,
-            [&account, &data](flatbuffers::FlatBufferBuilder& fbb)
+            [&info, &pos, &res](flatbuffers::FlatBufferBuilder& fbb)
             {
-                auto nameOffset = fbb.CreateString(account.username);
+                auto nameOffset = fbb.CreateString(Utils::Resolve(info.username));
                 PlayerDataBuilder builder(fbb);
-                builder.add_account_id(account.id);
+                builder.add_account_id(info.accountID);
                 builder.add_username(nameOffset);
-                builder.add_pos_x(data.posX);
-                builder.add_pos_y(data.posY);
-                builder.add_food(data.food);
-                builder.add_wood(data.wood);
-                builder.add_stone(data.stone);
-                builder.add_gold(data.gold);
+                builder.add_pos_x(pos.x);
+                builder.add_pos_y(pos.y);
+                builder.add_food(res.food.amount);
+                builder.add_wood(res.wood.amount);
+                builder.add_stone(res.stone.amount);
+                builder.add_gold(res.gold.amount);
                 fbb.Finish(builder.Finish());
             });
     }
 
+    // Ressources du profil DB, reglees a maintenant
+    static ECS::ResourcesComponent MakeResources(const Database::PlayerData& data)
+    {
+        // Stock jamais regle (ancienne base) : la production demarre maintenant
+        int64_t nowMs = Time::UnixMilliseconds();
+        auto settledAt = [nowMs](int64_t storedMs) { return storedMs > 0 ? storedMs : nowMs; };
+
+        ECS::ResourcesComponent res{
+            ECS::ResourceStock{ data.food,  data.foodRate,  settledAt(data.foodSettledAtMs) },
+            ECS::ResourceStock{ data.wood,  data.woodRate,  settledAt(data.woodSettledAtMs) },
+            ECS::ResourceStock{ data.stone, data.stoneRate, settledAt(data.stoneSettledAtMs) },
+            ECS::ResourceStock{ data.gold,  data.goldRate,  settledAt(data.goldSettledAtMs) } };
+        res.SettleAll(nowMs);
+        return res;
+    }
+
     static entt::entity CreatePlayerEntity(entt::registry& registry, SessionManager& sessionManager,
         ENetPeer* peer, const Database::Account& account, const Database::PlayerData& data)
     {
         auto entity = registry.create();
 
         registry.emplace<ECS::PlayerInfoComponent>(entity,
-            ECS::PlayerInfoComponent{ peer->connectID, account.id, account.username });
+            ECS::PlayerInfoComponent{ peer->connectID, account.id, Utils::Intern(account.username) });
         
         registry.emplace<ECS::PositionComponent>(entity,
             ECS::PositionComponent{ data.posX, data.posY });
         
-        registry.emplace<ECS::ResourcesComponent>(entity,
-            ECS::ResourcesComponent{ data.food, data.wood, data.stone, data.gold });
+        registry.emplace<ECS::ResourcesComponent>(entity, MakeResources(data));
+
+        // Armee sauvegardee avec le profil (pertes comprises)
+        ECS::ArmyComponent army;
+        army.troops = static_cast<uint32_t>(std::max(0, data.troops));
+        registry.emplace<ECS::ArmyComponent>(entity, army);
 
         return entity;
     }
 
+    // Rattache une entite restauree par snapshot a la nouvelle session
+    // dbData : profil relu en DB (snapshot periodique, la DB peut etre plus recente), nullptr apres un snapshot d'arret
+    static void ResumeRestoredPlayer(entt::registry& registry, entt::entity entity, ENetPeer* peer,
+        const Database::PlayerData* dbData)
+    {
+        registry.get<ECS::PlayerInfoComponent>(entity).playerID = peer->connectID;
+
+        if (dbData)
+        {
+            registry.emplace_or_replace<ECS::ResourcesComponent>(entity, MakeResources(*dbData));
+            // La DB compte les blesses comme gueris : leurs timers restaures ne rendront plus rien
+            auto& army = registry.get_or_emplace<ECS::ArmyComponent>(entity);
+            army.troops = static_cast<uint32_t>(std::max(0, dbData->troops));
+            army.wounded = 0;
+        }
+        else if (auto* res = registry.try_get<ECS::ResourcesComponent>(entity))
+        {
+            res->SettleAll(Time::UnixMilliseconds());
+        }
+    }
+
+    // Charge le compte et le profil (creation auto si absent), puis fait entrer le joueur dans le royaume
+    // Les deux lectures partent ensemble dans la file DB, en meme temps que le reveil du royaume s'il est hiberne
+    // un seul passage par le main thread, pour toucher a l'ECS et a la session
+    static Core::Task JoinKingdom(SessionManager& sessionManager,
+        std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>>& kingdoms,
+        KingdomLoader loadKingdom,
+        std::shared_ptr<Database::IAccountRepository> accountRepo,
+        std::shared_ptr<Database::IPlayerRepository> playerRepo,
+        Core::Executor runOnMainThread, uint32_t peerID, int accountId, int kingdomId)
+    {
+        Core::AsyncOperation<bool> kingdomOp([&](auto done)
+        {
+            loadKingdom(kingdomId, std::move(done));
+        });
+        Core::AsyncOperation<std::optional<Database::Account>> accountOp([&](auto done)
+        {
+            accountRepo->GetById(accountId, std::move(done));
+        });
+        Core::AsyncOperation<std::optional<Database::PlayerData>> playerDataOp([&](auto done)
+        {
+            playerRepo->GetByAccountAndKingdom(accountId, kingdomId, std::move(done));
+        });
+
+        // Le joueur attend la fin du reveil : il entre dans un royaume deja peuple
+        bool isKingdomReady = co_await kingdomOp;
+        auto& account = co_await accountOp;
+        auto& playerData = co_await playerDataOp;
+
+        if (!isKingdomReady)
+        {
+            LOG_ERROR("SelectKingdom: royaume {} indisponible", kingdomId);
+            co_return;
+        }
+
+        if (!account)
+        {
+            LOG_ERROR("SelectKingdom: compte {} introuvable", accountId);
+            co_return;
+        }
+
+        if (!playerData)
+        {
+            // Creer le profil automatiquement
+            LOG_INFO("SelectKingdom: creation auto du profil joueur (AccountID: {}, KingdomID: {})", accountId, kingdomId);
+            Core::AsyncOperation<std::optional<Database::PlayerData>> createOp([&](auto done)
+            {
+                playerRepo->Create(accountId, kingdomId, std::move(done));
+            });
+
+            playerData = std::move(co_await createOp);
+            if (!playerData)
+            {
+                LOG_ERROR("SelectKingdom: echec creation profil (AccountID: {})", accountId);
+                co_return;
+            }
+        }
+
+        co_await Core::SwitchTo(runOnMainThread);
+
+        ENetPeer* safePeer = sessionManager.FindPeer(peerID);
+        if (!safePeer) co_return;
+
+        auto kIt = kingdoms.find(kingdomId);
+        if (kIt == kingdoms.end()) co_return;
+
+        // Entite gardee hors ligne (bataille en cours) : elle fait foi, la DB n'a pas ses dernieres pertes
+        // Entite restauree (royaume reveille ou snapshot periodique) : reprise
+        // Les ressources de la DB ne l'emportent que si le snapshot peut etre plus ancien qu'elle
+        auto& registry = kIt->second->GetRegistry();
+        auto entity = kIt->second->ClaimOfflinePlayer(accountId);
+        if (entity != entt::null)
+        {
+            ResumeRestoredPlayer(registry, entity, safePeer, nullptr);
+        }
+        else if ((entity = kIt->second->ClaimRestoredPlayer(accountId)) != entt::null)
+        {
+            ResumeRestoredPlayer(registry, entity, safePeer,
+                kIt->second->IsRestoredStateClean() ? nullptr : &*playerData);
+        }
+        const bool isResumed = entity != entt::null;
+        if (!isResumed)
+        {
+            entity = CreatePlayerEntity(registry, sessionManager, safePeer, *account, *playerData);
+        }
+        sessionManager.OnJoinKingdom(safePeer, kingdomId, entity);
+
+        SendPlayerData(safePeer, registry, entity);
+        LOG_INFO("Joueur {} rejoint le royaume '{}' ({})",
+            account->username, kIt->second->GetName(), isResumed ? "entite reprise" : "entite creee");
+    }
+
+    void SendKingdomRedirect(ENetPeer* peer, int kingdomId, const Core::ShardEndpoint& endpoint)
+    {
+        PacketBuilder::SendResponse(peer, Opcode_S2C_KingdomRedirect,
+            [kingdomId, &endpoint](flatbuffers::FlatBufferBuilder& fbb)
+            {
+                auto ipOffset = fbb.CreateString(endpoint.ip);
+                KingdomRedirectBuilder builder(fbb);
+                builder.add_kingdom_id(kingdomId);
+                builder.add_ip(ipOffset);
+                builder.add_port(endpoint.port);
+                fbb.Finish(builder.Finish());
+            });
+    }
+
     // --- Enregistrement des handlers ---
 
     void RegisterKingdomSelectHandler(PacketDispatcher& dispatcher, SessionManager& sessionManager,
         std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>>& kingdoms,
+        const std::vector<MMO::Core::KingdomInfo>& catalog, KingdomLoader loadKingdom,
+        const MMO::Core::ShardDirectory* shards,
         std::shared_ptr<Database::IAccountRepository> accountRepo,
         std::shared_ptr<Database::IPlayerRepository> playerRepo,
         std::function<void(std::function<void()>)> runOnMainThread)
     {
         // C2S_RequestKingdoms → S2C_KingdomList
         dispatcher.RegisterHandler(Opcode_C2S_RequestKingdoms,
-            [&kingdoms, &sessionManager](ENetPeer* peer, const flatbuffers::Vector<uint8_t>* /*payload*/)
+            [&catalog, &sessionManager, shards](ENetPeer* peer, const flatbuffers::Vector<uint8_t>* /*payload*/)
             {
                 auto* session = sessionManager.GetSession(peer);
                 if (!session || !session->isAuthenticated)
@@ -96,14 +284,14 @@ namespace MMO::Network
                 }
 
                 LOG_INFO("Envoi de la liste des royaumes ({} royaumes) au joueur {}",
-                    kingdoms.size(), session->playerID);
+                    catalog.size(), session->playerID);
 
-                SendKingdomList(peer, kingdoms, sessionManager);
+                SendKingdomList(peer, catalog, sessionManager, shards);
             });
 
         // C2S_SelectKingdom → charge le profil → cree l'entite → S2C_PlayerData
         dispatcher.RegisterHandler(Opcode_C2S_SelectKingdom,
-            [&kingdoms, &sessionManager, accountRepo, playerRepo, runOnMainThread]
+            [&kingdoms, &catalog, &sessionManager, loadKingdom, shards, accountRepo, playerRepo, runOnMainThread]
             (ENetPeer* peer, const flatbuffers::Vector<uint8_t>* payload)
             {
                 auto req = flatbuffers::GetRoot<SelectKingdom>(payload->data());
@@ -126,84 +314,57 @@ namespace MMO::Network
 
                 int kingdomId = req->kingdom_id();
 
-                // Verifier que le royaume existe
-                auto it = kingdoms.find(kingdomId);
-                if (it == kingdoms.end())
+                // Verifier que le royaume existe (resident ou hiberne)
+                auto infoIt = std::find_if(catalog.begin(), catalog.end(),
+                    [kingdomId](const MMO::Core::KingdomInfo& info) { return info.id == kingdomId; });
+                if (infoIt == catalog.end())
                 {
                     LOG_WARN("SelectKingdom: royaume {} introuvable", kingdomId);
                     return;
                 }
 
-                int accountId = static_cast<int>(session->playerID);
-                uint32_t peerID = peer->connectID;
+                // Heberge par un autre processus : le client s'y reconnecte
+                if (shards && !shards->IsLocal(kingdomId))
+                {
+                    auto owner = shards->FindOwner(kingdomId);
+                    if (!owner)
+                    {
+                        LOG_WARN("SelectKingdom: royaume {} hors ligne (aucun processus ne l'heberge)", kingdomId);
+                        return;
+                    }
+
+                    LOG_INFO("Joueur {} redirige vers {}:{} pour le royaume '{}'",
+                        session->playerID, owner->endpoint.ip, owner->endpoint.port, infoIt->name);
+                    SendKingdomRedirect(peer, kingdomId, owner->endpoint);
+                    return;
+                }
 
                 LOG_INFO("Joueur {} selectionne le royaume '{}' (ID: {})",
-                    accountId, it->second->GetName(), kingdomId);
+                    session->playerID, infoIt->name, kingdomId);
 
-                // Charger le compte depuis la DB
-                accountRepo->GetById(accountId, [playerRepo, runOnMainThread, &sessionManager, &kingdoms, peerID, accountId, kingdomId]
-                    (std::optional<Database::Account> account)
+                // Entite gardee hors ligne ou snapshot d'arret : l'entite est a jour, reprise immediate sans lecture DB
+                int accountId = static_cast<int>(session->playerID);
+                auto it = kingdoms.find(kingdomId);
+                if (it != kingdoms.end())
                 {
-                    if (!account)
+                    auto& world = *it->second;
+                    auto restored = world.ClaimOfflinePlayer(accountId);
+                    if (restored == entt::null && world.IsRestoredStateClean())
                     {
-                        LOG_ERROR("SelectKingdom: compte {} introuvable", accountId);
-                        return;
+                        restored = world.ClaimRestoredPlayer(accountId);
                     }
-
-                    // Charger les donnees joueur pour ce royaume
-                    playerRepo->GetByAccountAndKingdom(accountId, kingdomId, [playerRepo, runOnMainThread, &sessionManager, &kingdoms, peerID, account, kingdomId]
-                        (std::optional<Database::PlayerData> playerData)
+                    if (restored != entt::null)
                     {
-                        if (!playerData)
-                        {
-                            // Creer le profil automatiquement
-                            LOG_INFO("SelectKingdom: creation auto du profil joueur (AccountID: {}, KingdomID: {})", account->id, kingdomId);
-                            playerRepo->Create(account->id, kingdomId, [runOnMainThread, &sessionManager, &kingdoms, peerID, account, kingdomId]
-                                (std::optional<Database::PlayerData> newData)
-                            {
-                                if (!newData)
-                                {
-                                    LOG_ERROR("SelectKingdom: echec creation profil (AccountID: {})", account->id);
-                                    return;
-                                }
-                                runOnMainThread([&sessionManager, &kingdoms, peerID, account, newData, kingdomId]()
-                                {
-                                    ENetPeer* safePeer = sessionManager.FindPeer(peerID);
-                                    if (!safePeer) return;
-
-                                    auto kIt = kingdoms.find(kingdomId);
-                                    if (kIt == kingdoms.end()) return;
-
-                                    auto entity = CreatePlayerEntity(kIt->second->GetRegistry(), sessionManager, safePeer, *account, *newData);
-                                    sessionManager.OnJoinKingdom(safePeer, kingdomId, entity);
-                                    kIt->second->GetSpatialGrid().Insert(entity, newData->posX, newData->posY);
-
-                                    SendPlayerData(safePeer, *account, *newData);
-                                    LOG_INFO("Joueur {} rejoint le royaume '{}' (entite creee)",
-                                        account->username, kIt->second->GetName());
-                                });
-                            });
-                            return;
-                        }
+                        ResumeRestoredPlayer(world.GetRegistry(), restored, peer, nullptr);
+                        sessionManager.OnJoinKingdom(peer, kingdomId, restored);
+                        SendPlayerData(peer, world.GetRegistry(), restored);
+                        LOG_INFO("Joueur {} reprend son entite dans '{}'", accountId, world.GetName());
+                        return;
+                    }
+                }
 
-                        runOnMainThread([&sessionManager, &kingdoms, peerID, account, playerData, kingdomId]()
-                        {
-                            ENetPeer* safePeer = sessionManager.FindPeer(peerID);
-                            if (!safePeer) return;
-
-                            auto kIt = kingdoms.find(kingdomId);
-                            if (kIt == kingdoms.end()) return;
-
-                            auto entity = CreatePlayerEntity(kIt->second->GetRegistry(), sessionManager, safePeer, *account, *playerData);
-                            sessionManager.OnJoinKingdom(safePeer, kingdomId, entity);
-                            kIt->second->GetSpatialGrid().Insert(entity, playerData->posX, playerData->posY);
-
-                            SendPlayerData(safePeer, *account, *playerData);
-                            LOG_INFO("Joueur {} rejoint le royaume '{}' (entite creee)",
-                                account->username, kIt->second->GetName());
-                        });
-                    });
-                });
+                JoinKingdom(sessionManager, kingdoms, loadKingdom, accountRepo, playerRepo, runOnMainThread,
+                    peer->connectID, accountId, kingdomId);
             });
     }
 }
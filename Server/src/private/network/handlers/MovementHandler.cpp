@@ -0,0 +1,80 @@
+#include "network/handlers/MovementHandler.h"
+#include "network/PacketBuilder.h"
+#include "world/KingdomWorld.h"
+#include "world/systems/MovementSystem.h"
+#include "ecs/PlayerComponents.h"
+#include "ecs/MovementComponents.h"
+#include "Movement_generated.h"
+#include "utils/Logger.h"
+#include <cmath>
+
+
+namespace MMO::Network
+{
+    // Etat de deplacement autoritaire renvoye au client (position corrigee + vitesse)
+    static void SendMovementSnapshot(ENetPeer* peer, entt::registry& registry, entt::entity entity)
+    {
+        const auto& position = registry.get<ECS::PositionComponent>(entity);
+        const auto* velocity = registry.try_get<ECS::VelocityComponent>(entity);
+
+        PacketBuilder::SendResponse(peer, Opcode_S2C_MovementSnapshot,
+            [&](flatbuffers::FlatBufferBuilder& fbb)
+            {
+                Movement::Vector2D currentPos(position.x, position.y);
+                Movement::Vector2D currentVelocity = velocity ? Movement::Vector2D(velocity->x, velocity->y) : Movement::Vector2D();
+
+                Movement::MovementSnapshotBuilder builder(fbb);
+                builder.add_entity_id(static_cast<uint32_t>(entity));
+                builder.add_current_pos(&currentPos);
+                builder.add_velocity(&currentVelocity);
+                builder.add_is_moving(velocity != nullptr);
+                fbb.Finish(builder.Finish());
+            });
+    }
+
+    void RegisterMovementHandler(PlayerCommandRouter& router)
+    {
+        router.RegisterHandler(Opcode_C2S_MoveRequest, "MoveRequest",
+            [](const PlayerCommand& command, std::span<const uint8_t> payload)
+            {
+                auto req = flatbuffers::GetRoot<Movement::MoveRequest>(payload.data());
+                if (!req || !req->target_pos())
+                    return;
+
+                // Le client ne deplace que sa propre entite
+                auto entity = command.entity;
+                if (req->entity_id() != static_cast<uint32_t>(entity))
+                {
+                    LOG_WARN("MoveRequest: entite {} refusee pour le joueur {}", req->entity_id(), command.playerID);
+                    return;
+                }
+
+                float targetX = req->target_pos()->x();
+                float targetY = req->target_pos()->y();
+                if (!std::isfinite(targetX) || !std::isfinite(targetY))
+                    return;
+
+                auto& registry = command.world->GetRegistry();
+                if (!registry.valid(entity) || !registry.all_of<ECS::PositionComponent>(entity))
+                    return;
+
+                // Destination infranchissable : le client recoit sa position courante pour se recaler
+                const Core::WorldMap* map = command.world->GetMap();
+                if (map && !map->IsPassableAt(targetX, targetY))
+                {
+                    if (command.peer)
+                        SendMovementSnapshot(command.peer, registry, entity);
+                    return;
+                }
+
+                // Le serveur fixe la vitesse : le client ne choisit que la destination
+                // Sur une carte avec terrain, le chemin est calcule hors du tick et suivi a sa livraison
+                if (command.world->RequestPath(entity, targetX, targetY, ECS::DEFAULT_MOVE_SPEED))
+                    return;
+
+                Core::MovementSystem::SetDestination(registry, entity, targetX, targetY, ECS::DEFAULT_MOVE_SPEED);
+                if (command.peer)
+                    SendMovementSnapshot(command.peer, registry, entity);
+            });
+    }
+}
@@ -0,0 +1,124 @@
+#include "utils/MappedFile.h"
+#include "utils/Logger.h"
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+
+namespace MMO::Utils
+{
+#ifdef _WIN32
+
+    bool MappedFile::Open(const std::string& path)
+    {
+        Close();
+
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            LOG_ERROR("MappedFile: impossible d'ouvrir '{}' (erreur {})", path, GetLastError());
+            return false;
+        }
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            LOG_ERROR("MappedFile: '{}' est vide ou illisible", path);
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping)
+        {
+            LOG_ERROR("MappedFile: projection de '{}' impossible (erreur {})", path, GetLastError());
+            CloseHandle(file);
+            return false;
+        }
+
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view)
+        {
+            LOG_ERROR("MappedFile: vue de '{}' impossible (erreur {})", path, GetLastError());
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_fileHandle = file;
+        m_mappingHandle = mapping;
+        m_data = static_cast<const uint8_t*>(view);
+        m_size = static_cast<size_t>(size.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mappingHandle)
+            CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+        if (m_fileHandle)
+            CloseHandle(static_cast<HANDLE>(m_fileHandle));
+
+        m_data = nullptr;
+        m_size = 0;
+        m_mappingHandle = nullptr;
+        m_fileHandle = nullptr;
+    }
+
+#else
+
+    bool MappedFile::Open(const std::string& path)
+    {
+        Close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            LOG_ERROR("MappedFile: impossible d'ouvrir '{}'", path);
+            return false;
+        }
+
+        struct stat info{};
+        if (fstat(fd, &info) != 0 || info.st_size <= 0)
+        {
+            LOG_ERROR("MappedFile: '{}' est vide ou illisible", path);
+            ::close(fd);
+            return false;
+        }
+
+        void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd); // La projection reste valide apres fermeture du descripteur
+        if (view == MAP_FAILED)
+        {
+            LOG_ERROR("MappedFile: projection de '{}' impossible", path);
+            return false;
+        }
+
+        m_data = static_cast<const uint8_t*>(view);
+        m_size = static_cast<size_t>(info.st_size);
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+            munmap(const_cast<uint8_t*>(m_data), m_size);
+
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+#endif
+}
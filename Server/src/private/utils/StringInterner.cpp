@@ -0,0 +1,67 @@
+#include "utils/StringInterner.h"
+#include "utils/Logger.h"
+#include <mutex>
+
+
+namespace MMO::Utils
+{
+    StringInterner::StringInterner()
+    {
+        // Le handle 0 designe toujours la chaine vide
+        m_strings.emplace_back();
+        m_lookup.emplace(std::string_view{}, EMPTY_STRING_HANDLE);
+    }
+
+    StringInterner& StringInterner::Get()
+    {
+        static StringInterner instance;
+        return instance;
+    }
+
+    StringHandle StringInterner::Intern(std::string_view text)
+    {
+        {
+            std::shared_lock lock(m_mutex);
+            auto it = m_lookup.find(text);
+            if (it != m_lookup.end())
+                return it->second;
+        }
+
+        std::unique_lock lock(m_mutex);
+
+        // Un autre thread a pu l'ajouter entre les deux verrous
+        auto it = m_lookup.find(text);
+        if (it != m_lookup.end())
+            return it->second;
+
+        if (m_strings.size() >= UINT32_MAX)
+        {
+            LOG_ERROR("StringInterner: plus de handles disponibles");
+            return EMPTY_STRING_HANDLE;
+        }
+
+        auto handle = static_cast<StringHandle>(m_strings.size());
+        const std::string& stored = m_strings.emplace_back(text);
+        m_lookup.emplace(std::string_view{ stored }, handle);
+
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_bytes.fetch_add(stored.size(), std::memory_order_relaxed);
+        return handle;
+    }
+
+    StringHandle StringInterner::Find(std::string_view text) const
+    {
+        std::shared_lock lock(m_mutex);
+        auto it = m_lookup.find(text);
+        return it != m_lookup.end() ? it->second : EMPTY_STRING_HANDLE;
+    }
+
+    std::string_view StringInterner::Resolve(StringHandle handle) const
+    {
+        std::shared_lock lock(m_mutex);
+        if (handle >= m_strings.size())
+            return {};
+
+        return m_strings[handle];
+    }
+}
@@ -37,6 +37,9 @@ namespace MMO::Core
                 info.ip         = entry.at("ip").get<std::string>();
                 info.port       = entry.at("port").get<uint16_t>();
                 info.maxPlayers = entry.value("maxPlayers", 1000);
+                info.mapWidth   = entry.value("mapWidth", 0.0f);
+                info.mapHeight  = entry.value("mapHeight", 0.0f);
+                info.mapPath    = entry.value("map", std::string{});
                 info.status     = 1; // Online par defaut
 
                 newIndex[info.id] = newKingdoms.size();
@@ -1,26 +1,314 @@
 #include "world/KingdomWorld.h"
+#include "world/WorldSnapshot.h"
+#include "world/systems/MovementSystem.h"
+#include "ecs/PlayerComponents.h"
+#include "ecs/CombatComponents.h"
 #include "utils/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <format>
 
 
 namespace MMO::Core
 {
-    KingdomWorld::KingdomWorld(int id, const std::string& name)
+    KingdomWorld::KingdomWorld(int id, const std::string& name, float mapWidth, float mapHeight)
         : m_id(id), m_name(name)
+        , m_spatialGrid(mapWidth > 0.0f && mapHeight > 0.0f
+            ? SpatialGrid(GRID_CELL_SIZE, mapWidth, mapHeight)
+            : SpatialGrid(GRID_CELL_SIZE))
     {
-        LOG_INFO("Royaume '{}' (ID: {}) cree.", m_name, m_id);
+        m_spatialGrid.Connect(m_registry);
+
+        // Acces des systemes aux timers (CombatSystem : blesses)
+        m_registry.ctx().emplace<TimingWheel*>(&m_timers);
+
+        if (m_spatialGrid.IsDense())
+            LOG_INFO("Royaume '{}' (ID: {}) cree (carte {}x{}, grille dense).", m_name, m_id, mapWidth, mapHeight);
+        else
+            LOG_INFO("Royaume '{}' (ID: {}) cree.", m_name, m_id);
+    }
+
+    KingdomWorld::~KingdomWorld()
+    {
+        // La grille est detruite avant la registry : plus aucun signal ne doit l'atteindre
+        m_spatialGrid.Disconnect(m_registry);
     }
 
     void KingdomWorld::OnTick(float dt)
     {
-        for (auto& system : m_systems)
+        ScopedTimer tickTimer(m_tickHistogram);
+
+        // Chemins termines depuis le tick precedent : suivis des ce tick
+        ApplyPathResults();
+
+        // Timers avant les systemes : leurs effets sont visibles des ce tick
+        {
+            ScopedTimer timersTimer(m_timersHistogram);
+            m_timers.Advance(dt);
+        }
+
+        UpdateDueSystems(dt);
+
+        for (const auto& batch : m_batches)
+        {
+            m_dueScratch.clear();
+            for (size_t index : batch)
+            {
+                if (m_systems[index].isDue)
+                    m_dueScratch.push_back(index);
+            }
+
+            if (!m_jobPool || m_dueScratch.size() <= 1)
+            {
+                for (size_t index : m_dueScratch)
+                    RunSystem(m_systems[index]);
+                continue;
+            }
+
+            // Aucune creation de storage pendant l'execution parallele
+            for (size_t index : m_dueScratch)
+                m_systems[index].access.PrepareStorages(m_registry);
+
+            m_jobPool->ParallelFor(m_dueScratch.size(), [this](size_t i)
+            {
+                RunSystem(m_systems[m_dueScratch[i]]);
+            });
+        }
+
+        // Un seul re-rangement par tick : entrees, deplacements et sorties des handlers et des systemes
+        {
+            ScopedTimer gridTimer(m_gridHistogram);
+            m_spatialGrid.ApplyBatch(m_registry);
+        }
+    }
+
+    bool KingdomWorld::RequestPath(entt::entity entity, float goalX, float goalY, float speed)
+    {
+        if (!m_map || !m_pathfinding)
+            return false;
+
+        const auto* position = m_registry.try_get<ECS::PositionComponent>(entity);
+        if (!position)
+            return false;
+
+        uint32_t requestId = m_nextPathRequestId++;
+        m_registry.emplace_or_replace<ECS::PathRequestComponent>(entity, ECS::PathRequestComponent{ requestId, speed });
+
+        // La carte partagee et la boite de reception restent en vie tant que le job tourne
+        m_pathfinding->Submit(m_map, m_pathInbox, entity, requestId, position->x, position->y, goalX, goalY);
+        return true;
+    }
+
+    void KingdomWorld::ApplyPathResults()
+    {
+        while (auto result = m_pathInbox->TryPop())
+        {
+            if (!m_registry.valid(result->entity))
+                continue;
+
+            const auto* request = m_registry.try_get<ECS::PathRequestComponent>(result->entity);
+            if (!request || request->requestId != result->requestId)
+                continue; // Entite recyclee ou nouvelle destination demandee entre-temps
+
+            float speed = request->speed;
+            m_registry.remove<ECS::PathRequestComponent>(result->entity);
+
+            // Chemin introuvable : liste vide, l'entite s'arrete
+            MovementSystem::FollowPath(m_registry, result->entity, std::move(result->waypoints), speed);
+        }
+    }
+
+    std::vector<uint8_t> KingdomWorld::CaptureSnapshot(bool isClean) const
+    {
+        // Des joueurs restaures d'un snapshot periodique, jamais repris, peuvent etre plus anciens que la DB :
+        // le fichier reste alors non fiable, meme ecrit a l'arret
+        bool isTrusted = m_restoredClean || m_restoredPlayers.empty();
+        return CaptureWorldSnapshot(m_registry, m_timers, m_id, isClean && isTrusted);
+    }
+
+    bool KingdomWorld::LoadSnapshot(const std::string& path)
+    {
+        WorldSnapshotInfo info;
+        if (!LoadWorldSnapshot(path, m_registry, m_timers, m_id, info))
+            return false;
+
+        OnSnapshotLoaded(info, path);
+        return true;
+    }
+
+    bool KingdomWorld::LoadSnapshot(std::span<const uint8_t> buffer, const std::string& source)
+    {
+        WorldSnapshotInfo info;
+        if (!LoadWorldSnapshot(buffer, source, m_registry, m_timers, m_id, info))
+            return false;
+
+        OnSnapshotLoaded(info, source);
+        return true;
+    }
+
+    void KingdomWorld::OnSnapshotLoaded(const WorldSnapshotInfo& info, const std::string& source)
+    {
+        // Les positions chargees sont deja en attente via les signaux : un seul passage remplit la grille
+        m_spatialGrid.ApplyBatch(m_registry);
+
+        m_restoredPlayers.clear();
+        for (auto [entity, player] : m_registry.view<ECS::PlayerInfoComponent>().each())
+        {
+            m_restoredPlayers[player.accountID] = entity;
+        }
+        m_restoredClean = info.isClean;
+
+        LOG_INFO("Royaume '{}' restaure depuis '{}' ({} entites, {} joueurs, snapshot {})",
+            m_name, source, info.entityCount, m_restoredPlayers.size(), info.isClean ? "propre" : "periodique");
+    }
+
+    entt::entity KingdomWorld::ClaimRestoredPlayer(int accountId)
+    {
+        auto it = m_restoredPlayers.find(accountId);
+        if (it == m_restoredPlayers.end())
+            return entt::null;
+
+        entt::entity entity = it->second;
+        m_restoredPlayers.erase(it);
+        return m_registry.valid(entity) ? entity : entt::null;
+    }
+
+    entt::entity KingdomWorld::ClaimOfflinePlayer(int accountId)
+    {
+        auto it = m_offlinePlayers.find(accountId);
+        if (it == m_offlinePlayers.end())
+            return entt::null;
+
+        entt::entity entity = it->second;
+        m_offlinePlayers.erase(it);
+        return m_registry.valid(entity) ? entity : entt::null;
+    }
+
+    bool KingdomWorld::HasActiveBattles() const
+    {
+        if (m_registry.view<const ECS::AttackOrderComponent>().size() > 0)
+            return true;
+
+        for (auto [entity, army] : m_registry.view<const ECS::ArmyComponent>().each())
+        {
+            if (army.deployed > 0)
+                return true;
+        }
+        return false;
+    }
+
+    void KingdomWorld::ReleaseOfflinePlayers(std::vector<entt::entity>& released)
+    {
+        for (auto it = m_offlinePlayers.begin(); it != m_offlinePlayers.end();)
         {
-            system->OnTick(dt, m_registry);
+            const auto* army = m_registry.valid(it->second) ? m_registry.try_get<ECS::ArmyComponent>(it->second) : nullptr;
+            if (army && army->deployed > 0)
+            {
+                ++it;
+                continue;
+            }
+
+            if (m_registry.valid(it->second))
+            {
+                released.push_back(it->second);
+            }
+            it = m_offlinePlayers.erase(it);
+        }
+    }
+
+    void KingdomWorld::UpdateDueSystems(float dt)
+    {
+        for (auto& entry : m_systems)
+        {
+            entry.accumulated += dt;
+            entry.isDue = false;
+
+            if (entry.interval <= 0.0f)
+            {
+                entry.isDue = true;
+                continue;
+            }
+
+            entry.countdown -= dt;
+            if (entry.countdown <= 0.0f)
+            {
+                entry.isDue = true;
+
+                // Conserve la phase ; apres un gros retard on repart d'une periode complete
+                entry.countdown += entry.interval;
+                if (entry.countdown <= 0.0f)
+                    entry.countdown = entry.interval;
+            }
         }
     }
 
+    void KingdomWorld::RunSystem(SystemEntry& entry)
+    {
+        ScopedTimer systemTimer(entry.histogram);
+
+        float dt = entry.accumulated;
+        entry.accumulated = 0.0f;
+        entry.system->OnTick(dt, m_registry);
+    }
+
     void KingdomWorld::AddSystem(std::unique_ptr<IGameSystem> system)
     {
         LOG_INFO("Royaume '{}': systeme '{}' enregistre.", m_name, system->GetName());
-        m_systems.push_back(std::move(system));
+
+        SystemEntry entry;
+        system->OnAttach(m_registry);
+        system->DeclareAccess(entry.access);
+        entry.histogram = m_profiler ? &m_profiler->Get("system." + system->GetName()) : nullptr;
+
+        float rate = system->GetUpdateRate();
+        if (rate > 0.0f)
+        {
+            // Phase dans [0, 1) par suite du nombre d'or : royaumes et systemes voisins tombent sur des ticks differents
+            double phase = static_cast<double>(m_id) * 0.6180339887 + static_cast<double>(m_systems.size()) * 0.4142135624;
+            phase -= std::floor(phase);
+
+            entry.interval = 1.0f / rate;
+            entry.countdown = entry.interval * static_cast<float>(phase);
+        }
+        entry.system = std::move(system);
+        m_systems.push_back(std::move(entry));
+
+        RebuildSchedule();
+    }
+
+    void KingdomWorld::RebuildSchedule()
+    {
+        // Niveau d'un systeme = 1 + niveau max des systemes precedents avec lesquels il est en conflit
+        std::vector<size_t> levels(m_systems.size(), 0);
+        size_t levelCount = 0;
+
+        for (size_t i = 0; i < m_systems.size(); ++i)
+        {
+            for (size_t j = 0; j < i; ++j)
+            {
+                if (m_systems[i].access.ConflictsWith(m_systems[j].access))
+                    levels[i] = std::max(levels[i], levels[j] + 1);
+            }
+            levelCount = std::max(levelCount, levels[i] + 1);
+        }
+
+        m_batches.assign(levelCount, {});
+        for (size_t i = 0; i < m_systems.size(); ++i)
+        {
+            m_batches[levels[i]].push_back(i);
+        }
+    }
+
+    void KingdomWorld::SetProfiler(TickProfiler* profiler)
+    {
+        m_profiler = profiler;
+        m_tickHistogram = profiler ? &profiler->Get(std::format("kingdom.{}.{}", m_id, m_name)) : nullptr;
+        m_timersHistogram = profiler ? &profiler->Get(std::format("kingdom.{}.timers", m_id)) : nullptr;
+        m_gridHistogram = profiler ? &profiler->Get(std::format("kingdom.{}.grid", m_id)) : nullptr;
+
+        for (auto& entry : m_systems)
+        {
+            entry.histogram = profiler ? &profiler->Get("system." + entry.system->GetName()) : nullptr;
+        }
     }
 }
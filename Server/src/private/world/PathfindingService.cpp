@@ -0,0 +1,445 @@
+#include "world/PathfindingService.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <queue>
+
+
+namespace MMO::Core
+{
+    namespace
+    {
+        // 8 directions ; les indices pairs sont orthogonaux (cout 10), les impairs diagonaux (cout 14)
+        constexpr int DIR_X[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+        constexpr int DIR_Y[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+        constexpr uint32_t DIR_COST[8] = { 10, 14, 10, 14, 10, 14, 10, 14 };
+
+        uint32_t Octile(int dx, int dy)
+        {
+            uint32_t ax = static_cast<uint32_t>(std::abs(dx));
+            uint32_t ay = static_cast<uint32_t>(std::abs(dy));
+            return 10 * std::max(ax, ay) + 4 * std::min(ax, ay);
+        }
+
+        // Deplacement autorise de (x, y) dans la direction dir : arrivee franchissable, pas de coupe de coin
+        bool CanStep(const WorldMap& map, int x, int y, int dir)
+        {
+            int nx = x + DIR_X[dir];
+            int ny = y + DIR_Y[dir];
+            if (!map.IsPassable(nx, ny))
+                return false;
+
+            if (dir & 1)
+                return map.IsPassable(nx, y) && map.IsPassable(x, ny);
+
+            return true;
+        }
+
+        // Tampons de recherche par worker, reutilises : la generation evite de les remettre a zero
+        struct SearchScratch
+        {
+            std::vector<uint32_t> cost;
+            std::vector<uint32_t> parent;
+            std::vector<uint32_t> stamp;        // == generation : tuile vue dans la recherche courante
+            std::vector<uint32_t> closedStamp;  // == generation : tuile developpee
+            uint32_t generation = 0;
+
+            void Prepare(size_t tileCount)
+            {
+                if (stamp.size() != tileCount)
+                {
+                    cost.assign(tileCount, 0);
+                    parent.assign(tileCount, 0);
+                    stamp.assign(tileCount, 0);
+                    closedStamp.assign(tileCount, 0);
+                    generation = 0;
+                }
+
+                if (++generation == 0)
+                {
+                    std::fill(stamp.begin(), stamp.end(), 0);
+                    std::fill(closedStamp.begin(), closedStamp.end(), 0);
+                    generation = 1;
+                }
+            }
+        };
+
+        thread_local SearchScratch t_scratch;
+
+        using OpenEntry = std::pair<uint32_t, uint32_t>; // (cout estime, tuile)
+        using OpenList = std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<>>;
+
+        // Borne en float avant la conversion : une coordonnee enorme ne deborde pas de l'int (NaN ramene dans la carte)
+        uint32_t ClampTile(float tile, uint32_t count)
+        {
+            return static_cast<uint32_t>(std::fmax(0.0f, std::fmin(tile, static_cast<float>(count - 1))));
+        }
+
+        uint32_t ToTile(const WorldMap& map, float x, float y)
+        {
+            float inverse = 1.0f / map.GetTileSize();
+            uint32_t tx = ClampTile(std::floor(x * inverse), map.GetWidth());
+            uint32_t ty = ClampTile(std::floor(y * inverse), map.GetHeight());
+            return ty * map.GetWidth() + tx;
+        }
+    }
+
+    PathfindingService::PathfindingService(size_t threadCount)
+        : m_pool(threadCount)
+    {
+        LOG_INFO("PathfindingService demarre ({} thread(s))", m_pool.GetThreadCount());
+    }
+
+    void PathfindingService::Submit(std::shared_ptr<const WorldMap> map, std::shared_ptr<PathInbox> inbox,
+                                    entt::entity entity, uint32_t requestId,
+                                    float startX, float startY, float goalX, float goalY)
+    {
+        m_requestCount++;
+        if (m_pool.GetThreadCount() == 0)
+        {
+            Run(map, *inbox, entity, requestId, startX, startY, goalX, goalY);
+            return;
+        }
+
+        bool isQueued = false;
+        {
+            std::scoped_lock lock(m_queueMutex);
+            auto& queue = m_queues[inbox.get()];
+            if (queue.pending < MAX_PENDING_PER_INBOX)
+            {
+                queue.pending++;
+                queue.latest[entity] = requestId;
+                isQueued = true;
+            }
+        }
+
+        // File pleine : echec livre au prochain tick, comme un chemin introuvable
+        if (!isQueued)
+        {
+            m_rejectedCount++;
+            m_failureCount++;
+            inbox->Push(PathResult{ entity, requestId, false, {} });
+            return;
+        }
+
+        m_pool.Enqueue([this, map = std::move(map), inbox = std::move(inbox), entity, requestId, startX, startY, goalX, goalY]()
+        {
+            // Nouvelle destination demandee entre-temps : rien a calculer
+            if (IsLatest(inbox.get(), entity, requestId))
+            {
+                Run(map, *inbox, entity, requestId, startX, startY, goalX, goalY);
+            }
+            else
+            {
+                m_staleCount++;
+            }
+            FinishJob(inbox.get(), entity, requestId);
+        });
+    }
+
+    bool PathfindingService::IsLatest(const PathInbox* inbox, entt::entity entity, uint32_t requestId) const
+    {
+        std::scoped_lock lock(m_queueMutex);
+        auto it = m_queues.find(inbox);
+        if (it == m_queues.end())
+            return false;
+
+        auto latestIt = it->second.latest.find(entity);
+        return latestIt != it->second.latest.end() && latestIt->second == requestId;
+    }
+
+    void PathfindingService::FinishJob(const PathInbox* inbox, entt::entity entity, uint32_t requestId)
+    {
+        std::scoped_lock lock(m_queueMutex);
+        auto it = m_queues.find(inbox);
+        if (it == m_queues.end())
+            return;
+
+        auto& queue = it->second;
+        auto latestIt = queue.latest.find(entity);
+        if (latestIt != queue.latest.end() && latestIt->second == requestId)
+        {
+            queue.latest.erase(latestIt);
+        }
+
+        // File vide : oubliee (la boite de reception peut disparaitre avec son royaume)
+        if (--queue.pending == 0)
+        {
+            m_queues.erase(it);
+        }
+    }
+
+    void PathfindingService::Run(const std::shared_ptr<const WorldMap>& map, PathInbox& inbox, entt::entity entity, uint32_t requestId,
+                                 float startX, float startY, float goalX, float goalY)
+    {
+        auto begin = std::chrono::steady_clock::now();
+
+        PathResult result;
+        result.entity = entity;
+        result.requestId = requestId;
+
+        uint32_t start = ToTile(*map, startX, startY);
+        uint32_t goal = ToTile(*map, goalX, goalY);
+        int goalTileX = static_cast<int>(goal % map->GetWidth());
+        int goalTileY = static_cast<int>(goal / map->GetWidth());
+
+        std::vector<uint32_t> tiles;
+        if (map->IsPassable(goalTileX, goalTileY))
+        {
+            // Flow field d'abord (destination populaire), A* sinon ou si le depart est hors du champ
+            bool found = false;
+            if (auto field = AcquireFlowField(map, goal))
+            {
+                found = FollowFlowField(*field, start, tiles);
+                if (found)
+                    m_flowFieldHits++;
+            }
+
+            if (!found)
+            {
+                m_aStarCount++;
+                found = FindPath(*map, start, goal, tiles);
+            }
+
+            if (found)
+            {
+                result.found = true;
+                ToWaypoints(*map, tiles, goalX, goalY, result.waypoints);
+            }
+        }
+
+        if (!result.found)
+            m_failureCount++;
+
+        m_searchMicroseconds += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count());
+
+        inbox.Push(std::move(result));
+    }
+
+    std::shared_ptr<const PathfindingService::FlowField> PathfindingService::AcquireFlowField(
+        const std::shared_ptr<const WorldMap>& map, uint32_t goal)
+    {
+        GoalKey key{ map.get(), goal };
+        {
+            std::scoped_lock lock(m_cacheMutex);
+
+            auto it = m_flowFields.find(key);
+            if (it != m_flowFields.end())
+            {
+                it->second.lastUse = ++m_useCounter;
+                return it->second.field;
+            }
+
+            if (m_goalRequests.size() >= MAX_TRACKED_GOALS)
+                m_goalRequests.clear();
+
+            if (++m_goalRequests[key] < FLOW_FIELD_THRESHOLD || m_building.contains(key))
+                return nullptr;
+
+            m_building.insert(key);
+        }
+
+        // Construction hors verrou : les autres requetes vers cette tuile passent par A* en attendant
+        std::shared_ptr<FlowField> field = BuildFlowField(map, goal);
+        m_flowFieldsBuilt++;
+
+        std::scoped_lock lock(m_cacheMutex);
+        m_building.erase(key);
+        m_goalRequests.erase(key);
+
+        if (m_flowFields.size() >= MAX_FLOW_FIELDS)
+        {
+            auto oldest = std::min_element(m_flowFields.begin(), m_flowFields.end(), [](const auto& a, const auto& b)
+            {
+                return a.second.lastUse < b.second.lastUse;
+            });
+            m_flowFields.erase(oldest);
+        }
+
+        m_flowFields[key] = CachedFlowField{ field, ++m_useCounter };
+        return field;
+    }
+
+    bool PathfindingService::FindPath(const WorldMap& map, uint32_t start, uint32_t goal, std::vector<uint32_t>& tiles)
+    {
+        const uint32_t width = map.GetWidth();
+        const size_t tileCount = static_cast<size_t>(width) * map.GetHeight();
+
+        SearchScratch& scratch = t_scratch;
+        scratch.Prepare(tileCount);
+        const uint32_t generation = scratch.generation;
+
+        const int goalX = static_cast<int>(goal % width);
+        const int goalY = static_cast<int>(goal / width);
+
+        OpenList open;
+        scratch.stamp[start] = generation;
+        scratch.cost[start] = 0;
+        scratch.parent[start] = start;
+        open.push({ Octile(static_cast<int>(start % width) - goalX, static_cast<int>(start / width) - goalY), start });
+
+        uint32_t expansions = 0;
+        while (!open.empty())
+        {
+            uint32_t current = open.top().second;
+            open.pop();
+
+            if (scratch.closedStamp[current] == generation)
+                continue; // Entree perimee (tuile deja developpee avec un meilleur cout)
+            scratch.closedStamp[current] = generation;
+
+            if (current == goal)
+            {
+                tiles.clear();
+                for (uint32_t tile = goal; tile != start; tile = scratch.parent[tile])
+                    tiles.push_back(tile);
+                tiles.push_back(start);
+                std::reverse(tiles.begin(), tiles.end());
+                return true;
+            }
+
+            if (++expansions > MAX_EXPANSIONS)
+                return false;
+
+            const int x = static_cast<int>(current % width);
+            const int y = static_cast<int>(current / width);
+            for (int dir = 0; dir < 8; ++dir)
+            {
+                if (!CanStep(map, x, y, dir))
+                    continue;
+
+                int nx = x + DIR_X[dir];
+                int ny = y + DIR_Y[dir];
+                uint32_t next = static_cast<uint32_t>(ny) * width + static_cast<uint32_t>(nx);
+                if (scratch.closedStamp[next] == generation)
+                    continue;
+
+                uint32_t cost = scratch.cost[current] + DIR_COST[dir];
+                if (scratch.stamp[next] == generation && cost >= scratch.cost[next])
+                    continue;
+
+                scratch.stamp[next] = generation;
+                scratch.cost[next] = cost;
+                scratch.parent[next] = current;
+                open.push({ cost + Octile(nx - goalX, ny - goalY), next });
+            }
+        }
+
+        return false;
+    }
+
+    std::shared_ptr<PathfindingService::FlowField> PathfindingService::BuildFlowField(
+        const std::shared_ptr<const WorldMap>& map, uint32_t goal)
+    {
+        const uint32_t width = map->GetWidth();
+        const size_t tileCount = static_cast<size_t>(width) * map->GetHeight();
+
+        auto field = std::make_shared<FlowField>();
+        field->map = map;
+        field->goal = goal;
+        field->directions.assign(tileCount, NO_DIRECTION);
+
+        // Dijkstra depuis la destination : chaque tuile atteinte pointe vers celle qui l'a relachee
+        // (les deplacements sont symetriques, la regle des coins aussi)
+        std::vector<uint32_t> cost(tileCount, UINT32_MAX);
+        OpenList open;
+        cost[goal] = 0;
+        open.push({ 0, goal });
+
+        while (!open.empty())
+        {
+            auto [currentCost, current] = open.top();
+            open.pop();
+            if (currentCost != cost[current])
+                continue;
+
+            const int x = static_cast<int>(current % width);
+            const int y = static_cast<int>(current / width);
+            for (int dir = 0; dir < 8; ++dir)
+            {
+                if (!CanStep(*map, x, y, dir))
+                    continue;
+
+                uint32_t next = static_cast<uint32_t>(y + DIR_Y[dir]) * width + static_cast<uint32_t>(x + DIR_X[dir]);
+                uint32_t nextCost = currentCost + DIR_COST[dir];
+                if (nextCost >= cost[next])
+                    continue;
+
+                cost[next] = nextCost;
+                field->directions[next] = static_cast<uint8_t>((dir + 4) & 7); // Direction inverse : vers current
+                open.push({ nextCost, next });
+            }
+        }
+
+        return field;
+    }
+
+    bool PathfindingService::FollowFlowField(const FlowField& field, uint32_t start, std::vector<uint32_t>& tiles)
+    {
+        const uint32_t width = field.map->GetWidth();
+        const size_t tileCount = field.directions.size();
+
+        tiles.clear();
+        uint32_t tile = start;
+        tiles.push_back(tile);
+        while (tile != field.goal)
+        {
+            uint8_t dir = field.directions[tile];
+            if (dir == NO_DIRECTION || tiles.size() > tileCount)
+                return false;
+
+            int x = static_cast<int>(tile % width) + DIR_X[dir];
+            int y = static_cast<int>(tile / width) + DIR_Y[dir];
+            tile = static_cast<uint32_t>(y) * width + static_cast<uint32_t>(x);
+            tiles.push_back(tile);
+        }
+
+        return true;
+    }
+
+    void PathfindingService::ToWaypoints(const WorldMap& map, const std::vector<uint32_t>& tiles,
+                                         float goalX, float goalY, std::vector<ECS::PathWaypoint>& out)
+    {
+        const uint32_t width = map.GetWidth();
+        const float tileSize = map.GetTileSize();
+
+        auto stepOf = [width](uint32_t from, uint32_t to)
+        {
+            return std::pair{ static_cast<int>(to % width) - static_cast<int>(from % width),
+                              static_cast<int>(to / width) - static_cast<int>(from / width) };
+        };
+
+        out.clear();
+        for (size_t i = 1; i + 1 < tiles.size(); ++i)
+        {
+            if (stepOf(tiles[i - 1], tiles[i]) == stepOf(tiles[i], tiles[i + 1]))
+                continue;
+
+            // Centre de la tuile ou le chemin tourne
+            out.push_back({ (static_cast<float>(tiles[i] % width) + 0.5f) * tileSize,
+                            (static_cast<float>(tiles[i] / width) + 0.5f) * tileSize });
+        }
+
+        out.push_back({ goalX, goalY });
+    }
+
+    void PathfindingService::PrintStats() const
+    {
+        uint64_t requests = m_requestCount.load();
+        uint64_t searches = m_aStarCount.load() + m_flowFieldHits.load();
+
+        size_t cachedFields;
+        {
+            std::scoped_lock lock(m_cacheMutex);
+            cachedFields = m_flowFields.size();
+        }
+
+        LOG_INFO("Pathfinding : {} requete(s) ({} remplacee(s), {} refusee(s) file pleine), {} A*, {} via flow field "
+            "({} construit(s), {} en cache), {} echec(s), {:.2f} ms en moyenne",
+            requests, m_staleCount.load(), m_rejectedCount.load(), m_aStarCount.load(), m_flowFieldHits.load(),
+            m_flowFieldsBuilt.load(), cachedFields, m_failureCount.load(),
+            searches > 0 ? static_cast<double>(m_searchMicroseconds.load()) / 1000.0 / static_cast<double>(searches) : 0.0);
+    }
+}
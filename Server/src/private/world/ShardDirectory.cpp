@@ -0,0 +1,287 @@
+#include "world/ShardDirectory.h"
+#include "utils/Logger.h"
+#include "utils/Time.h"
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <tuple>
+#include <nlohmann/json.hpp>
+
+
+namespace MMO::Core
+{
+    ShardDirectory::ShardDirectory(std::string directory, ShardEndpoint self, ShardEndpoint control)
+        : m_directory(std::move(directory)), m_self(std::move(self)), m_control(std::move(control))
+    {
+        std::error_code error;
+        std::filesystem::create_directories(m_directory, error);
+        if (error)
+        {
+            LOG_ERROR("ShardDirectory: impossible de creer '{}' ({})", m_directory, error.message());
+        }
+    }
+
+    void ShardDirectory::SetLocalKingdoms(const std::vector<int>& kingdomIds)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_localKingdoms = std::unordered_set<int>(kingdomIds.begin(), kingdomIds.end());
+    }
+
+    bool ShardDirectory::IsLocal(int kingdomId) const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_localKingdoms.contains(kingdomId);
+    }
+
+    void ShardDirectory::AddLocalKingdom(int kingdomId)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_localKingdoms.insert(kingdomId);
+        m_handoffs.erase(kingdomId);
+    }
+
+    void ShardDirectory::RemoveLocalKingdom(int kingdomId, const ShardEndpoint& newOwner)
+    {
+        std::scoped_lock lock(m_mutex);
+        m_localKingdoms.erase(kingdomId);
+
+        // Valable le temps d'un bail : le nouveau proprietaire doit l'avoir revendique d'ici la
+        ShardKingdomOwner owner{ newOwner, 0, Time::UnixMilliseconds() };
+        m_handoffs[kingdomId] = owner;
+        m_owners[kingdomId] = owner;
+    }
+
+    void ShardDirectory::Heartbeat(const std::unordered_map<int, int>& playerCounts)
+    {
+        WriteLease(playerCounts);
+        ReadLeases();
+    }
+
+    void ShardDirectory::Withdraw()
+    {
+        std::error_code error;
+        std::filesystem::remove(GetLeasePath(m_self), error);
+    }
+
+    void ShardDirectory::Refresh()
+    {
+        ReadLeases();
+    }
+
+    bool ShardDirectory::RecordOwner(int kingdomId, const ShardEndpoint& owner)
+    {
+        nlohmann::json record = {
+            { "kingdom", kingdomId },
+            { "ip", owner.ip },
+            { "port", owner.port },
+            { "recordedMs", Time::UnixMilliseconds() }
+        };
+        return WriteFileAtomically(GetOwnerPath(kingdomId), record.dump());
+    }
+
+    std::optional<ShardEndpoint> ShardDirectory::ReadRecordedOwner(int kingdomId) const
+    {
+        std::string path = GetOwnerPath(kingdomId);
+        std::error_code error;
+        if (!std::filesystem::exists(path, error))
+            return std::nullopt;
+
+        try
+        {
+            std::ifstream file(path);
+            nlohmann::json record = nlohmann::json::parse(file);
+            return ShardEndpoint{ record.at("ip").get<std::string>(), record.at("port").get<uint16_t>() };
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARN("ShardDirectory: proprietaire enregistre '{}' illisible ({})", path, e.what());
+            return std::nullopt;
+        }
+    }
+
+    ShardEndpoint ShardDirectory::ResolveOwner(int kingdomId, const ShardEndpoint& configured) const
+    {
+        // Un processus vivant qui le revendique l'emporte : il l'a recu alors que l'enregistrement manque encore
+        if (auto owner = FindOwner(kingdomId))
+            return owner->endpoint;
+
+        return ReadRecordedOwner(kingdomId).value_or(configured);
+    }
+
+    std::optional<ShardKingdomOwner> ShardDirectory::FindOwner(int kingdomId) const
+    {
+        std::scoped_lock lock(m_mutex);
+        auto it = m_owners.find(kingdomId);
+        if (it == m_owners.end())
+            return std::nullopt;
+
+        // Relecture en retard (thread d'E/S bloque) : un bail expire ne compte plus
+        if (Time::UnixMilliseconds() - it->second.heartbeatMs > LEASE_TIMEOUT_MS)
+            return std::nullopt;
+
+        return it->second;
+    }
+
+    std::optional<ShardEndpoint> ShardDirectory::FindControlAddress(const ShardEndpoint& endpoint) const
+    {
+        const int64_t nowMs = Time::UnixMilliseconds();
+        std::scoped_lock lock(m_mutex);
+        for (const auto& shard : m_controls)
+        {
+            if (shard.endpoint == endpoint && shard.control.port != 0 && nowMs - shard.heartbeatMs <= LEASE_TIMEOUT_MS)
+                return shard.control;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<ShardEndpoint> ShardDirectory::FindShardByControlAddress(const ShardEndpoint& control) const
+    {
+        const int64_t nowMs = Time::UnixMilliseconds();
+        std::scoped_lock lock(m_mutex);
+        for (const auto& shard : m_controls)
+        {
+            if (shard.control == control && shard.control.port != 0 && nowMs - shard.heartbeatMs <= LEASE_TIMEOUT_MS)
+                return shard.endpoint;
+        }
+        return std::nullopt;
+    }
+
+    std::string ShardDirectory::GetLeasePath(const ShardEndpoint& endpoint) const
+    {
+        return (std::filesystem::path(m_directory) / std::format("shard_{}_{}.json", endpoint.ip, endpoint.port)).string();
+    }
+
+    std::string ShardDirectory::GetOwnerPath(int kingdomId) const
+    {
+        return (std::filesystem::path(m_directory) / std::format("owner_{}.json", kingdomId)).string();
+    }
+
+    bool ShardDirectory::WriteFileAtomically(const std::string& path, const std::string& content)
+    {
+        std::string tempPath = path + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::trunc);
+            if (!file.is_open())
+            {
+                LOG_ERROR("ShardDirectory: impossible d'ecrire '{}'", tempPath);
+                return false;
+            }
+            file << content;
+        }
+
+        std::error_code error;
+        std::filesystem::rename(tempPath, path, error);
+        if (error)
+        {
+            LOG_ERROR("ShardDirectory: renommage vers '{}' impossible ({})", path, error.message());
+            return false;
+        }
+        return true;
+    }
+
+    void ShardDirectory::WriteLease(const std::unordered_map<int, int>& playerCounts)
+    {
+        nlohmann::json kingdoms = nlohmann::json::array();
+        {
+            std::scoped_lock lock(m_mutex);
+            for (int id : m_localKingdoms)
+            {
+                auto countIt = playerCounts.find(id);
+                kingdoms.push_back({ { "id", id }, { "players", countIt != playerCounts.end() ? countIt->second : 0 } });
+            }
+        }
+
+        nlohmann::json lease = {
+            { "ip", m_self.ip },
+            { "port", m_self.port },
+            { "controlIp", m_control.ip },
+            { "controlPort", m_control.port },
+            { "heartbeatMs", Time::UnixMilliseconds() },
+            { "kingdoms", std::move(kingdoms) }
+        };
+
+        WriteFileAtomically(GetLeasePath(m_self), lease.dump());
+    }
+
+    void ShardDirectory::ReadLeases()
+    {
+        const int64_t nowMs = Time::UnixMilliseconds();
+        const std::string selfName = std::filesystem::path(GetLeasePath(m_self)).filename().string();
+
+        std::unordered_map<int, ShardKingdomOwner> owners;
+        std::unordered_set<int> conflicts;
+        std::vector<ShardControl> controls;
+
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(m_directory, error))
+        {
+            std::string name = entry.path().filename().string();
+            if (!name.starts_with("shard_") || entry.path().extension() != ".json" || name == selfName)
+                continue;
+
+            try
+            {
+                std::ifstream file(entry.path());
+                nlohmann::json lease = nlohmann::json::parse(file);
+
+                ShardKingdomOwner owner;
+                owner.endpoint.ip = lease.at("ip").get<std::string>();
+                owner.endpoint.port = lease.at("port").get<uint16_t>();
+                owner.heartbeatMs = lease.at("heartbeatMs").get<int64_t>();
+                if (nowMs - owner.heartbeatMs > LEASE_TIMEOUT_MS)
+                    continue;
+
+                ShardEndpoint control{ lease.value("controlIp", owner.endpoint.ip), lease.value("controlPort", uint16_t{ 0 }) };
+                controls.push_back(ShardControl{ owner.endpoint, std::move(control), owner.heartbeatMs });
+
+                for (const auto& kingdom : lease.at("kingdoms"))
+                {
+                    int id = kingdom.at("id").get<int>();
+                    owner.playerCount = kingdom.value("players", 0);
+
+                    // Deux processus revendiquent le royaume : choix stable (plus petite adresse)
+                    auto [it, isNew] = owners.try_emplace(id, owner);
+                    if (!isNew)
+                    {
+                        conflicts.insert(id);
+                        if (std::tie(owner.endpoint.ip, owner.endpoint.port) < std::tie(it->second.endpoint.ip, it->second.endpoint.port))
+                            it->second = owner;
+                    }
+                }
+            }
+            catch (const std::exception& e)
+            {
+                // Bail en cours de remplacement ou corrompu : relu au prochain battement
+                LOG_WARN("ShardDirectory: bail '{}' illisible ({})", name, e.what());
+            }
+        }
+
+        std::scoped_lock lock(m_mutex);
+        for (const auto& [id, owner] : owners)
+        {
+            if (m_localKingdoms.contains(id))
+                conflicts.insert(id);
+        }
+
+        // Royaume cede mais pas encore dans le bail de son nouveau proprietaire : on continue d'y rediriger
+        std::erase_if(m_handoffs, [&owners, nowMs](const auto& entry)
+        {
+            const auto& [id, owner] = entry;
+            if (owners.contains(id) || nowMs - owner.heartbeatMs > LEASE_TIMEOUT_MS)
+                return true;
+
+            owners[id] = owner;
+            return false;
+        });
+
+        for (int id : conflicts)
+        {
+            if (!m_conflicts.contains(id))
+                LOG_WARN("ShardDirectory: royaume {} revendique par plusieurs processus (verifier ip/port de kingdoms.json)", id);
+        }
+
+        m_owners = std::move(owners);
+        m_conflicts = std::move(conflicts);
+        m_controls = std::move(controls);
+    }
+}
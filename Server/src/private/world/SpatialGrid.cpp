@@ -1,23 +1,63 @@
 #include "world/SpatialGrid.h"
+#include "ecs/PlayerComponents.h"
+#include <algorithm>
+#include <bit>
+#include <climits>
 #include <cmath>
 
+// Noyau SSE2 pour le filtre des requetes (toujours present en x64), sinon boucle scalaire
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define MMO_SPATIAL_SSE2 1
+#endif
+
 
 namespace MMO::Core
 {
+    namespace
+    {
+        // Clef de cellule → coordonnees (inverse de CellKey)
+        int KeyCellX(int64_t key) { return static_cast<int>(key >> 32); }
+        int KeyCellY(int64_t key) { return static_cast<int32_t>(static_cast<uint32_t>(key)); }
+    }
+
     SpatialGrid::SpatialGrid(float cellSize)
         : m_cellSize(cellSize)
         , m_inverseCellSize(1.0f / cellSize)
     {
+        m_lodLevels.resize(LOD_LEVEL_COUNT);
+    }
+
+    SpatialGrid::SpatialGrid(float cellSize, float worldWidth, float worldHeight)
+        : m_cellSize(cellSize)
+        , m_inverseCellSize(1.0f / cellSize)
+        , m_isDense(true)
+    {
+        m_cellsX = std::max(1, static_cast<int>(std::ceil(worldWidth * m_inverseCellSize)));
+        m_cellsY = std::max(1, static_cast<int>(std::ceil(worldHeight * m_inverseCellSize)));
+        m_denseCells.resize(static_cast<size_t>(m_cellsX) * static_cast<size_t>(m_cellsY));
+        m_lodLevels.resize(LOD_LEVEL_COUNT);
     }
 
     int SpatialGrid::ToCellX(float x) const
     {
-        return static_cast<int>(std::floor(x * m_inverseCellSize));
+        return ToCellClamped(x);
     }
 
     int SpatialGrid::ToCellY(float y) const
     {
-        return static_cast<int>(std::floor(y * m_inverseCellSize));
+        return ToCellClamped(y);
+    }
+
+    int SpatialGrid::ToCellClamped(float v) const
+    {
+        // Meme produit en float pour l'insertion et les requetes : une entite posee sur une borne
+        // tombe dans une cellule que la requete visite (en double, 300 * (1/100) donnait 2.999...)
+        constexpr float CELL_LIMIT = static_cast<float>(INT_MAX / 2);
+        float cell = std::floor(v * m_inverseCellSize);
+
+        // Borne en float avant la conversion : un rayon enorme ne deborde pas de l'int
+        return static_cast<int>(std::clamp(cell, -CELL_LIMIT, CELL_LIMIT));
     }
 
     int64_t SpatialGrid::CellKey(int cx, int cy) const
@@ -28,57 +68,105 @@ namespace MMO::Core
 
     void SpatialGrid::Insert(entt::entity entity, float x, float y)
     {
-        int64_t key = CellKey(ToCellX(x), ToCellY(y));
-        m_cells[key].insert(entity);
-        m_entityToCell[entity] = key;
+        if (m_isDense)
+        {
+            // Reinsertion d'une entite deja presente (ou d'un index recycle) : retrait de l'ancienne cellule
+            if (DenseSlot* slot = FindDenseSlot(entity))
+                DenseRemoveFromCell(*slot);
+
+            DenseAdd(entity, DenseCellIndex(x, y), x, y);
+            return;
+        }
+
+        auto it = m_entityToCell.find(entity);
+        if (it != m_entityToCell.end())
+            SparseRemoveFromCell(it->second);
+
+        SparseAdd(entity, CellKey(ToCellX(x), ToCellY(y)), x, y);
     }
 
     void SpatialGrid::Remove(entt::entity entity)
     {
+        if (m_isDense)
+        {
+            // L'index peut deja appartenir a une nouvelle version de l'entite : ne retirer que la bonne
+            DenseSlot* slot = FindDenseSlot(entity);
+            if (slot && m_denseCells[slot->cell].entities[slot->index] == entity)
+            {
+                DenseRemoveFromCell(*slot);
+                *slot = DenseSlot{};
+            }
+            return;
+        }
+
         auto it = m_entityToCell.find(entity);
         if (it == m_entityToCell.end())
             return;
 
-        int64_t key = it->second;
-        auto cellIt = m_cells.find(key);
-        if (cellIt != m_cells.end())
-        {
-            cellIt->second.erase(entity);
-            if (cellIt->second.empty())
-                m_cells.erase(cellIt);
-        }
-
+        SparseRemoveFromCell(it->second);
         m_entityToCell.erase(it);
     }
 
     void SpatialGrid::Move(entt::entity entity, float newX, float newY)
     {
+        if (m_isDense)
+        {
+            uint32_t newCell = DenseCellIndex(newX, newY);
+            DenseSlot* slot = FindDenseSlot(entity);
+            if (!slot)
+            {
+                // Pas encore dans la grille — insertion directe
+                DenseAdd(entity, newCell, newX, newY);
+                return;
+            }
+
+            if (m_denseCells[slot->cell].entities[slot->index] != entity)
+            {
+                // Index recycle encore occupe par une ancienne version : remplacement complet
+                Insert(entity, newX, newY);
+                return;
+            }
+
+            if (slot->cell == newCell)
+            {
+                // Meme cellule — seule la position stockee change
+                Cell& cell = m_denseCells[slot->cell];
+                cell.xs[slot->index] = newX;
+                cell.ys[slot->index] = newY;
+                return;
+            }
+
+            int lodLevels = LodLevelsBetween(static_cast<int>(slot->cell % m_cellsX), static_cast<int>(slot->cell / m_cellsX),
+                                             static_cast<int>(newCell % m_cellsX), static_cast<int>(newCell / m_cellsX));
+            DenseRemoveFromCell(*slot, lodLevels);
+            DenseAdd(entity, newCell, newX, newY, lodLevels);
+            return;
+        }
+
         int64_t newKey = CellKey(ToCellX(newX), ToCellY(newY));
 
         auto it = m_entityToCell.find(entity);
         if (it == m_entityToCell.end())
         {
             // Pas encore dans la grille — insertion directe
-            Insert(entity, newX, newY);
+            SparseAdd(entity, newKey, newX, newY);
             return;
         }
 
-        int64_t oldKey = it->second;
-        if (oldKey == newKey)
-            return; // Meme cellule — rien a faire
-
-        // Supprime de l'ancienne cellule
-        auto cellIt = m_cells.find(oldKey);
-        if (cellIt != m_cells.end())
+        if (it->second.key == newKey)
         {
-            cellIt->second.erase(entity);
-            if (cellIt->second.empty())
-                m_cells.erase(cellIt);
+            // Meme cellule — seule la position stockee change
+            Cell& cell = m_cells[newKey];
+            cell.xs[it->second.index] = newX;
+            cell.ys[it->second.index] = newY;
+            return;
         }
 
-        // Insere dans la nouvelle cellule
-        m_cells[newKey].insert(entity);
-        it->second = newKey;
+        // Supprime de l'ancienne cellule puis insere dans la nouvelle
+        int64_t oldKey = it->second.key;
+        int lodLevels = LodLevelsBetween(KeyCellX(oldKey), KeyCellY(oldKey), KeyCellX(newKey), KeyCellY(newKey));
+        SparseRemoveFromCell(it->second, lodLevels);
+        SparseAdd(entity, newKey, newX, newY, lodLevels);
     }
 
     void SpatialGrid::QueryNeighbors(float x, float y, std::vector<entt::entity>& out) const
@@ -86,6 +174,23 @@ namespace MMO::Core
         int cx = ToCellX(x);
         int cy = ToCellY(y);
 
+        if (m_isDense)
+        {
+            // Meme bornage que l'insertion : une position hors carte interroge les cellules du bord
+            cx = std::clamp(cx, 0, m_cellsX - 1);
+            cy = std::clamp(cy, 0, m_cellsY - 1);
+
+            for (int ny = std::max(cy - 1, 0); ny <= std::min(cy + 1, m_cellsY - 1); ++ny)
+            {
+                for (int nx = std::max(cx - 1, 0); nx <= std::min(cx + 1, m_cellsX - 1); ++nx)
+                {
+                    const auto& cell = m_denseCells[static_cast<size_t>(ny) * m_cellsX + nx];
+                    out.insert(out.end(), cell.entities.begin(), cell.entities.end());
+                }
+            }
+            return;
+        }
+
         // Parcourt les 9 cellules autour (3x3)
         for (int dx = -1; dx <= 1; ++dx)
         {
@@ -95,18 +200,545 @@ namespace MMO::Core
                 auto it = m_cells.find(key);
                 if (it != m_cells.end())
                 {
-                    for (entt::entity e : it->second)
-                    {
-                        out.push_back(e);
-                    }
+                    out.insert(out.end(), it->second.entities.begin(), it->second.entities.end());
                 }
             }
         }
     }
 
+    void SpatialGrid::QueryRadius(float x, float y, float radius, std::vector<entt::entity>& out) const
+    {
+        if (!(radius >= 0.0f))
+            return; // Rayon negatif ou NaN
+
+        float radiusSq = radius * radius;
+        ForEachCellInRect(x - radius, y - radius, x + radius, y + radius, [&](const Cell& cell)
+        {
+            FilterRadius(cell, x, y, radiusSq, out);
+        });
+    }
+
+    void SpatialGrid::QueryRect(float minX, float minY, float maxX, float maxY, std::vector<entt::entity>& out) const
+    {
+        if (!(minX <= maxX && minY <= maxY))
+            return;
+
+        ForEachCellInRect(minX, minY, maxX, maxY, [&](const Cell& cell)
+        {
+            FilterRect(cell, minX, minY, maxX, maxY, out);
+        });
+    }
+
+    int SpatialGrid::QueryLod(float minX, float minY, float maxX, float maxY, uint32_t maxNodes,
+                              std::vector<entt::entity>& entities, std::vector<LodAggregate>& aggregates) const
+    {
+        if (!(minX <= maxX && minY <= maxY))
+            return 0;
+
+        int cx0 = ToCellClamped(minX);
+        int cy0 = ToCellClamped(minY);
+        int cx1 = ToCellClamped(maxX);
+        int cy1 = ToCellClamped(maxY);
+
+        if (m_isDense)
+        {
+            cx0 = std::clamp(cx0, 0, m_cellsX - 1);
+            cx1 = std::clamp(cx1, 0, m_cellsX - 1);
+            cy0 = std::clamp(cy0, 0, m_cellsY - 1);
+            cy1 = std::clamp(cy1, 0, m_cellsY - 1);
+        }
+
+        // Premier niveau dont les noeuds couvrant la vue tiennent dans le budget
+        int level = 0;
+        for (; level < LOD_LEVEL_COUNT; ++level)
+        {
+            int64_t nodeCount = (static_cast<int64_t>(cx1 >> level) - (cx0 >> level) + 1)
+                              * (static_cast<int64_t>(cy1 >> level) - (cy0 >> level) + 1);
+            if (nodeCount <= static_cast<int64_t>(maxNodes))
+                break;
+        }
+
+        if (level == 0)
+        {
+            QueryRect(minX, minY, maxX, maxY, entities);
+            return 0;
+        }
+
+        const auto& nodes = m_lodLevels[level - 1];
+        const int nx0 = cx0 >> level;
+        const int ny0 = cy0 >> level;
+        const int nx1 = cx1 >> level;
+        const int ny1 = cy1 >> level;
+        const float nodeSize = m_cellSize * static_cast<float>(1 << level);
+
+        auto emit = [&](int nx, int ny, const LodNode& node)
+        {
+            LodAggregate aggregate;
+            aggregate.minX = static_cast<float>(nx) * nodeSize;
+            aggregate.minY = static_cast<float>(ny) * nodeSize;
+            aggregate.maxX = aggregate.minX + nodeSize;
+            aggregate.maxY = aggregate.minY + nodeSize;
+            aggregate.count = node.count;
+            aggregate.representative = node.representative;
+            FindStoredPosition(node.representative, aggregate.x, aggregate.y);
+            aggregates.push_back(aggregate);
+        };
+
+        // Meme arbitrage que ForEachCellInRect : parcourir la table si la vue depasse les noeuds occupes
+        int64_t nodeCount = (static_cast<int64_t>(nx1) - nx0 + 1) * (static_cast<int64_t>(ny1) - ny0 + 1);
+        if (nodeCount > static_cast<int64_t>(nodes.size()))
+        {
+            for (const auto& [key, node] : nodes)
+            {
+                int nx = KeyCellX(key);
+                int ny = KeyCellY(key);
+                if (nx >= nx0 && nx <= nx1 && ny >= ny0 && ny <= ny1)
+                    emit(nx, ny, node);
+            }
+            return level;
+        }
+
+        for (int ny = ny0; ny <= ny1; ++ny)
+        {
+            for (int nx = nx0; nx <= nx1; ++nx)
+            {
+                auto it = nodes.find(CellKey(nx, ny));
+                if (it != nodes.end())
+                    emit(nx, ny, it->second);
+            }
+        }
+        return level;
+    }
+
+    template <typename Visitor>
+    void SpatialGrid::ForEachCellInRect(float minX, float minY, float maxX, float maxY, Visitor&& visitor) const
+    {
+        int cx0 = ToCellClamped(minX);
+        int cy0 = ToCellClamped(minY);
+        int cx1 = ToCellClamped(maxX);
+        int cy1 = ToCellClamped(maxY);
+
+        if (m_isDense)
+        {
+            // Les entites hors carte sont rangees au bord : le bornage garde la requete exacte
+            cx0 = std::clamp(cx0, 0, m_cellsX - 1);
+            cx1 = std::clamp(cx1, 0, m_cellsX - 1);
+            cy0 = std::clamp(cy0, 0, m_cellsY - 1);
+            cy1 = std::clamp(cy1, 0, m_cellsY - 1);
+
+            for (int cy = cy0; cy <= cy1; ++cy)
+            {
+                for (int cx = cx0; cx <= cx1; ++cx)
+                    visitor(m_denseCells[static_cast<size_t>(cy) * m_cellsX + cx]);
+            }
+            return;
+        }
+
+        // Zone plus large que le nombre de cellules occupees : parcourir la table plutot que la zone
+        int64_t cellCount = (static_cast<int64_t>(cx1) - cx0 + 1) * (static_cast<int64_t>(cy1) - cy0 + 1);
+        if (cellCount > static_cast<int64_t>(m_cells.size()))
+        {
+            for (const auto& [key, cell] : m_cells)
+            {
+                int cx = KeyCellX(key);
+                int cy = KeyCellY(key);
+                if (cx >= cx0 && cx <= cx1 && cy >= cy0 && cy <= cy1)
+                    visitor(cell);
+            }
+            return;
+        }
+
+        for (int cx = cx0; cx <= cx1; ++cx)
+        {
+            for (int cy = cy0; cy <= cy1; ++cy)
+            {
+                auto it = m_cells.find(CellKey(cx, cy));
+                if (it != m_cells.end())
+                    visitor(it->second);
+            }
+        }
+    }
+
+    void SpatialGrid::FilterRadius(const Cell& cell, float x, float y, float radiusSq, std::vector<entt::entity>& out)
+    {
+        const size_t count = cell.entities.size();
+        const float* xs = cell.xs.data();
+        const float* ys = cell.ys.data();
+        size_t i = 0;
+
+#ifdef MMO_SPATIAL_SSE2
+        const __m128 centerX = _mm_set1_ps(x);
+        const __m128 centerY = _mm_set1_ps(y);
+        const __m128 limit = _mm_set1_ps(radiusSq);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs + i), centerX);
+            __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys + i), centerY);
+            __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+            unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_cmple_ps(distSq, limit)));
+            while (mask)
+            {
+                out.push_back(cell.entities[i + std::countr_zero(mask)]);
+                mask &= mask - 1;
+            }
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            float dx = xs[i] - x;
+            float dy = ys[i] - y;
+            if (dx * dx + dy * dy <= radiusSq)
+                out.push_back(cell.entities[i]);
+        }
+    }
+
+    void SpatialGrid::FilterRect(const Cell& cell, float minX, float minY, float maxX, float maxY, std::vector<entt::entity>& out)
+    {
+        const size_t count = cell.entities.size();
+        const float* xs = cell.xs.data();
+        const float* ys = cell.ys.data();
+        size_t i = 0;
+
+#ifdef MMO_SPATIAL_SSE2
+        const __m128 lowX = _mm_set1_ps(minX);
+        const __m128 lowY = _mm_set1_ps(minY);
+        const __m128 highX = _mm_set1_ps(maxX);
+        const __m128 highY = _mm_set1_ps(maxY);
+
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128 px = _mm_loadu_ps(xs + i);
+            __m128 py = _mm_loadu_ps(ys + i);
+            __m128 inside = _mm_and_ps(
+                _mm_and_ps(_mm_cmpge_ps(px, lowX), _mm_cmple_ps(px, highX)),
+                _mm_and_ps(_mm_cmpge_ps(py, lowY), _mm_cmple_ps(py, highY)));
+
+            unsigned mask = static_cast<unsigned>(_mm_movemask_ps(inside));
+            while (mask)
+            {
+                out.push_back(cell.entities[i + std::countr_zero(mask)]);
+                mask &= mask - 1;
+            }
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            if (xs[i] >= minX && xs[i] <= maxX && ys[i] >= minY && ys[i] <= maxY)
+                out.push_back(cell.entities[i]);
+        }
+    }
+
     void SpatialGrid::Clear()
     {
         m_cells.clear();
         m_entityToCell.clear();
+
+        // Les cellules denses gardent leur capacite
+        for (auto& cell : m_denseCells)
+            cell.Clear();
+        m_denseSlots.clear();
+
+        for (auto& level : m_lodLevels)
+            level.clear();
+
+        m_pendingUpdates.clear();
+        m_pendingRemovals.clear();
+    }
+
+    // --- Synchronisation avec la registry ---
+
+    void SpatialGrid::Connect(entt::registry& registry)
+    {
+        registry.on_construct<ECS::PositionComponent>().connect<&SpatialGrid::OnPositionChanged>(*this);
+        registry.on_update<ECS::PositionComponent>().connect<&SpatialGrid::OnPositionChanged>(*this);
+        registry.on_destroy<ECS::PositionComponent>().connect<&SpatialGrid::OnPositionDestroyed>(*this);
+    }
+
+    void SpatialGrid::Disconnect(entt::registry& registry)
+    {
+        registry.on_construct<ECS::PositionComponent>().disconnect(*this);
+        registry.on_update<ECS::PositionComponent>().disconnect(*this);
+        registry.on_destroy<ECS::PositionComponent>().disconnect(*this);
+    }
+
+    void SpatialGrid::OnPositionChanged(entt::registry&, entt::entity entity)
+    {
+        m_pendingUpdates.push_back(entity);
+    }
+
+    void SpatialGrid::OnPositionDestroyed(entt::registry&, entt::entity entity)
+    {
+        m_pendingRemovals.push_back(entity);
+    }
+
+    void SpatialGrid::ApplyBatch(const entt::registry& registry)
+    {
+        // Retraits d'abord : un index recycle dans le meme tick est libere avant d'etre reinsere
+        for (entt::entity entity : m_pendingRemovals)
+        {
+            // Position retiree puis remise sur la meme entite : traitee comme une mise a jour
+            if (registry.valid(entity) && registry.all_of<ECS::PositionComponent>(entity))
+                continue;
+
+            Remove(entity);
+        }
+        m_pendingRemovals.clear();
+
+        // Positions lues maintenant : les doublons d'une meme entite deviennent identiques
+        m_batchScratch.clear();
+        for (entt::entity entity : m_pendingUpdates)
+        {
+            if (!registry.valid(entity))
+                continue;
+
+            const auto* position = registry.try_get<ECS::PositionComponent>(entity);
+            if (!position)
+                continue;
+
+            m_batchScratch.push_back(PendingMove{ SortKey(position->x, position->y), entity, position->x, position->y });
+        }
+        m_pendingUpdates.clear();
+
+        // Tri par cellule : les acces a une meme cellule (et a ses vecteurs) sont consecutifs
+        std::sort(m_batchScratch.begin(), m_batchScratch.end(), [](const PendingMove& a, const PendingMove& b)
+        {
+            return a.cell != b.cell ? a.cell < b.cell : a.entity < b.entity;
+        });
+
+        auto last = std::unique(m_batchScratch.begin(), m_batchScratch.end(), [](const PendingMove& a, const PendingMove& b)
+        {
+            return a.entity == b.entity;
+        });
+
+        for (auto it = m_batchScratch.begin(); it != last; ++it)
+            Move(it->entity, it->x, it->y);
+    }
+
+    uint64_t SpatialGrid::SortKey(float x, float y) const
+    {
+        if (m_isDense)
+            return DenseCellIndex(x, y);
+
+        return static_cast<uint64_t>(CellKey(ToCellX(x), ToCellY(y)));
+    }
+
+    // --- Niveaux de detail ---
+
+    void SpatialGrid::LodAdd(entt::entity entity, int cx, int cy, int levels)
+    {
+        for (int level = 1; level <= levels; ++level)
+        {
+            LodNode& node = m_lodLevels[level - 1][CellKey(cx >> level, cy >> level)];
+            node.count++;
+            if (node.representative == entt::null)
+                node.representative = entity;
+        }
+    }
+
+    void SpatialGrid::LodRemove(entt::entity entity, int cx, int cy, const Cell* remaining, int levels)
+    {
+        // Du plus fin au plus grossier : un niveau remplace sa representative par celle d'un enfant deja a jour
+        for (int level = 1; level <= levels; ++level)
+        {
+            auto& nodes = m_lodLevels[level - 1];
+            auto it = nodes.find(CellKey(cx >> level, cy >> level));
+            if (it == nodes.end())
+                continue;
+
+            LodNode& node = it->second;
+            if (--node.count == 0)
+            {
+                nodes.erase(it);
+                continue;
+            }
+
+            if (node.representative != entity)
+                continue;
+
+            // La cellule quittee est dans tous ses ancetres : premiere candidate
+            if (remaining && !remaining->entities.empty())
+            {
+                node.representative = remaining->entities.front();
+                continue;
+            }
+
+            node.representative = entt::null;
+            const int px = (cx >> level) * 2;
+            const int py = (cy >> level) * 2;
+            for (int child = 0; child < 4 && node.representative == entt::null; ++child)
+            {
+                int childX = px + (child & 1);
+                int childY = py + (child >> 1);
+                if (level == 1)
+                {
+                    const Cell* cell = FindCell(childX, childY);
+                    if (cell && !cell->entities.empty())
+                        node.representative = cell->entities.front();
+                }
+                else
+                {
+                    const auto& children = m_lodLevels[level - 2];
+                    auto childIt = children.find(CellKey(childX, childY));
+                    if (childIt != children.end())
+                        node.representative = childIt->second.representative;
+                }
+            }
+        }
+    }
+
+    int SpatialGrid::LodLevelsBetween(int oldCx, int oldCy, int newCx, int newCy)
+    {
+        // Des que deux cellules partagent un ancetre, elles partagent aussi tous les suivants
+        for (int level = 1; level <= LOD_LEVEL_COUNT; ++level)
+        {
+            if ((oldCx >> level) == (newCx >> level) && (oldCy >> level) == (newCy >> level))
+                return level - 1;
+        }
+        return LOD_LEVEL_COUNT;
+    }
+
+    const SpatialGrid::Cell* SpatialGrid::FindCell(int cx, int cy) const
+    {
+        if (m_isDense)
+        {
+            if (cx < 0 || cy < 0 || cx >= m_cellsX || cy >= m_cellsY)
+                return nullptr;
+            return &m_denseCells[static_cast<size_t>(cy) * m_cellsX + cx];
+        }
+
+        auto it = m_cells.find(CellKey(cx, cy));
+        return it != m_cells.end() ? &it->second : nullptr;
+    }
+
+    bool SpatialGrid::FindStoredPosition(entt::entity entity, float& x, float& y) const
+    {
+        if (entity == entt::null)
+            return false;
+
+        if (m_isDense)
+        {
+            size_t slotIndex = static_cast<size_t>(entt::to_entity(entity));
+            if (slotIndex >= m_denseSlots.size() || m_denseSlots[slotIndex].cell == INVALID_CELL)
+                return false;
+
+            const DenseSlot& slot = m_denseSlots[slotIndex];
+            const Cell& cell = m_denseCells[slot.cell];
+            x = cell.xs[slot.index];
+            y = cell.ys[slot.index];
+            return true;
+        }
+
+        auto it = m_entityToCell.find(entity);
+        if (it == m_entityToCell.end())
+            return false;
+
+        const Cell& cell = m_cells.at(it->second.key);
+        x = cell.xs[it->second.index];
+        y = cell.ys[it->second.index];
+        return true;
+    }
+
+    // --- Cellule ---
+
+    uint32_t SpatialGrid::Cell::Push(entt::entity entity, float x, float y)
+    {
+        entities.push_back(entity);
+        xs.push_back(x);
+        ys.push_back(y);
+        return static_cast<uint32_t>(entities.size() - 1);
+    }
+
+    entt::entity SpatialGrid::Cell::SwapRemove(uint32_t index)
+    {
+        // Le dernier de la cellule prend la place libre
+        size_t last = entities.size() - 1;
+        entt::entity moved = entt::null;
+        if (index != last)
+        {
+            moved = entities[last];
+            entities[index] = moved;
+            xs[index] = xs[last];
+            ys[index] = ys[last];
+        }
+
+        entities.pop_back();
+        xs.pop_back();
+        ys.pop_back();
+        return moved;
+    }
+
+    void SpatialGrid::Cell::Clear()
+    {
+        entities.clear();
+        xs.clear();
+        ys.clear();
+    }
+
+    // --- Stockage sparse ---
+
+    void SpatialGrid::SparseAdd(entt::entity entity, int64_t key, float x, float y, int lodLevels)
+    {
+        m_entityToCell[entity] = SparseSlot{ key, m_cells[key].Push(entity, x, y) };
+        LodAdd(entity, KeyCellX(key), KeyCellY(key), lodLevels);
+    }
+
+    void SpatialGrid::SparseRemoveFromCell(const SparseSlot& slot, int lodLevels)
+    {
+        auto cellIt = m_cells.find(slot.key);
+        if (cellIt == m_cells.end())
+            return;
+
+        entt::entity removed = cellIt->second.entities[slot.index];
+        entt::entity moved = cellIt->second.SwapRemove(slot.index);
+        if (moved != entt::null)
+            m_entityToCell[moved].index = slot.index;
+
+        LodRemove(removed, KeyCellX(slot.key), KeyCellY(slot.key), &cellIt->second, lodLevels);
+
+        if (cellIt->second.entities.empty())
+            m_cells.erase(cellIt);
+    }
+
+    // --- Stockage dense ---
+
+    uint32_t SpatialGrid::DenseCellIndex(float x, float y) const
+    {
+        int cx = std::clamp(ToCellX(x), 0, m_cellsX - 1);
+        int cy = std::clamp(ToCellY(y), 0, m_cellsY - 1);
+        return static_cast<uint32_t>(cy * m_cellsX + cx);
+    }
+
+    void SpatialGrid::DenseAdd(entt::entity entity, uint32_t cell, float x, float y, int lodLevels)
+    {
+        size_t slotIndex = static_cast<size_t>(entt::to_entity(entity));
+        if (slotIndex >= m_denseSlots.size())
+            m_denseSlots.resize(std::max(slotIndex + 1, m_denseSlots.size() * 2));
+
+        m_denseSlots[slotIndex] = DenseSlot{ cell, m_denseCells[cell].Push(entity, x, y) };
+        LodAdd(entity, static_cast<int>(cell % m_cellsX), static_cast<int>(cell / m_cellsX), lodLevels);
+    }
+
+    void SpatialGrid::DenseRemoveFromCell(const DenseSlot& slot, int lodLevels)
+    {
+        Cell& cell = m_denseCells[slot.cell];
+        entt::entity removed = cell.entities[slot.index];
+        entt::entity moved = cell.SwapRemove(slot.index);
+        if (moved != entt::null)
+            m_denseSlots[static_cast<size_t>(entt::to_entity(moved))].index = slot.index;
+
+        LodRemove(removed, static_cast<int>(slot.cell % m_cellsX), static_cast<int>(slot.cell / m_cellsX), &cell, lodLevels);
+    }
+
+    SpatialGrid::DenseSlot* SpatialGrid::FindDenseSlot(entt::entity entity)
+    {
+        size_t slotIndex = static_cast<size_t>(entt::to_entity(entity));
+        if (slotIndex >= m_denseSlots.size() || m_denseSlots[slotIndex].cell == INVALID_CELL)
+            return nullptr;
+
+        return &m_denseSlots[slotIndex];
     }
 }
@@ -0,0 +1,258 @@
+#include "world/TimingWheel.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cmath>
+
+
+namespace MMO::Core
+{
+    TimingWheel::TimingWheel(float resolutionMs)
+        : m_unitsPerSecond(1000.0 / static_cast<double>(std::max(resolutionMs, 0.001f)))
+    {
+        m_slotHeads.fill(INVALID_INDEX);
+    }
+
+    TimingWheel::Handle TimingWheel::Schedule(double delaySeconds, Callback callback)
+    {
+        Handle handle = Insert(delaySeconds);
+        m_nodes[handle.index].hasCallback = true;
+        m_callbacks[handle.index] = std::move(callback);
+        return handle;
+    }
+
+    TimingWheel::Handle TimingWheel::ScheduleEvent(double delaySeconds, const TimerEvent& event)
+    {
+        Handle handle = Insert(delaySeconds);
+        m_nodes[handle.index].event = event;
+        return handle;
+    }
+
+    TimingWheel::Handle TimingWheel::Insert(double delaySeconds)
+    {
+        uint32_t index = AllocateNode();
+        Node& node = m_nodes[index];
+
+        // Au moins une unite : un timer ne se declenche jamais dans le Step qui l'a planifie
+        double units = std::ceil(std::max(delaySeconds, 0.0) * m_unitsPerSecond);
+        node.expiry = m_now + std::max<uint64_t>(1, static_cast<uint64_t>(units));
+
+        Link(index);
+        m_pendingCount++;
+        return Handle{ index, node.generation };
+    }
+
+    bool TimingWheel::Cancel(Handle handle)
+    {
+        if (!FindActive(handle))
+            return false;
+
+        Unlink(handle.index);
+        FreeNode(handle.index);
+        m_pendingCount--;
+        return true;
+    }
+
+    bool TimingWheel::IsPending(Handle handle) const
+    {
+        return FindActive(handle) != nullptr;
+    }
+
+    float TimingWheel::GetRemaining(Handle handle) const
+    {
+        const Node* node = FindActive(handle);
+        if (!node)
+            return 0.0f;
+
+        return static_cast<float>(static_cast<double>(node->expiry - m_now) / m_unitsPerSecond);
+    }
+
+    void TimingWheel::CollectEvents(std::vector<ScheduledTimerEvent>& out) const
+    {
+        for (const Node& node : m_nodes)
+        {
+            if (!node.isActive || node.hasCallback)
+                continue;
+
+            out.push_back(ScheduledTimerEvent{ node.event, static_cast<double>(node.expiry - m_now) / m_unitsPerSecond });
+        }
+    }
+
+    void TimingWheel::SetEventHandler(uint16_t type, EventHandler handler)
+    {
+        if (type >= m_eventHandlers.size())
+            m_eventHandlers.resize(static_cast<size_t>(type) + 1);
+
+        m_eventHandlers[type] = std::move(handler);
+    }
+
+    void TimingWheel::Advance(float dt)
+    {
+        m_accumulator += static_cast<double>(dt) * m_unitsPerSecond;
+
+        auto steps = static_cast<uint64_t>(m_accumulator);
+        m_accumulator -= static_cast<double>(steps);
+
+        for (uint64_t i = 0; i < steps; ++i)
+            Step();
+    }
+
+    void TimingWheel::Step()
+    {
+        m_now++;
+
+        // Passage d'un tour complet d'un niveau : la case suivante du niveau superieur redescend
+        for (int level = 1; level < LEVEL_COUNT; ++level)
+        {
+            if (((m_now >> (SLOT_BITS * (level - 1))) & SLOT_MASK) != 0)
+                break;
+            Cascade(level);
+        }
+
+        // Retrait un par un : un callback peut annuler ou planifier d'autres timers sans casser le parcours
+        uint32_t& head = m_slotHeads[m_now & SLOT_MASK];
+        while (head != INVALID_INDEX)
+        {
+            uint32_t index = head;
+            Unlink(index);
+            Fire(index);
+        }
+    }
+
+    void TimingWheel::Cascade(int level)
+    {
+        uint32_t slot = static_cast<uint32_t>(level) * SLOT_COUNT
+            + static_cast<uint32_t>((m_now >> (SLOT_BITS * level)) & SLOT_MASK);
+
+        uint32_t index = m_slotHeads[slot];
+        m_slotHeads[slot] = INVALID_INDEX;
+
+        while (index != INVALID_INDEX)
+        {
+            uint32_t next = m_nodes[index].next;
+            Link(index);
+            index = next;
+        }
+    }
+
+    void TimingWheel::Fire(uint32_t index)
+    {
+        // Copie avant liberation : le callback peut reutiliser le noeud
+        Node& node = m_nodes[index];
+        bool hasCallback = node.hasCallback;
+        TimerEvent event = node.event;
+
+        Callback callback;
+        if (hasCallback)
+            callback = std::move(m_callbacks[index]);
+
+        FreeNode(index);
+        m_pendingCount--;
+
+        if (hasCallback)
+        {
+            if (callback)
+                callback();
+            return;
+        }
+
+        if (event.type < m_eventHandlers.size() && m_eventHandlers[event.type])
+        {
+            m_eventHandlers[event.type](event);
+        }
+        else
+        {
+            LOG_WARN("TimingWheel: aucun handler pour l'evenement de type {}", event.type);
+        }
+    }
+
+    void TimingWheel::Link(uint32_t index)
+    {
+        Node& node = m_nodes[index];
+
+        // Niveau choisi selon l'ecart avec maintenant ; au-dela de la portee, case la plus lointaine
+        // (le noeud garde sa vraie echeance et sera reclasse a chaque redescente)
+        uint64_t delta = node.expiry > m_now ? node.expiry - m_now : 0;
+        uint64_t target = node.expiry > m_now ? node.expiry : m_now;
+
+        int level = 0;
+        while (level < LEVEL_COUNT - 1 && delta >= (uint64_t{ 1 } << (SLOT_BITS * (level + 1))))
+            level++;
+
+        if (level == LEVEL_COUNT - 1 && delta >= (uint64_t{ 1 } << (SLOT_BITS * LEVEL_COUNT)))
+            target = m_now + (uint64_t{ 1 } << (SLOT_BITS * LEVEL_COUNT)) - 1;
+
+        uint32_t slot = static_cast<uint32_t>(level) * SLOT_COUNT
+            + static_cast<uint32_t>((target >> (SLOT_BITS * level)) & SLOT_MASK);
+
+        node.slot = static_cast<uint16_t>(slot);
+        node.prev = INVALID_INDEX;
+        node.next = m_slotHeads[slot];
+        if (node.next != INVALID_INDEX)
+            m_nodes[node.next].prev = index;
+        m_slotHeads[slot] = index;
+    }
+
+    void TimingWheel::Unlink(uint32_t index)
+    {
+        Node& node = m_nodes[index];
+
+        if (node.prev != INVALID_INDEX)
+            m_nodes[node.prev].next = node.next;
+        else
+            m_slotHeads[node.slot] = node.next;
+
+        if (node.next != INVALID_INDEX)
+            m_nodes[node.next].prev = node.prev;
+
+        node.prev = INVALID_INDEX;
+        node.next = INVALID_INDEX;
+    }
+
+    uint32_t TimingWheel::AllocateNode()
+    {
+        uint32_t index;
+        if (!m_freeNodes.empty())
+        {
+            index = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else
+        {
+            index = static_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        Node& node = m_nodes[index];
+        node.isActive = true;
+        node.hasCallback = false;
+        node.event = TimerEvent{};
+        return index;
+    }
+
+    void TimingWheel::FreeNode(uint32_t index)
+    {
+        Node& node = m_nodes[index];
+        node.isActive = false;
+        node.generation++;
+
+        if (node.hasCallback)
+        {
+            m_callbacks.erase(index);
+            node.hasCallback = false;
+        }
+
+        m_freeNodes.push_back(index);
+    }
+
+    const TimingWheel::Node* TimingWheel::FindActive(Handle handle) const
+    {
+        if (handle.index >= m_nodes.size())
+            return nullptr;
+
+        const Node& node = m_nodes[handle.index];
+        if (!node.isActive || node.generation != handle.generation)
+            return nullptr;
+
+        return &node;
+    }
+}
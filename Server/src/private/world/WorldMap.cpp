@@ -0,0 +1,279 @@
+#include "world/WorldMap.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <random>
+
+
+namespace MMO::Core
+{
+    namespace
+    {
+        constexpr uint64_t SECTION_ALIGNMENT = 8;
+
+        uint64_t AlignUp(uint64_t value)
+        {
+            return (value + SECTION_ALIGNMENT - 1) & ~(SECTION_ALIGNMENT - 1);
+        }
+
+        uint64_t PassabilityBytes(uint64_t tileCount)
+        {
+            return (tileCount + 7) / 8;
+        }
+
+        // Section [offset, offset + size) dans le fichier et alignee
+        bool IsSectionValid(uint64_t offset, uint64_t size, uint64_t fileSize)
+        {
+            return offset % SECTION_ALIGNMENT == 0 && offset <= fileSize && size <= fileSize - offset;
+        }
+
+        bool IsBlocking(TileType type)
+        {
+            return type == TileType::Mountain || type == TileType::Water;
+        }
+    }
+
+    // --- WorldMap ---
+
+    bool WorldMap::Open(const std::string& path)
+    {
+        if (!m_file.Open(path))
+            return false;
+
+        const uint8_t* data = m_file.GetData();
+        const uint64_t size = m_file.GetSize();
+
+        if (size < sizeof(WorldMapHeader))
+        {
+            LOG_ERROR("WorldMap: '{}' trop petit pour un en-tete", path);
+            m_file.Close();
+            return false;
+        }
+
+        const auto* header = reinterpret_cast<const WorldMapHeader*>(data);
+        if (std::memcmp(header->magic, WORLD_MAP_MAGIC, sizeof(WORLD_MAP_MAGIC)) != 0
+            || header->version != WORLD_MAP_VERSION || header->headerSize != sizeof(WorldMapHeader))
+        {
+            LOG_ERROR("WorldMap: '{}' n'est pas une carte v{}", path, WORLD_MAP_VERSION);
+            m_file.Close();
+            return false;
+        }
+
+        const uint64_t tileCount = static_cast<uint64_t>(header->width) * header->height;
+        if (header->fileSize != size || tileCount == 0 || !(header->tileSize > 0.0f)
+            || !IsSectionValid(header->tilesOffset, tileCount, size)
+            || !IsSectionValid(header->passabilityOffset, PassabilityBytes(tileCount), size)
+            || !IsSectionValid(header->objectsOffset, static_cast<uint64_t>(header->objectCount) * sizeof(StaticObject), size))
+        {
+            LOG_ERROR("WorldMap: '{}' tronque ou corrompu", path);
+            m_file.Close();
+            return false;
+        }
+
+        m_path = path;
+        m_header = header;
+        m_tiles = data + header->tilesOffset;
+        m_passability = data + header->passabilityOffset;
+        m_objects = reinterpret_cast<const StaticObject*>(data + header->objectsOffset);
+
+        LOG_INFO("Carte '{}' projetee : {}x{} tuiles de {}, {} objet(s), {} Ko",
+            path, header->width, header->height, header->tileSize, header->objectCount, size / 1024);
+        return true;
+    }
+
+    bool WorldMap::IsInBounds(int tileX, int tileY) const
+    {
+        return tileX >= 0 && tileY >= 0
+            && static_cast<uint32_t>(tileX) < m_header->width
+            && static_cast<uint32_t>(tileY) < m_header->height;
+    }
+
+    TileType WorldMap::GetTile(int tileX, int tileY) const
+    {
+        if (!IsInBounds(tileX, tileY))
+            return TileType::Plain;
+
+        return static_cast<TileType>(m_tiles[static_cast<size_t>(tileY) * m_header->width + tileX]);
+    }
+
+    bool WorldMap::IsPassable(int tileX, int tileY) const
+    {
+        if (!IsInBounds(tileX, tileY))
+            return false;
+
+        size_t index = static_cast<size_t>(tileY) * m_header->width + tileX;
+        return (m_passability[index >> 3] >> (index & 7)) & 1;
+    }
+
+    bool WorldMap::IsPassableAt(float x, float y) const
+    {
+        // Bornes verifiees en float : convertir en int une valeur hors de sa plage est indefini (NaN compris)
+        float inverse = 1.0f / m_header->tileSize;
+        float tileX = std::floor(x * inverse);
+        float tileY = std::floor(y * inverse);
+        if (!(tileX >= 0.0f && tileX < static_cast<float>(m_header->width) && tileY >= 0.0f && tileY < static_cast<float>(m_header->height)))
+            return false;
+
+        return IsPassable(static_cast<int>(tileX), static_cast<int>(tileY));
+    }
+
+    // --- WorldMapCache ---
+
+    std::shared_ptr<const WorldMap> WorldMapCache::Load(const std::string& path)
+    {
+        auto it = m_maps.find(path);
+        if (it != m_maps.end())
+        {
+            if (auto existing = it->second.lock())
+                return existing;
+        }
+
+        auto map = std::make_shared<WorldMap>();
+        if (!map->Open(path))
+            return nullptr;
+
+        m_maps[path] = map;
+        return map;
+    }
+
+    // --- WorldMapBuilder ---
+
+    WorldMapBuilder::WorldMapBuilder(uint32_t width, uint32_t height, float tileSize)
+        : m_width(width)
+        , m_height(height)
+        , m_tileSize(tileSize)
+        , m_tiles(static_cast<size_t>(width) * height, static_cast<uint8_t>(TileType::Plain))
+        , m_passability(PassabilityBytes(static_cast<uint64_t>(width) * height), 0xFF)
+    {
+    }
+
+    void WorldMapBuilder::SetTile(uint32_t tileX, uint32_t tileY, TileType type)
+    {
+        m_tiles[static_cast<size_t>(tileY) * m_width + tileX] = static_cast<uint8_t>(type);
+        SetPassable(tileX, tileY, !IsBlocking(type));
+    }
+
+    void WorldMapBuilder::SetPassable(uint32_t tileX, uint32_t tileY, bool passable)
+    {
+        size_t index = static_cast<size_t>(tileY) * m_width + tileX;
+        uint8_t bit = static_cast<uint8_t>(1u << (index & 7));
+        if (passable)
+            m_passability[index >> 3] |= bit;
+        else
+            m_passability[index >> 3] &= static_cast<uint8_t>(~bit);
+    }
+
+    void WorldMapBuilder::AddObject(const StaticObject& object)
+    {
+        m_objects.push_back(object);
+    }
+
+    TileType WorldMapBuilder::GetTile(uint32_t tileX, uint32_t tileY) const
+    {
+        return static_cast<TileType>(m_tiles[static_cast<size_t>(tileY) * m_width + tileX]);
+    }
+
+    bool WorldMapBuilder::IsPassable(uint32_t tileX, uint32_t tileY) const
+    {
+        size_t index = static_cast<size_t>(tileY) * m_width + tileX;
+        return (m_passability[index >> 3] >> (index & 7)) & 1;
+    }
+
+    bool WorldMapBuilder::Save(const std::string& path) const
+    {
+        WorldMapHeader header{};
+        std::memcpy(header.magic, WORLD_MAP_MAGIC, sizeof(WORLD_MAP_MAGIC));
+        header.version = WORLD_MAP_VERSION;
+        header.headerSize = sizeof(WorldMapHeader);
+        header.width = m_width;
+        header.height = m_height;
+        header.tileSize = m_tileSize;
+        header.objectCount = static_cast<uint32_t>(m_objects.size());
+        header.tilesOffset = AlignUp(sizeof(WorldMapHeader));
+        header.passabilityOffset = AlignUp(header.tilesOffset + m_tiles.size());
+        header.objectsOffset = AlignUp(header.passabilityOffset + m_passability.size());
+        header.fileSize = header.objectsOffset + m_objects.size() * sizeof(StaticObject);
+
+        std::vector<char> buffer(header.fileSize, 0);
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        std::memcpy(buffer.data() + header.tilesOffset, m_tiles.data(), m_tiles.size());
+        std::memcpy(buffer.data() + header.passabilityOffset, m_passability.data(), m_passability.size());
+        if (!m_objects.empty())
+            std::memcpy(buffer.data() + header.objectsOffset, m_objects.data(), m_objects.size() * sizeof(StaticObject));
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            LOG_ERROR("WorldMap: impossible d'ecrire '{}'", path);
+            return false;
+        }
+
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!file.good())
+        {
+            LOG_ERROR("WorldMap: ecriture de '{}' incomplete", path);
+            return false;
+        }
+
+        return true;
+    }
+
+    // --- Generation procedurale ---
+
+    WorldMapBuilder GenerateWorldMap(uint32_t width, uint32_t height, float tileSize, uint32_t seed)
+    {
+        WorldMapBuilder builder(width, height, tileSize);
+        std::mt19937 rng(seed);
+
+        auto randomTile = [&rng](uint32_t limit)
+        {
+            return std::uniform_int_distribution<uint32_t>(0, limit - 1)(rng);
+        };
+
+        // Massifs, lacs et forets : disques de terrain poses au hasard (~1 pour 5000 tuiles)
+        const uint64_t tileCount = static_cast<uint64_t>(width) * height;
+        const uint64_t blobCount = std::max<uint64_t>(1, tileCount / 5000);
+        std::uniform_int_distribution<int> radiusDist(3, 20);
+        std::uniform_int_distribution<int> terrainDist(0, 3);
+
+        for (uint64_t i = 0; i < blobCount; ++i)
+        {
+            int centerX = static_cast<int>(randomTile(width));
+            int centerY = static_cast<int>(randomTile(height));
+            int radius = radiusDist(rng);
+
+            int roll = terrainDist(rng);
+            TileType type = roll < 2 ? TileType::Forest : (roll == 2 ? TileType::Mountain : TileType::Water);
+
+            for (int y = std::max(0, centerY - radius); y <= std::min(static_cast<int>(height) - 1, centerY + radius); ++y)
+            {
+                for (int x = std::max(0, centerX - radius); x <= std::min(static_cast<int>(width) - 1, centerX + radius); ++x)
+                {
+                    int dx = x - centerX;
+                    int dy = y - centerY;
+                    if (dx * dx + dy * dy <= radius * radius)
+                        builder.SetTile(static_cast<uint32_t>(x), static_cast<uint32_t>(y), type);
+                }
+            }
+        }
+
+        // Noeuds de ressources sur les tuiles franchissables (~1 pour 500 tuiles)
+        const uint64_t nodeCount = tileCount / 500;
+        std::uniform_int_distribution<int> nodeTypeDist(1, 4);
+        std::uniform_int_distribution<uint32_t> levelDist(1, 5);
+
+        for (uint64_t i = 0; i < nodeCount; ++i)
+        {
+            uint32_t x = randomTile(width);
+            uint32_t y = randomTile(height);
+            if (!builder.IsPassable(x, y))
+                continue;
+
+            builder.AddObject(StaticObject{ static_cast<uint16_t>(nodeTypeDist(rng)), 0, x, y, levelDist(rng) });
+        }
+
+        return builder;
+    }
+}
@@ -0,0 +1,358 @@
+#include "world/WorldSnapshot.h"
+#include "ecs/PlayerComponents.h"
+#include "ecs/MovementComponents.h"
+#include "ecs/CombatComponents.h"
+#include "utils/StringInterner.h"
+#include "utils/Logger.h"
+#include "utils/Time.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string_view>
+#include <type_traits>
+
+
+namespace MMO::Core
+{
+    namespace
+    {
+        uint32_t Fnv1a(const uint8_t* data, size_t size)
+        {
+            uint32_t hash = 2166136261u;
+            for (size_t i = 0; i < size; ++i)
+            {
+                hash ^= data[i];
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+
+        // Archive de sortie EnTT : copie brute des types triviaux, surcharge dediee pour les autres
+        class OutputArchive
+        {
+        public:
+            explicit OutputArchive(std::vector<uint8_t>& buffer) : m_buffer(buffer) {}
+
+            template<typename T>
+            void operator()(const T& value)
+            {
+                static_assert(std::is_trivially_copyable_v<T>, "WorldSnapshot: composant non trivial, ajouter une surcharge");
+                Write(&value, sizeof(T));
+            }
+
+            // Un handle d'interner n'a de sens que dans ce processus : le pseudo est ecrit en clair
+            void operator()(const ECS::PlayerInfoComponent& info)
+            {
+                (*this)(info.accountID);
+                std::string_view name = Utils::Resolve(info.username);
+                (*this)(static_cast<uint32_t>(name.size()));
+                Write(name.data(), name.size());
+            }
+
+            // Les batailles ne sont pas sauvegardees : les troupes engagees ne sont pas ecrites comme telles
+            void operator()(const ECS::ArmyComponent& army)
+            {
+                (*this)(army.troops);
+                (*this)(army.wounded);
+                (*this)(army.attack);
+                (*this)(army.defense);
+                (*this)(army.health);
+            }
+
+            // Champ par champ : le padding de TimerEvent ne doit pas entrer dans le checksum
+            void operator()(const ScheduledTimerEvent& scheduled)
+            {
+                (*this)(scheduled.event.type);
+                (*this)(scheduled.event.entity);
+                (*this)(scheduled.event.data);
+                (*this)(scheduled.remainingSeconds);
+            }
+
+            void operator()(const ECS::PathComponent& path)
+            {
+                (*this)(static_cast<uint32_t>(path.waypoints.size()));
+                Write(path.waypoints.data(), path.waypoints.size() * sizeof(ECS::PathWaypoint));
+                (*this)(path.next);
+                (*this)(path.speed);
+            }
+
+        private:
+            void Write(const void* data, size_t size)
+            {
+                const auto* bytes = static_cast<const uint8_t*>(data);
+                m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+            }
+
+            std::vector<uint8_t>& m_buffer;
+        };
+
+        // Archive d'entree EnTT. Une lecture hors du buffer marque l'archive en echec et rend des zeros
+        class InputArchive
+        {
+        public:
+            InputArchive(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+
+            template<typename T>
+            void operator()(T& value)
+            {
+                static_assert(std::is_trivially_copyable_v<T>, "WorldSnapshot: composant non trivial, ajouter une surcharge");
+                Read(&value, sizeof(T));
+            }
+
+            // Le joueur revient hors ligne (playerID invalide) jusqu'a ce que sa session reprenne l'entite
+            void operator()(ECS::PlayerInfoComponent& info)
+            {
+                info = ECS::PlayerInfoComponent{};
+                (*this)(info.accountID);
+
+                uint32_t length = 0;
+                (*this)(length);
+                if (!CanRead(length))
+                    return;
+
+                info.username = Utils::Intern(std::string_view(reinterpret_cast<const char*>(m_data + m_offset), length));
+                m_offset += length;
+            }
+
+            // Troupes engagees rendues : leur bataille n'existe plus
+            void operator()(ECS::ArmyComponent& army)
+            {
+                army = ECS::ArmyComponent{};
+                (*this)(army.troops);
+                (*this)(army.wounded);
+                (*this)(army.attack);
+                (*this)(army.defense);
+                (*this)(army.health);
+            }
+
+            void operator()(ScheduledTimerEvent& scheduled)
+            {
+                (*this)(scheduled.event.type);
+                (*this)(scheduled.event.entity);
+                (*this)(scheduled.event.data);
+                (*this)(scheduled.remainingSeconds);
+            }
+
+            void operator()(ECS::PathComponent& path)
+            {
+                uint32_t count = 0;
+                (*this)(count);
+                if (!CanRead(static_cast<size_t>(count) * sizeof(ECS::PathWaypoint)))
+                    return;
+
+                path.waypoints.resize(count);
+                Read(path.waypoints.data(), path.waypoints.size() * sizeof(ECS::PathWaypoint));
+                (*this)(path.next);
+                (*this)(path.speed);
+                path.next = std::min(path.next, count);
+            }
+
+            bool HasFailed() const { return m_failed; }
+            bool IsAtEnd() const { return m_offset == m_size; }
+
+        private:
+            bool CanRead(size_t size)
+            {
+                if (!m_failed && m_size - m_offset >= size)
+                    return true;
+
+                m_failed = true;
+                return false;
+            }
+
+            void Read(void* out, size_t size)
+            {
+                if (size == 0)
+                    return;
+
+                if (!CanRead(size))
+                {
+                    std::memset(out, 0, size);
+                    return;
+                }
+
+                std::memcpy(out, m_data + m_offset, size);
+                m_offset += size;
+            }
+
+            const uint8_t* m_data;
+            size_t m_size;
+            size_t m_offset = 0;
+            bool m_failed = false;
+        };
+
+        // Composants sauvegardes, dans l'ordre de l'archive (modifier la liste = incrementer WORLD_SNAPSHOT_VERSION)
+        // Non sauvegardes : MovementDirtyTag (transitoire) et PathRequestComponent (le calcul en vol est perdu),
+        // AttackOrderComponent et CombatReportComponent (consommes dans le tick)
+        template<typename Snapshot, typename Archive>
+        void ProcessComponents(Snapshot& snapshot, Archive& archive)
+        {
+            snapshot.template get<entt::entity>(archive)
+                .template get<ECS::PlayerInfoComponent>(archive)
+                .template get<ECS::PositionComponent>(archive)
+                .template get<ECS::ResourcesComponent>(archive)
+                .template get<ECS::VelocityComponent>(archive)
+                .template get<ECS::MoveTargetComponent>(archive)
+                .template get<ECS::PathComponent>(archive)
+                .template get<ECS::ArmyComponent>(archive);
+        }
+    }
+
+    std::vector<uint8_t> CaptureWorldSnapshot(const entt::registry& registry, const TimingWheel& timers, int kingdomId, bool isClean)
+    {
+        std::vector<uint8_t> buffer(sizeof(WorldSnapshotHeader), 0);
+
+        OutputArchive archive(buffer);
+        entt::snapshot snapshot{ registry };
+        ProcessComponents(snapshot, archive);
+
+        // Les entites gardent leur identifiant au chargement : les evenements les designent toujours
+        std::vector<ScheduledTimerEvent> events;
+        timers.CollectEvents(events);
+        archive(static_cast<uint32_t>(events.size()));
+        for (const ScheduledTimerEvent& scheduled : events)
+        {
+            archive(scheduled);
+        }
+
+        WorldSnapshotHeader header{};
+        std::memcpy(header.magic, WORLD_SNAPSHOT_MAGIC, sizeof(WORLD_SNAPSHOT_MAGIC));
+        header.version = WORLD_SNAPSHOT_VERSION;
+        header.headerSize = sizeof(WorldSnapshotHeader);
+        header.kingdomId = kingdomId;
+        header.flags = isClean ? SNAPSHOT_FLAG_CLEAN : 0u;
+        header.savedAtMs = Time::UnixMilliseconds();
+        header.payloadSize = buffer.size() - sizeof(WorldSnapshotHeader);
+        header.entityCount = static_cast<uint32_t>(registry.view<ECS::PositionComponent>().size());
+        header.checksum = Fnv1a(buffer.data() + sizeof(WorldSnapshotHeader), header.payloadSize);
+
+        std::memcpy(buffer.data(), &header, sizeof(header));
+        return buffer;
+    }
+
+    bool WriteWorldSnapshot(const std::string& path, const std::vector<uint8_t>& buffer)
+    {
+        std::error_code error;
+        std::filesystem::path target(path);
+        if (target.has_parent_path())
+            std::filesystem::create_directories(target.parent_path(), error);
+
+        // Un arret brutal pendant l'ecriture laisse l'ancien fichier intact
+        std::string tempPath = path + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file.is_open())
+            {
+                LOG_ERROR("WorldSnapshot: impossible d'ecrire '{}'", tempPath);
+                return false;
+            }
+
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            if (!file.good())
+            {
+                LOG_ERROR("WorldSnapshot: ecriture de '{}' incomplete", tempPath);
+                return false;
+            }
+        }
+
+        std::filesystem::rename(tempPath, target, error);
+        if (error)
+        {
+            LOG_ERROR("WorldSnapshot: renommage vers '{}' impossible ({})", path, error.message());
+            return false;
+        }
+
+        return true;
+    }
+
+    bool LoadWorldSnapshot(const std::string& path, entt::registry& registry, TimingWheel& timers, int kingdomId, WorldSnapshotInfo& info)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open())
+            return false;
+
+        auto fileSize = static_cast<size_t>(file.tellg());
+        std::vector<uint8_t> buffer(fileSize);
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(fileSize));
+        if (!file.good())
+        {
+            LOG_WARN("WorldSnapshot: lecture de '{}' incomplete, ignore", path);
+            return false;
+        }
+
+        return LoadWorldSnapshot(buffer, path, registry, timers, kingdomId, info);
+    }
+
+    bool LoadWorldSnapshot(std::span<const uint8_t> buffer, const std::string& source,
+        entt::registry& registry, TimingWheel& timers, int kingdomId, WorldSnapshotInfo& info)
+    {
+        if (buffer.size() < sizeof(WorldSnapshotHeader))
+        {
+            LOG_WARN("WorldSnapshot: '{}' trop petit, ignore", source);
+            return false;
+        }
+
+        WorldSnapshotHeader header;
+        std::memcpy(&header, buffer.data(), sizeof(header));
+
+        if (std::memcmp(header.magic, WORLD_SNAPSHOT_MAGIC, sizeof(WORLD_SNAPSHOT_MAGIC)) != 0
+            || header.headerSize != sizeof(WorldSnapshotHeader))
+        {
+            LOG_WARN("WorldSnapshot: '{}' n'est pas un snapshot de royaume, ignore", source);
+            return false;
+        }
+
+        if (header.version != WORLD_SNAPSHOT_VERSION)
+        {
+            LOG_WARN("WorldSnapshot: '{}' en version {} (attendu {}), ignore", source, header.version, WORLD_SNAPSHOT_VERSION);
+            return false;
+        }
+
+        if (header.kingdomId != kingdomId)
+        {
+            LOG_WARN("WorldSnapshot: '{}' appartient au royaume {} (attendu {}), ignore", source, header.kingdomId, kingdomId);
+            return false;
+        }
+
+        const uint8_t* payload = buffer.data() + sizeof(WorldSnapshotHeader);
+        if (header.payloadSize != buffer.size() - sizeof(WorldSnapshotHeader)
+            || Fnv1a(payload, header.payloadSize) != header.checksum)
+        {
+            LOG_WARN("WorldSnapshot: '{}' tronque ou corrompu, ignore", source);
+            return false;
+        }
+
+        InputArchive archive(payload, header.payloadSize);
+        entt::snapshot_loader loader{ registry };
+        ProcessComponents(loader, archive);
+        loader.orphans();
+
+        // Evenements lus jusqu'au bout avant d'en planifier un seul : un snapshot rejete ne laisse aucun timer
+        uint32_t eventCount = 0;
+        archive(eventCount);
+        std::vector<ScheduledTimerEvent> events;
+        for (uint32_t i = 0; i < eventCount && !archive.HasFailed(); ++i)
+        {
+            archive(events.emplace_back());
+        }
+
+        if (archive.HasFailed() || !archive.IsAtEnd())
+        {
+            LOG_WARN("WorldSnapshot: contenu de '{}' incoherent, royaume {} demarre vide", source, kingdomId);
+            registry.clear();
+            return false;
+        }
+
+        for (const ScheduledTimerEvent& scheduled : events)
+        {
+            timers.ScheduleEvent(scheduled.remainingSeconds, scheduled.event);
+        }
+
+        info.isClean = (header.flags & SNAPSHOT_FLAG_CLEAN) != 0;
+        info.savedAtMs = header.savedAtMs;
+        info.entityCount = header.entityCount;
+        return true;
+    }
+}
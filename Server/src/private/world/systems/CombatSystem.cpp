@@ -0,0 +1,297 @@
+#include "world/systems/CombatSystem.h"
+#include "ecs/CombatComponents.h"
+#include <algorithm>
+
+
+namespace MMO::Core
+{
+    namespace
+    {
+        // Camp elimine : moins d'une demi-troupe (plus rien a l'arrondi)
+        constexpr float MIN_SIDE_TROOPS = 0.5f;
+
+        // Reductions a quatre sommes partielles : vectorisables sans laisser le compilateur reassocier les float
+        float Sum(const float* values, size_t count)
+        {
+            float partial[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                partial[0] += values[i];
+                partial[1] += values[i + 1];
+                partial[2] += values[i + 2];
+                partial[3] += values[i + 3];
+            }
+
+            float sum = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+            for (; i < count; ++i)
+                sum += values[i];
+            return sum;
+        }
+
+        float DotProduct(const float* a, const float* b, size_t count)
+        {
+            float partial[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                partial[0] += a[i] * b[i];
+                partial[1] += a[i + 1] * b[i + 1];
+                partial[2] += a[i + 2] * b[i + 2];
+                partial[3] += a[i + 3] * b[i + 3];
+            }
+
+            float sum = (partial[0] + partial[1]) + (partial[2] + partial[3]);
+            for (; i < count; ++i)
+                sum += a[i] * b[i];
+            return sum;
+        }
+
+        // Degats repartis au prorata des troupes : chaque pile recoit troops[i] * damagePerTroop
+        // Sans branche ni alias, une iteration par pile
+        void ApplyDamage(float* __restrict troops, const float* __restrict toughness, size_t count, float damagePerTroop)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                float killed = troops[i] * damagePerTroop / toughness[i];
+                troops[i] = std::max(0.0f, troops[i] - killed);
+            }
+        }
+
+        uint32_t RoundTroops(float troops)
+        {
+            return static_cast<uint32_t>(troops + 0.5f);
+        }
+
+        void AddReport(entt::registry& registry, entt::entity owner, const ECS::CombatReport& report)
+        {
+            registry.get_or_emplace<ECS::CombatReportComponent>(owner).reports.push_back(report);
+        }
+    }
+
+    void CombatSystem::TroopStacks::Add(entt::entity owner, uint32_t count, const ECS::ArmyComponent& army)
+    {
+        owners.push_back(owner);
+        committed.push_back(count);
+        reported.push_back(0);
+        troops.push_back(static_cast<float>(count));
+        attack.push_back(army.attack);
+        toughness.push_back(std::max(1.0f, army.health * army.defense));
+    }
+
+    void CombatSystem::OnAttach(entt::registry& registry)
+    {
+        // Stockages crees a l'enregistrement : jamais pendant un tick parallele
+        registry.storage<ECS::ArmyComponent>();
+        registry.storage<ECS::AttackOrderComponent>();
+        registry.storage<ECS::CombatReportComponent>();
+
+        auto* const* timers = registry.ctx().find<TimingWheel*>();
+        m_timers = timers ? *timers : nullptr;
+        if (m_timers)
+        {
+            m_timers->SetEventHandler(static_cast<uint16_t>(TimerEventType::TroopRecovery),
+                [&registry](const TimerEvent& event) { OnTroopRecovery(registry, event); });
+        }
+    }
+
+    void CombatSystem::OnTick(float dt, entt::registry& registry)
+    {
+        // Ordres du tick : nouvelles batailles et ralliements
+        auto orders = registry.view<ECS::AttackOrderComponent>();
+        m_orders.assign(orders.begin(), orders.end());
+        for (auto entity : m_orders)
+        {
+            Engage(registry, entity, registry.get<ECS::AttackOrderComponent>(entity));
+        }
+        registry.clear<ECS::AttackOrderComponent>();
+
+        for (size_t i = 0; i < m_battles.size();)
+        {
+            Battle& battle = m_battles[i];
+
+            // Cible disparue (deconnectee sans troupe engagee) : les attaquants l'emportent sans combattre
+            const bool isTargetGone = !registry.valid(battle.target);
+            if (!isTargetGone)
+            {
+                ResolveRound(battle, dt);
+            }
+
+            const float attackersLeft = Sum(battle.attackers.troops.data(), battle.attackers.Size());
+            const float defendersLeft = Sum(battle.defenders.troops.data(), battle.defenders.Size());
+            const uint32_t attackersCount = RoundTroops(attackersLeft);
+            const uint32_t defendersCount = RoundTroops(defendersLeft);
+
+            // Nouveaux participants annonces avec les effectifs de ce round
+            for (const auto& [isDefender, index] : battle.joined)
+            {
+                const TroopStacks& side = isDefender ? battle.defenders : battle.attackers;
+                AddReport(registry, side.owners[index], ECS::CombatReport{ battle.id, battle.target,
+                    ECS::CombatEventKind::Engaged, attackersCount, defendersCount, side.committed[index], 0 });
+            }
+            battle.joined.clear();
+
+            const bool isOver = isTargetGone || attackersLeft < MIN_SIDE_TROOPS || defendersLeft < MIN_SIDE_TROOPS;
+            if (!isOver)
+            {
+                battle.reportCountdown -= dt;
+                if (battle.reportCountdown <= 0.0f)
+                {
+                    battle.reportCountdown += REPORT_INTERVAL;
+                    ReportSide(registry, battle, battle.attackers, ECS::CombatEventKind::Round, false, attackersCount, defendersCount);
+                    ReportSide(registry, battle, battle.defenders, ECS::CombatEventKind::Round, false, attackersCount, defendersCount);
+                }
+                ++i;
+                continue;
+            }
+
+            // Vainqueur : le seul camp qui a encore des troupes (deux camps aneantis : aucun)
+            const bool attackersWin = attackersLeft >= MIN_SIDE_TROOPS && (isTargetGone || defendersLeft < MIN_SIDE_TROOPS);
+            const bool defendersWin = !isTargetGone && defendersLeft >= MIN_SIDE_TROOPS && attackersLeft < MIN_SIDE_TROOPS;
+            ReportSide(registry, battle, battle.attackers,
+                attackersWin ? ECS::CombatEventKind::Victory : ECS::CombatEventKind::Defeat, true, attackersCount, defendersCount);
+            ReportSide(registry, battle, battle.defenders,
+                defendersWin ? ECS::CombatEventKind::Victory : ECS::CombatEventKind::Defeat, true, attackersCount, defendersCount);
+
+            // Retrait en O(1) : la derniere bataille prend la place
+            m_battleByTarget.erase(battle.target);
+            if (i + 1 != m_battles.size())
+            {
+                battle = std::move(m_battles.back());
+                m_battleByTarget[battle.target] = i;
+            }
+            m_battles.pop_back();
+        }
+    }
+
+    void CombatSystem::DeclareAccess(SystemAccess& access) const
+    {
+        access.Write<ECS::ArmyComponent>()
+              .Write<ECS::AttackOrderComponent>()
+              .Write<ECS::CombatReportComponent>()
+              .WriteResource<TimingWheel>(); // blesses planifies en fin de bataille
+    }
+
+    bool CombatSystem::QueueAttack(entt::registry& registry, entt::entity attacker, entt::entity target, uint32_t troops)
+    {
+        const auto* army = registry.try_get<ECS::ArmyComponent>(attacker);
+        if (!army || army->Available() == 0)
+            return false;
+
+        registry.emplace_or_replace<ECS::AttackOrderComponent>(attacker, ECS::AttackOrderComponent{ target, troops });
+        return true;
+    }
+
+    void CombatSystem::Engage(entt::registry& registry, entt::entity attacker, const ECS::AttackOrderComponent& order)
+    {
+        // La cible a pu disparaitre depuis l'ordre
+        if (order.target == attacker || !registry.valid(order.target))
+            return;
+
+        auto* army = registry.try_get<ECS::ArmyComponent>(attacker);
+        auto* targetArmy = registry.try_get<ECS::ArmyComponent>(order.target);
+        if (!army || !targetArmy)
+            return;
+
+        const uint32_t count = std::min(order.troops, army->Available());
+        if (count == 0)
+            return;
+
+        auto [it, isNew] = m_battleByTarget.try_emplace(order.target, m_battles.size());
+        if (isNew)
+        {
+            Battle& battle = m_battles.emplace_back();
+            battle.id = m_nextBattleId++;
+            battle.target = order.target;
+
+            // La cible defend avec toutes ses troupes disponibles (aucune : defaite au premier round)
+            const uint32_t defenders = targetArmy->Available();
+            if (defenders > 0)
+            {
+                battle.defenders.Add(order.target, defenders, *targetArmy);
+                battle.joined.emplace_back(true, 0);
+                targetArmy->deployed += defenders;
+            }
+        }
+
+        // Attaquant deja engage contre cette cible : nouvelle pile, rien a rechercher
+        Battle& battle = m_battles[it->second];
+        battle.joined.emplace_back(false, battle.attackers.Size());
+        battle.attackers.Add(attacker, count, *army);
+        army->deployed += count;
+    }
+
+    void CombatSystem::ResolveRound(Battle& battle, float dt)
+    {
+        TroopStacks& attackers = battle.attackers;
+        TroopStacks& defenders = battle.defenders;
+
+        // Puissances calculees avant tout degat : les deux camps frappent en meme temps
+        const float attackPower = DotProduct(attackers.troops.data(), attackers.attack.data(), attackers.Size());
+        const float defensePower = DotProduct(defenders.troops.data(), defenders.attack.data(), defenders.Size());
+        const float attackersTotal = Sum(attackers.troops.data(), attackers.Size());
+        const float defendersTotal = Sum(defenders.troops.data(), defenders.Size());
+
+        if (defendersTotal > 0.0f)
+        {
+            ApplyDamage(defenders.troops.data(), defenders.toughness.data(), defenders.Size(), attackPower * dt / defendersTotal);
+        }
+        if (attackersTotal > 0.0f)
+        {
+            ApplyDamage(attackers.troops.data(), attackers.toughness.data(), attackers.Size(), defensePower * dt / attackersTotal);
+        }
+    }
+
+    void CombatSystem::ReportSide(entt::registry& registry, const Battle& battle, TroopStacks& side,
+        ECS::CombatEventKind kind, bool isOver, uint32_t attackersLeft, uint32_t defendersLeft)
+    {
+        for (size_t i = 0; i < side.Size(); ++i)
+        {
+            const uint32_t survivors = std::min(RoundTroops(side.troops[i]), side.committed[i]);
+            const uint32_t lost = side.committed[i] - survivors;
+            const uint32_t losses = lost - std::min(side.reported[i], lost);
+            side.reported[i] = lost;
+
+            // Participant retire du monde : sa pile a combattu jusqu'au bout, sans bilan
+            entt::entity owner = side.owners[i];
+            if (!registry.valid(owner))
+                continue;
+
+            auto* army = registry.try_get<ECS::ArmyComponent>(owner);
+            if (!army)
+                continue;
+
+            army->troops -= std::min(losses, army->troops);
+            if (isOver)
+            {
+                army->deployed -= std::min(side.committed[i], army->deployed);
+
+                const uint32_t wounded = m_timers ? RoundTroops(static_cast<float>(lost) * ECS::WOUNDED_RATIO) : 0;
+                if (wounded > 0)
+                {
+                    army->wounded += wounded;
+                    m_timers->ScheduleEvent(ECS::WOUNDED_RECOVERY_SEC,
+                        TimerEvent{ static_cast<uint16_t>(TimerEventType::TroopRecovery), owner, wounded });
+                }
+            }
+
+            AddReport(registry, owner, ECS::CombatReport{ battle.id, battle.target, kind,
+                attackersLeft, defendersLeft, survivors, losses });
+        }
+    }
+
+    void CombatSystem::OnTroopRecovery(entt::registry& registry, const TimerEvent& event)
+    {
+        // Joueur parti entre-temps : ses blesses ont ete sauvegardes avec ses troupes
+        if (!registry.valid(event.entity))
+            return;
+
+        auto* army = registry.try_get<ECS::ArmyComponent>(event.entity);
+        if (!army)
+            return;
+
+        const uint32_t healed = std::min(event.data, army->wounded);
+        army->wounded -= healed;
+        army->troops += healed;
+    }
+}
@@ -0,0 +1,113 @@
+#include "world/systems/MovementSystem.h"
+#include "ecs/MovementComponents.h"
+#include "ecs/PlayerComponents.h"
+#include "world/SpatialGrid.h"
+#include <cmath>
+
+
+namespace MMO::Core
+{
+    void MovementSystem::OnAttach(entt::registry& registry)
+    {
+        // Groupe cree a l'enregistrement : jamais pendant un tick parallele
+        registry.group<ECS::VelocityComponent, ECS::MoveTargetComponent>(entt::get<ECS::PositionComponent>);
+        registry.storage<ECS::MovementDirtyTag>();
+        registry.storage<ECS::PathComponent>();
+    }
+
+    void MovementSystem::OnTick(float dt, entt::registry& registry)
+    {
+        auto group = registry.group<ECS::VelocityComponent, ECS::MoveTargetComponent>(entt::get<ECS::PositionComponent>);
+        auto& dirty = registry.storage<ECS::MovementDirtyTag>();
+
+        m_arrived.clear();
+        for (auto [entity, velocity, target, position] : group.each())
+        {
+            float nextX = position.x + velocity.x * dt;
+            float nextY = position.y + velocity.y * dt;
+
+            // Depasse la destination si le reste du trajet change de sens : pas de racine carree par entite
+            float remainingX = target.x - nextX;
+            float remainingY = target.y - nextY;
+            if (remainingX * velocity.x + remainingY * velocity.y <= 0.0f)
+            {
+                nextX = target.x;
+                nextY = target.y;
+                m_arrived.push_back(entity);
+            }
+
+            position.x = nextX;
+            position.y = nextY;
+            registry.patch<ECS::PositionComponent>(entity);
+            if (!dirty.contains(entity))
+                dirty.emplace(entity);
+        }
+
+        // Apres l'iteration : le groupe n'est pas modifie pendant le parcours
+        // Une entite sur un chemin repart vers l'etape suivante, les autres s'arretent
+        for (auto entity : m_arrived)
+        {
+            AdvancePath(registry, entity);
+        }
+    }
+
+    void MovementSystem::DeclareAccess(SystemAccess& access) const
+    {
+        access.Write<ECS::PositionComponent>()
+              .Write<ECS::VelocityComponent>()
+              .Write<ECS::MoveTargetComponent>()
+              .Write<ECS::MovementDirtyTag>()
+              .Write<ECS::PathComponent>()
+              .WriteResource<SpatialGrid>(); // patch de Position alimente la liste de la grille
+    }
+
+    bool MovementSystem::SetDestination(entt::registry& registry, entt::entity entity, float targetX, float targetY, float speed)
+    {
+        // Un calcul de chemin encore en vol sera ignore a sa livraison
+        registry.remove<ECS::PathComponent, ECS::PathRequestComponent>(entity);
+        return StartLeg(registry, entity, targetX, targetY, speed);
+    }
+
+    void MovementSystem::FollowPath(entt::registry& registry, entt::entity entity, std::vector<ECS::PathWaypoint> waypoints, float speed)
+    {
+        registry.emplace_or_replace<ECS::PathComponent>(entity, ECS::PathComponent{ std::move(waypoints), 0, speed });
+        AdvancePath(registry, entity);
+    }
+
+    void MovementSystem::AdvancePath(entt::registry& registry, entt::entity entity)
+    {
+        // Etapes deja atteintes sautees (chemin tres court, depart sur une etape)
+        if (auto* path = registry.try_get<ECS::PathComponent>(entity))
+        {
+            while (path->next < path->waypoints.size())
+            {
+                const auto& waypoint = path->waypoints[path->next++];
+                if (StartLeg(registry, entity, waypoint.x, waypoint.y, path->speed))
+                    return;
+            }
+        }
+
+        registry.remove<ECS::VelocityComponent, ECS::MoveTargetComponent, ECS::PathComponent>(entity);
+        registry.emplace_or_replace<ECS::MovementDirtyTag>(entity);
+    }
+
+    bool MovementSystem::StartLeg(entt::registry& registry, entt::entity entity, float targetX, float targetY, float speed)
+    {
+        const auto& position = registry.get<ECS::PositionComponent>(entity);
+
+        float dx = targetX - position.x;
+        float dy = targetY - position.y;
+        float distance = std::sqrt(dx * dx + dy * dy);
+        registry.emplace_or_replace<ECS::MovementDirtyTag>(entity);
+        if (distance <= 1e-4f || speed <= 0.0f)
+        {
+            registry.remove<ECS::VelocityComponent, ECS::MoveTargetComponent>(entity);
+            return false;
+        }
+
+        float scale = speed / distance;
+        registry.emplace_or_replace<ECS::VelocityComponent>(entity, ECS::VelocityComponent{ dx * scale, dy * scale });
+        registry.emplace_or_replace<ECS::MoveTargetComponent>(entity, ECS::MoveTargetComponent{ targetX, targetY });
+        return true;
+    }
+}
@@ -13,5 +13,22 @@ namespace MMO
         int maxPlayers = 1000;
         std::string kingdomsConfigPath = "kingdoms.json";    // Chemin du fichier de config des royaumes
         std::string dbPath = "game.db";                      // Chemin de la base de donnees
+        int workerThreads = 0;                               // Threads du pool de tick (royaumes et systemes en parallele, 0 = sequentiel)
+        int pathThreads = 1;                                 // Threads dedies au pathfinding (au moins 1, jamais le thread du tick)
+        std::string tickScheduler = "precise";               // Attente entre ticks : "precise", "lowpower" ou "spin"
+        float callbackBudgetMs = 10.0f;                      // Budget par tick pour les callbacks main thread (le reste est reporte)
+        std::string overloadPolicy = "catchup";              // Tick en retard : "catchup" (pas fixes), "stretch" (dt allonge) ou "drop"
+        int maxCatchUpSteps = 5;                             // Retard maximum rattrape, en ticks (au-dela le temps est abandonne)
+        std::string snapshotDir = "snapshots";               // Dossier des snapshots de royaume, recharges au demarrage (vide = desactive)
+        int snapshotIntervalSec = 300;                       // Periode des snapshots en secondes (0 = seulement a l'arret)
+        int hibernateAfterSec = 0;                           // Royaume sans joueur decharge sur disque apres ce delai (0 = toujours resident, exige snapshotDir)
+        bool shardMode = false;                              // N'heberge que les royaumes dont ip/port (kingdoms.json) sont publicIp/port, redirige vers les autres
+        std::string publicIp = "127.0.0.1";                  // Adresse de ce processus telle que les clients la joignent (mode shard)
+        std::string shardDir = "shards";                     // Dossier partage des baux de propriete des royaumes (mode shard)
+        std::uint16_t controlPort = 0;                       // Port ENet entre processus pour la migration de royaumes (0 = port + 1000, mode shard)
+        std::string controlBind = "127.0.0.1";               // Interface d'ecoute du canal de controle (0.0.0.0 : toutes, publicIp est alors annoncee)
+        std::string controlSecret;                           // Secret partage des liens de controle (vide = MMO_CONTROL_SECRET, sinon migration desactivee)
+        std::string recordPath;                              // Enregistre le trafic entrant dans ce fichier (vide = desactive)
+        std::string replayPath;                              // Rejoue ce fichier sans socket, sans attente entre ticks (vide = mode normal)
     };
 }
\ No newline at end of file
@@ -3,15 +3,29 @@
 #include <chrono>
 #include <functional>
 #include <memory>
+#include <span>
 #include <unordered_map>
+#include <vector>
 #include "core/Config.h"
 #include "core/CommandSystem.h"
+#include "core/TickProfiler.h"
+#include "core/TickScheduler.h"
+#include "core/MainThreadQueue.h"
+#include "core/MigrationManager.h"
 #include "world/KingdomWorld.h"
-#include "database/ConcurrentQueue.h"
+#include "world/KingdomRegistry.h"
+#include "world/WorldMap.h"
+#include "world/PathfindingService.h"
+#include "world/ShardDirectory.h"
 #include "network/NetworkManager.h"
+#include "network/ControlHost.h"
+#include "network/PlayerCommandRouter.h"
+#include "network/ReplicationManager.h"
 #include "database/DatabaseManager.h"
 #include "database/repositories/IAccountRepository.h"
 #include "database/repositories/IPlayerRepository.h"
+#include "utils/ThreadPool.h"
+#include "utils/Time.h"
 
 
 class GameLoop 
@@ -22,9 +36,16 @@ public:
     void Stop();
 
     // Planifie un callback sur le thread principal (thread-safe)
-    void EnqueueMainThreadCallback(std::function<void()> callback);
+    void EnqueueMainThreadCallback(std::function<void()> callback,
+        MMO::Core::CallbackPriority priority = MMO::Core::CallbackPriority::Gameplay);
 
 private:
+    // Execute un tick complet (reseau entrant, logique, reseau sortant) et retourne sa duree en ms
+    float ExecuteTick(float dt);
+
+    // Rejoue un enregistrement reseau sans socket et sans attente entre les ticks
+    void RunReplay();
+
     void ProcessNetworkIn();
     void UpdateLogic(float dt);
     void ProcessNetworkOut();
@@ -32,23 +53,153 @@ private:
     // Configure le nettoyage ECS a la deconnexion d'un joueur
     void SetupDisconnectHandler();
 
-    // Charge les royaumes depuis le fichier de configuration
+    // Regle et sauvegarde les ressources et l'armee d'un joueur (deconnexion)
+    void PersistResources(entt::registry& registry, entt::entity entity, int kingdomId);
+
+    // Retire l'entite d'un joueur parti apres sauvegarde. Armee engagee : l'entite reste hors ligne jusqu'a la fin
+    // de ses batailles (une deconnexion n'abandonne ni ne soigne rien)
+    void RemovePlayerEntity(MMO::Core::KingdomWorld& world, entt::entity entity);
+
+    // Une fois par seconde : sauvegarde et detruit les joueurs hors ligne dont les batailles sont finies
+    void ReleaseOfflinePlayers();
+
+    // Charge le catalogue des royaumes depuis le fichier de configuration et cree les royaumes residents
     void LoadKingdoms();
 
+    // Cree un royaume et le branche aux services du serveur (profiler...)
+    MMO::Core::KingdomWorld& CreateKingdom(const MMO::Core::KingdomInfo& info);
+
+    // Carte statique d'un royaume (projetee une seule fois, partagee). Main thread uniquement
+    std::shared_ptr<const MMO::Core::WorldMap> LoadKingdomMap(const MMO::Core::KingdomInfo& info);
+
+    // Construit un royaume et ses systemes sans toucher a l'etat du GameLoop (appelable hors du main thread)
+    static std::unique_ptr<MMO::Core::KingdomWorld> BuildKingdom(const MMO::Core::KingdomInfo& info,
+        std::shared_ptr<const MMO::Core::WorldMap> map);
+
+    // Branche un royaume construit aux services du serveur et le rend resident (ticke, visible des handlers)
+    MMO::Core::KingdomWorld& AttachKingdom(std::unique_ptr<MMO::Core::KingdomWorld> world);
+
     // Enregistre tous les handlers reseau
     void RegisterHandlers();
 
+    // Tick tous les royaumes — en parallele sur le pool si configure, barriere incluse
+    void TickKingdoms(float dt);
+
+    // Recharge le snapshot de chaque royaume (en parallele sur le pool) puis le met de cote
+    void LoadSnapshots();
+
+    // Capture tous les royaumes entre deux ticks et confie l'ecriture au thread de snapshot
+    void SaveSnapshots(bool isClean);
+
+    std::string GetSnapshotPath(int kingdomId) const;
+
+    // Arret pendant une migration dont le commit est sans reponse : le monde gele est ecrit a part
+    // (kingdom_<id>.snap.handoff), hors du snapshot d'arret
+    void SaveHandoffSnapshot(int kingdomId);
+
+    // Demarrage : ce snapshot remplace celui du royaume s'il est reste ici, il est abandonne si la cible l'a pris
+    void ResolveHandoffSnapshot(int kingdomId, bool isLocal);
+
+    // --- Hibernation : un royaume sans joueur est sauvegarde puis decharge, et recharge a la selection ---
+
+    // Cycle de vie d'un royaume du catalogue
+    enum class KingdomResidency
+    {
+        Resident,       // En memoire, ticke
+        Hibernating,    // Retire du tick, snapshot en cours d'ecriture (monde garde en memoire)
+        Hibernated,     // Sur disque uniquement
+        Waking,         // Rechargement en cours sur le thread de snapshot
+        Migrating       // Retire du tick, snapshot en transfert vers un autre processus (monde garde en memoire)
+    };
+
+    struct KingdomSlot
+    {
+        MMO::Core::KingdomInfo info;
+        KingdomResidency residency = KingdomResidency::Resident;
+        uint64_t idleSinceTick = 0;                             // Dernier tick avec un joueur (ou une entree en cours)
+        std::unique_ptr<MMO::Core::KingdomWorld> parked;        // Monde en cours d'hibernation
+        std::vector<std::function<void(bool)>> waiters;         // Entrees en attente du reveil
+    };
+
+    bool IsHibernationEnabled() const { return m_snapshotIO && m_config.hibernateAfterSec > 0; }
+
+    // Rend le royaume resident puis appelle onReady (main thread) ; le reveil se fait hors du tick
+    void RequestKingdom(int kingdomId, std::function<void(bool)> onReady);
+
+    // Une fois par seconde : hiberne les royaumes sans session depuis hibernateAfterSec
+    void HibernateIdleKingdoms();
+    void HibernateKingdom(int kingdomId);
+    void OnKingdomHibernated(int kingdomId, bool isWritten);
+
+    void WakeKingdom(KingdomSlot& slot);
+    // world nullptr : snapshot illisible, le royaume reste hiberne (fichier garde)
+    void OnKingdomWoken(int kingdomId, std::unique_ptr<MMO::Core::KingdomWorld> world);
+
+    // Le snapshot d'un royaume redevenu resident est consomme (un crash ne doit pas le recharger perime)
+    void ConsumeSnapshot(int kingdomId);
+
+    static void NotifyKingdomWaiters(KingdomSlot& slot, bool isReady);
+
+    // Etat de chaque royaume du catalogue (commande console "kingdoms")
+    void PrintKingdoms() const;
+
+    // Joueurs par royaume, en un parcours des sessions
+    std::unordered_map<int, int> CountSessionsByKingdom() const;
+
+    // Mode shard : renouvelle le bail de ce processus et relit ceux des autres (thread d'E/S dedie)
+    void PublishShardLease();
+
+    // Migration (mode shard) : branche le MigrationManager sur le cycle de vie des royaumes
+    void CreateMigrationManager();
+
     MMO::ServerConfig m_config;
     std::atomic<bool> m_isRunning;
-    std::chrono::milliseconds m_tickDuration;
+    std::chrono::microseconds m_tickDuration; // Duree d'un tick (en microsecondes : pas d'arrondi a 30 Hz)
+    uint64_t m_tickCount = 0; // Numero du tick courant (horodatage de l'enregistrement reseau)
 
-    // Royaumes — chaque monde a sa propre registry ECS
+    // Royaumes residents — chaque monde a sa propre registry ECS
     std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>> m_kingdoms;
+    std::vector<MMO::Core::KingdomInfo> m_kingdomCatalog; // Tous les royaumes (residents ou hiberne), fixe apres LoadKingdoms
+    std::unordered_map<int, KingdomSlot> m_kingdomSlots;
+    MMO::Core::WorldMapCache m_mapCache; // Une projection par fichier de carte, partagee entre royaumes
+    std::vector<MMO::Core::KingdomWorld*> m_tickList; // Reutilise a chaque tick (evite l'allocation)
+
+    // Pool de workers pour le tick parallele des royaumes et des systemes (nullptr = sequentiel)
+    std::unique_ptr<MMO::Utils::ThreadPool> m_workerPool;
+
+    // Calcul des chemins sur ses propres threads, partage par tous les royaumes
+    std::unique_ptr<MMO::Core::PathfindingService> m_pathfinding;
+
+    // E/S des snapshots hors du tick (1 thread : une ecriture d'hibernation precede toujours la relecture du reveil)
+    std::unique_ptr<MMO::Utils::ThreadPool> m_snapshotIO;
+    uint64_t m_nextSnapshotTick = 0;
+
+    // Mode shard : propriete des royaumes entre processus (nullptr = ce processus les heberge tous)
+    std::unique_ptr<MMO::Core::ShardDirectory> m_shards;
+    std::unique_ptr<MMO::Utils::ThreadPool> m_shardIO;
+
+    // Canal de controle entre processus (mode shard) et migrations qu'il transporte
+    std::unique_ptr<MMO::Network::ControlHost> m_control;
+    std::unique_ptr<MMO::Core::MigrationManager> m_migrations;
 
     std::unique_ptr<MMO::Network::NetworkManager> m_networkManager;
+    std::unique_ptr<MMO::Network::PlayerCommandRouter> m_playerCommands; // Paquets de gameplay (royaume resident ou gele)
+    MMO::Network::ReplicationManager m_replication;
     std::shared_ptr<MMO::Database::DatabaseManager> m_dbManager;
     std::shared_ptr<MMO::Database::IAccountRepository> m_accountRepo;
     std::shared_ptr<MMO::Database::IPlayerRepository> m_playerRepo;
     MMO::Core::CommandSystem m_commandSystem;
-    MMO::Core::ConcurrentQueue<std::function<void()>> m_mainThreadCallbacks;
+    MMO::Core::TickProfiler m_profiler;
+
+    // Histogrammes des phases du tick, resolus dans Run()
+    struct PhaseHistograms
+    {
+        MMO::Core::TimingHistogram* networkIn = nullptr;
+        MMO::Core::TimingHistogram* networkOut = nullptr;
+        MMO::Core::TimingHistogram* callbacks = nullptr;
+        MMO::Core::TimingHistogram* kingdoms = nullptr;
+        MMO::Core::TimingHistogram* total = nullptr;
+    } m_phaseHistograms;
+    std::unique_ptr<MMO::Core::ITickScheduler> m_tickScheduler;
+    MMO::Core::MainThreadQueue m_mainThreadCallbacks;
 };
@@ -0,0 +1,67 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+
+namespace MMO::Core
+{
+    // Classes de priorite des callbacks main thread (traitees dans cet ordre, FIFO dans une classe)
+    enum class CallbackPriority : uint8_t
+    {
+        Gameplay = 0,       // Etat du monde (royaume reveille ou recu par migration)
+        Session = 1,        // Cycle de vie des connexions : login, entree en royaume, nettoyage a la deconnexion
+        Background = 2,     // Maintenance qui peut attendre (snapshot periodique, hibernation)
+        Count
+    };
+
+    // File de callbacks a executer sur le thread principal (push thread-safe)
+    // Videe sous un budget de temps par tick : le reste est reporte au tick suivant
+    class MainThreadQueue
+    {
+    public:
+        using Callback = std::function<void()>;
+
+        static constexpr size_t PRIORITY_COUNT = static_cast<size_t>(CallbackPriority::Count);
+
+        struct Stats
+        {
+            std::array<size_t, PRIORITY_COUNT> depth{};         // Callbacks en attente par classe
+            std::array<uint64_t, PRIORITY_COUNT> executed{};    // Total execute par classe
+            size_t lastCarryOver = 0;                           // Reportes lors du dernier Drain
+            uint64_t carryOverTicks = 0;                        // Nombre de ticks ayant reporte du travail
+            uint64_t totalCarriedOver = 0;                      // Somme des reports sur tous les ticks
+        };
+
+        // Ajoute un callback (appelable depuis n'importe quel thread)
+        void Push(Callback callback, CallbackPriority priority);
+
+        // Execute les callbacks par priorite jusqu'a epuisement du budget (main thread uniquement)
+        // Chaque classe non vide avance d'au moins un callback par tick : aucune famine possible
+        // Retourne le nombre de callbacks executes
+        size_t Drain(float budgetMs);
+
+        // Nombre total de callbacks en attente
+        size_t GetDepth() const;
+
+        Stats GetStats() const;
+
+        // Affiche la profondeur et les compteurs de report
+        void PrintStats() const;
+
+    private:
+        // Retire le prochain callback d'une classe (nullptr si vide)
+        Callback TryPop(size_t priorityIndex);
+
+        mutable std::mutex m_mutex;
+        std::array<std::deque<Callback>, PRIORITY_COUNT> m_queues;
+
+        // Compteurs mis a jour sous mutex en fin de Drain
+        std::array<uint64_t, PRIORITY_COUNT> m_executed{};
+        size_t m_lastCarryOver = 0;
+        uint64_t m_carryOverTicks = 0;
+        uint64_t m_totalCarriedOver = 0;
+    };
+}
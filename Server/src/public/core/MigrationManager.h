@@ -0,0 +1,176 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <entt/entt.hpp>
+#include "core/MainThreadQueue.h"
+#include "core/TickProfiler.h"
+#include "world/KingdomRegistry.h"
+#include "world/KingdomWorld.h"
+#include "world/ShardDirectory.h"
+#include "world/WorldMap.h"
+#include "network/ControlHost.h"
+#include "network/PlayerCommandRouter.h"
+#include "network/SessionManager.h"
+#include "utils/ThreadPool.h"
+#include "utils/Time.h"
+
+namespace MMO::Network
+{
+    struct MigrationChunk;
+    struct MigrationResult;
+    struct MigrationCommit;
+    struct MigrationCommitted;
+}
+
+
+namespace MMO::Core
+{
+    // Services du GameLoop dont la migration a besoin (main thread sauf mention)
+    struct MigrationContext
+    {
+        Network::ControlHost* control = nullptr;
+        ShardDirectory* shards = nullptr;
+        Utils::ThreadPool* shardIO = nullptr;                   // Chargement des royaumes recus, hors du tick
+        Network::SessionManager* sessionManager = nullptr;
+        Network::PlayerCommandRouter* playerCommands = nullptr;
+        TickProfiler* profiler = nullptr;
+        const std::vector<KingdomInfo>* catalog = nullptr;
+        const uint64_t* tickCount = nullptr;                    // Tick courant du GameLoop (echeances)
+        int tickRate = 30;
+
+        // Cycle de vie des royaumes, tenu par le GameLoop
+        std::function<void(int kingdomId, std::function<void(bool)> onReady)> requestKingdom; // Rend resident puis onReady
+        std::function<KingdomWorld*(int kingdomId)> freezeKingdom;          // Sort du tick, garde en memoire (nullptr : non resident)
+        std::function<KingdomWorld*(int kingdomId)> findKingdom;            // Resident et dans le tick, sinon nullptr
+        std::function<KingdomWorld*(int kingdomId)> findFrozenKingdom;
+        std::function<KingdomWorld&(int kingdomId)> thawKingdom;            // Gel annule : le monde reprend le tick
+        std::function<void(int kingdomId, bool isReady)> notifyWaiters;     // Entrees en attente du royaume
+        std::function<void(int kingdomId)> releaseKingdom;                  // Parti : monde et snapshot local abandonnes
+        std::function<KingdomWorld&(std::unique_ptr<KingdomWorld> world)> adoptKingdom; // Recu : rendu resident
+        std::function<std::shared_ptr<const WorldMap>(const KingdomInfo& info)> loadMap;
+        std::function<std::unique_ptr<KingdomWorld>(const KingdomInfo& info,
+            std::shared_ptr<const WorldMap> map)> buildKingdom;             // Appelable hors du main thread
+        std::function<void(entt::registry& registry, entt::entity entity, int kingdomId)> persistPlayer;
+        std::function<void(KingdomWorld& world, entt::entity entity)> removePlayer;
+        std::function<void()> publishLease;
+        std::function<void(std::function<void()> callback, CallbackPriority priority)> runOnMainThread;
+    };
+
+    // Migration d'un royaume vivant vers un autre processus (mode shard, commande console "migrate")
+    // Protocole en deux phases sur le canal de controle : la source gele le royaume et envoie son snapshot par morceaux,
+    // la cible le charge hors du tick et le garde en attente, puis ne le revendique qu'au commit de la source.
+    // Les joueurs ne sont rediriges qu'une fois le commit confirme. Main thread uniquement, pilote par le GameLoop
+    // Les batailles ne sont pas serialisees : le gel attend qu'il n'y en ait plus, sinon la migration expire
+    class MigrationManager
+    {
+    public:
+        explicit MigrationManager(MigrationContext context);
+
+        MigrationManager(const MigrationManager&) = delete;
+        MigrationManager& operator=(const MigrationManager&) = delete;
+
+        // Branche les messages et les liens du canal de controle
+        void RegisterHandlers();
+
+        // Source : lance la migration d'un royaume heberge ici
+        void Start(int kingdomId, const ShardEndpoint& target);
+
+        // Paquet d'un joueur d'un royaume gele : garde pour la cible, ou rejoue ici si la migration est annulee
+        void DeferPlayerCommand(const Network::PlayerSession& session, Network::Opcode opcode, std::span<const uint8_t> payload);
+
+        // Une fois par seconde : delais, commits sans reponse, transferts entrants abandonnes
+        void CheckTimeouts();
+
+        // Arret du serveur : une migration sans commit rend son royaume. Apres le commit, jamais d'annulation
+        // (la cible l'a peut-etre applique) : renvoie ces royaumes, qui restent geles
+        std::vector<int> Shutdown();
+
+    private:
+        // Paquet de gameplay recu pendant le gel : applique par la cible avant qu'elle ne prenne le royaume,
+        // ou rejoue ici si la migration est annulee
+        struct FrozenCommand
+        {
+            int accountId = 0;
+            entt::entity entity = entt::null;
+            Network::Opcode opcode = Network::Opcode_None;
+            std::vector<uint8_t> payload;
+        };
+
+        // Migration sortante : le royaume est gele des que la cible est joignable, transfere,
+        // puis la cible ne le revendique qu'au commit
+        struct OutgoingMigration
+        {
+            ShardEndpoint target;
+            Network::ControlLinkId link = Network::INVALID_CONTROL_LINK;   // INVALID : reconnexion au prochain controle
+            uint64_t deadlineTick = 0;
+            bool isWaitingForBattles = false;           // Cible joignable, gel differe jusqu'a la fin des batailles
+            bool isFrozen = false;
+            bool isCommitSent = false;                  // Issue incertaine jusqu'a la reponse : jamais annulee tant que la cible vit
+            std::vector<entt::entity> onlineEntities;   // Joueurs connectes au gel
+            std::vector<FrozenCommand> commands;        // Dans l'ordre de reception
+            size_t commandBytes = 0;
+            uint32_t appliedCommands = 0;               // Confirmees par la cible
+            Time::Stopwatch freezeTimer;
+            size_t snapshotBytes = 0;
+        };
+
+        // Migration entrante : morceaux recus dans l'ordre, charges hors du tick une fois complets,
+        // puis monde gare jusqu'au commit de la source (abandonne si le lien tombe avant)
+        struct IncomingMigration
+        {
+            Network::ControlLinkId link = Network::INVALID_CONTROL_LINK;
+            ShardEndpoint source;
+            uint64_t deadlineTick = 0;
+            std::vector<uint8_t> buffer;
+            uint64_t snapshotSize = 0;
+            uint32_t nextChunk = 0;
+            uint32_t chunkCount = 0;
+            std::unique_ptr<KingdomWorld> world;        // Charge, en attente du commit
+        };
+
+        // Royaume recu par migration : un commit rejoue par la meme source n'applique que les nouvelles commandes
+        struct ReceivedKingdom
+        {
+            ShardEndpoint source;
+            uint32_t appliedCommands = 0;
+        };
+
+        void OnControlLink(Network::ControlLinkId link, bool isConnected, const Network::ControlAddress& remote);
+
+        // Source
+        void FreezeWhenResident(int kingdomId);
+        void SendKingdomSnapshot(int kingdomId);
+        void OnMigrationResult(Network::ControlLinkId link, const Network::MigrationResult& result);
+        void SendMigrationCommit(int kingdomId);
+        void OnMigrationCommitted(Network::ControlLinkId link, const Network::MigrationCommitted& committed);
+        void RetryMigrationCommit(int kingdomId);
+        void CompleteMigration(int kingdomId);
+        void AbortMigration(int kingdomId, const std::string& reason);
+
+        // Cible
+        void OnMigrationChunk(Network::ControlLinkId link, const Network::MigrationChunk& chunk);
+        void LoadMigratedKingdom(int kingdomId);
+        void OnMigrationLoaded(int kingdomId, std::unique_ptr<KingdomWorld> world);
+        void SendMigrationResult(Network::ControlLinkId link, int kingdomId, bool isSuccess, const std::string& message);
+        void OnMigrationCommit(Network::ControlLinkId link, const Network::MigrationCommit& commit);
+
+        // Applique les commandes du commit d'index >= applied au monde recu, met applied a jour
+        void ApplyMigratedCommands(KingdomWorld& world, int kingdomId, const Network::MigrationCommit& commit, uint32_t& applied);
+        void SendMigrationCommitted(Network::ControlLinkId link, int kingdomId, bool isSuccess, uint32_t appliedCommands);
+
+        const KingdomInfo* FindCatalogEntry(int kingdomId) const;
+        uint64_t GetDeadlineTick() const;
+
+        MigrationContext m_context;
+
+        std::unordered_map<int, OutgoingMigration> m_outgoing;
+        std::unordered_map<int, IncomingMigration> m_incoming;
+        std::unordered_map<int, ReceivedKingdom> m_received;
+        std::unordered_map<Network::ControlLinkId, ShardEndpoint> m_controlPeers;   // Lien authentifie → processus distant
+    };
+}
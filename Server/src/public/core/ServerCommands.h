@@ -1,5 +1,9 @@
 #pragma once
 #include "core/CommandSystem.h"
+#include "core/TickProfiler.h"
+#include "core/MainThreadQueue.h"
+#include "network/ReplicationManager.h"
+#include "world/PathfindingService.h"
 #include <string>
 #include <functional>
 
@@ -11,6 +15,13 @@ namespace MMO::Core
     {
         std::string dbPath;
         std::function<void()> stopServer;
+        TickProfiler* profiler = nullptr;
+        const MainThreadQueue* mainThreadQueue = nullptr;
+        const MMO::Network::ReplicationManager* replication = nullptr;
+        const PathfindingService* pathfinding = nullptr;
+        std::function<void()> saveSnapshots;
+        std::function<void()> printKingdoms;
+        std::function<void(int kingdomId, const std::string& ip, uint16_t port)> migrateKingdom;
     };
 
     // Enregistre toutes les commandes serveur
@@ -0,0 +1,151 @@
+#pragma once
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+
+namespace MMO::Core
+{
+    // Poste un travail sur un thread donne (ex: runOnMainThread). Vide = reprise sur le thread qui termine l'operation
+    using Executor = std::function<void(std::function<void()>)>;
+
+    // Compteurs globaux des coroutines (commande console "tasks")
+    struct TaskStats
+    {
+        uint64_t started = 0;           // Coroutines lancees
+        uint64_t live = 0;              // Coroutines en cours (frame encore allouee)
+        uint64_t frameAllocations = 0;  // Allocations de frames (une par coroutine)
+        uint64_t frameBytes = 0;        // Octets alloues pour les frames
+        uint64_t executorHops = 0;      // Reprises postees sur un executor (changement de thread)
+        uint64_t inlineResumes = 0;     // Reprises directes sur le thread qui a termine l'operation
+        uint64_t failures = 0;          // Exceptions non rattrapees dans une coroutine
+    };
+
+    namespace Detail
+    {
+        struct TaskCounters
+        {
+            std::atomic<uint64_t> started{ 0 };
+            std::atomic<uint64_t> live{ 0 };
+            std::atomic<uint64_t> frameAllocations{ 0 };
+            std::atomic<uint64_t> frameBytes{ 0 };
+            std::atomic<uint64_t> executorHops{ 0 };
+            std::atomic<uint64_t> inlineResumes{ 0 };
+            std::atomic<uint64_t> failures{ 0 };
+        };
+
+        TaskCounters& GetTaskCounters();
+
+        // Reprend la coroutine via l'executor, ou directement s'il est vide
+        inline void Resume(std::coroutine_handle<> handle, const Executor& executor)
+        {
+            auto& counters = GetTaskCounters();
+            if (executor)
+            {
+                counters.executorHops.fetch_add(1, std::memory_order_relaxed);
+                executor([handle]() { handle.resume(); }); // Capture de 8 octets : pas d'allocation dans std::function
+            }
+            else
+            {
+                counters.inlineResumes.fetch_add(1, std::memory_order_relaxed);
+                handle.resume();
+            }
+        }
+    }
+
+    // Coroutine "fire-and-forget" : demarre immediatement, la frame se libere a la fin
+    // Les exceptions non rattrapees sont loguees et comptees, jamais propagees
+    class Task
+    {
+    public:
+        struct promise_type
+        {
+            Task get_return_object() noexcept { return {}; }
+            std::suspend_never initial_suspend() noexcept
+            {
+                Detail::GetTaskCounters().started.fetch_add(1, std::memory_order_relaxed);
+                return {};
+            }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept;
+
+            // Frame allouee via la promesse pour mesurer le cout de chaque coroutine
+            static void* operator new(std::size_t size);
+            static void operator delete(void* ptr, std::size_t size) noexcept;
+        };
+    };
+
+    // Operation asynchrone lancee des sa construction, attendue plus tard avec co_await
+    // Permet de lancer plusieurs requetes DB d'un coup avant d'attendre la premiere
+    // Le resultat reste dans la frame de la coroutine : co_await retourne une reference, sans copie
+    // L'operation doit toujours etre attendue avant la fin de la coroutine
+    template<typename T>
+    class AsyncOperation
+    {
+    public:
+        // start(callback) : lance l'operation, qui appelle callback(T) sur n'importe quel thread
+        template<typename Starter>
+        explicit AsyncOperation(Starter&& start, Executor resumeOn = {}) : m_resumeOn(std::move(resumeOn))
+        {
+            start([this](T value) { Complete(std::move(value)); });
+        }
+
+        AsyncOperation(const AsyncOperation&) = delete;
+        AsyncOperation& operator=(const AsyncOperation&) = delete;
+
+        bool await_ready() const noexcept { return m_state.load(std::memory_order_acquire) == READY; }
+
+        // Retourne false si l'operation s'est terminee entre-temps (reprise immediate)
+        bool await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            void* expected = nullptr;
+            return m_state.compare_exchange_strong(expected, handle.address(),
+                std::memory_order_acq_rel, std::memory_order_acquire);
+        }
+
+        T& await_resume() noexcept { return m_value; }
+
+    private:
+        static inline void* const READY = reinterpret_cast<void*>(uintptr_t{ 1 });
+
+        void Complete(T value)
+        {
+            m_value = std::move(value);
+
+            // Etat : nullptr (en cours), READY (termine) ou adresse de la coroutine en attente
+            void* waiter = m_state.exchange(READY, std::memory_order_acq_rel);
+            if (waiter != nullptr)
+            {
+                // La coroutine peut detruire cet objet en reprenant : rien ne doit suivre
+                Detail::Resume(std::coroutine_handle<>::from_address(waiter), m_resumeOn);
+            }
+        }
+
+        Executor m_resumeOn;
+        T m_value{};
+        std::atomic<void*> m_state{ nullptr };
+    };
+
+    // co_await SwitchTo(executor) : reprend la coroutine sur le thread de l'executor
+    class SwitchTo
+    {
+    public:
+        explicit SwitchTo(const Executor& executor) : m_executor(executor) {}
+
+        bool await_ready() const noexcept { return !m_executor; }
+        void await_suspend(std::coroutine_handle<> handle) const { Detail::Resume(handle, m_executor); }
+        void await_resume() const noexcept {}
+
+    private:
+        const Executor& m_executor;
+    };
+
+    TaskStats GetTaskStats();
+
+    // Affiche les compteurs des coroutines
+    void PrintTaskStats();
+}
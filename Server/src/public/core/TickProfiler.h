@@ -0,0 +1,88 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "utils/Time.h"
+
+
+namespace MMO::Core
+{
+    // Histogramme de durees thread-safe
+    // Buckets logarithmiques en microsecondes (4 sous-buckets par puissance de 2, ~25% de precision)
+    class TimingHistogram
+    {
+    public:
+        TimingHistogram() { Reset(); }
+
+        // Enregistre une duree (lock-free, appelable depuis n'importe quel thread)
+        void Record(float milliseconds);
+
+        // Retourne la duree (ms) sous laquelle tombent p% des echantillons (p dans [0, 1])
+        [[nodiscard]] float Percentile(float p) const;
+
+        [[nodiscard]] float GetMax() const { return static_cast<float>(m_maxMicros.load(std::memory_order_relaxed)) / 1000.0f; }
+        [[nodiscard]] float GetMean() const;
+        [[nodiscard]] uint64_t GetCount() const { return m_count.load(std::memory_order_relaxed); }
+
+        // Remet tous les compteurs a zero
+        void Reset();
+
+    private:
+        static constexpr int EXACT_BUCKETS = 8;     // 0..7 us stockes tels quels
+        static constexpr int SUB_BUCKETS = 4;
+        static constexpr int BUCKET_COUNT = EXACT_BUCKETS + (32 - 3) * SUB_BUCKETS;
+
+        static int BucketIndex(uint64_t micros);
+        static uint64_t BucketUpperBound(int index);
+
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_buckets;
+        std::atomic<uint64_t> m_count;
+        std::atomic<uint64_t> m_totalMicros;
+        std::atomic<uint64_t> m_maxMicros;
+    };
+
+    // Profiler du tick serveur : un histogramme par phase, par royaume et par systeme
+    // Les histogrammes ne sont jamais detruits — les pointeurs retournes par Get() restent valides
+    class TickProfiler
+    {
+    public:
+        // Retourne (ou cree) l'histogramme associe a une clef
+        TimingHistogram& Get(const std::string& key);
+
+        // Raccourci pour les enregistrements ponctuels (lookup sous mutex)
+        void Record(const std::string& key, float milliseconds) { Get(key).Record(milliseconds); }
+
+        // Affiche p50/p99/max de chaque histogramme
+        void PrintReport() const;
+
+        // Remet tous les histogrammes a zero (les clefs sont conservees)
+        void Reset();
+
+    private:
+        mutable std::mutex m_mutex;
+        std::map<std::string, std::unique_ptr<TimingHistogram>> m_histograms; // Trie pour un rapport lisible
+    };
+
+    // Mesure la duree d'un scope et l'enregistre dans un histogramme a la destruction
+    class ScopedTimer
+    {
+    public:
+        explicit ScopedTimer(TimingHistogram* histogram) : m_histogram(histogram) {}
+        ~ScopedTimer()
+        {
+            if (m_histogram)
+                m_histogram->Record(m_stopwatch.ElapsedMilliseconds());
+        }
+
+        ScopedTimer(const ScopedTimer&) = delete;
+        ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    private:
+        TimingHistogram* m_histogram;
+        MMO::Time::Stopwatch m_stopwatch;
+    };
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <chrono>
+#include <memory>
+#include <string>
+
+
+namespace MMO::Core
+{
+    // Strategie d'attente entre deux ticks serveur
+    // Le GameLoop mesure le retard au reveil (jitter) de chaque strategie dans le profiler
+    class ITickScheduler
+    {
+    public:
+        using TimePoint = std::chrono::steady_clock::time_point;
+
+        virtual ~ITickScheduler() = default;
+
+        // Bloque jusqu'a l'echeance absolue (retourne immediatement si elle est deja passee)
+        virtual void WaitUntil(TimePoint deadline) = 0;
+
+        // Nom du mode (pour logs et clefs du profiler)
+        virtual std::string GetName() const = 0;
+    };
+
+    // Sleep OS jusqu'a 2 ms avant l'echeance puis spin sur yield (precis, mais consomme un coeur)
+    class SpinTickScheduler : public ITickScheduler
+    {
+    public:
+        void WaitUntil(TimePoint deadline) override;
+        std::string GetName() const override { return "spin"; }
+    };
+
+    // Sleep absolu haute resolution (clock_nanosleep TIMER_ABSTIME sous Linux / timer Win32 haute resolution,
+    // sleep_until standard ailleurs)
+    // Precision sub-milliseconde sans boucle active
+    class PreciseTickScheduler : public ITickScheduler
+    {
+    public:
+        PreciseTickScheduler();
+        ~PreciseTickScheduler() override;
+
+        void WaitUntil(TimePoint deadline) override;
+        std::string GetName() const override { return "precise"; }
+
+    private:
+        void* m_timerHandle = nullptr; // HANDLE du timer Win32 (nullptr hors Windows)
+    };
+
+    // Sleep standard sans reglage de precision : le moins couteux en CPU, le plus de jitter
+    class LowPowerTickScheduler : public ITickScheduler
+    {
+    public:
+        void WaitUntil(TimePoint deadline) override;
+        std::string GetName() const override { return "lowpower"; }
+    };
+
+    // Cree le scheduler correspondant au mode ("spin", "precise", "lowpower"). Mode inconnu → precise.
+    std::unique_ptr<ITickScheduler> CreateTickScheduler(const std::string& mode);
+}
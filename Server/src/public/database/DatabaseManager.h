@@ -21,12 +21,13 @@ namespace MMO::Database
         ~DatabaseManager();
 
         // Ouvre la base de donnees et demarre le worker thread
-        bool Initialize(const std::string& dbPath);
+        // isSynchronous : aucun worker, chaque job s'execute sur le thread appelant (replay reproductible)
+        bool Initialize(const std::string& dbPath, bool isSynchronous = false);
 
         // Arrete le worker thread et ferme la connexion
         void Shutdown();
 
-        // Ajoute un job a executer de maniere asynchrone
+        // Ajoute un job a executer de maniere asynchrone (immediatement en mode synchrone)
         void EnqueueJob(DatabaseJob job);
 
         // Cree les tables si elles n'existent pas encore
@@ -36,9 +37,15 @@ namespace MMO::Database
         // Boucle du thread de travail (consomme les jobs)
         void WorkerThreadMain();
 
+        void RunJob(const DatabaseJob& job);
+
+        // Migration legere : ALTER TABLE si la colonne n'existe pas encore
+        void AddColumnIfMissing(const std::string& table, const std::string& column, const std::string& definition);
+
         std::unique_ptr<SQLite::Database> m_db;
         std::thread m_workerThread;
         std::atomic<bool> m_isRunning;
+        bool m_isSynchronous = false;
         MMO::Core::ConcurrentQueue<DatabaseJob> m_jobQueue;
     };
 }
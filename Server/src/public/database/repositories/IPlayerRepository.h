@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <functional>
 #include <optional>
@@ -18,6 +19,31 @@ namespace MMO::Database
         int wood  = 500;
         int stone = 200;
         int gold  = 100;
+        int foodRate  = 300;            // Production horaire de base
+        int woodRate  = 300;
+        int stoneRate = 100;
+        int goldRate  = 50;
+        int64_t foodSettledAtMs  = 0;   // Date (ms Unix) a laquelle chaque montant est exact, 0 = jamais regle
+        int64_t woodSettledAtMs  = 0;
+        int64_t stoneSettledAtMs = 0;
+        int64_t goldSettledAtMs  = 0;
+        int troops = 1000;              // Armee (ECS::DEFAULT_TROOPS pour un nouveau profil)
+    };
+
+    // Montant d'une ressource et date (ms Unix) a laquelle il est exact
+    // Chaque stock garde sa propre date : la fraction d'unite en cours de production survit a la sauvegarde
+    struct StoredStock
+    {
+        int amount = 0;
+        int64_t settledAtMs = 0;
+    };
+
+    struct StoredResources
+    {
+        StoredStock food;
+        StoredStock wood;
+        StoredStock stone;
+        StoredStock gold;
     };
 
     // Interface pour l'acces aux donnees joueur
@@ -34,8 +60,10 @@ namespace MMO::Database
         virtual void Create(int accountId, int kingdomId,
             std::function<void(std::optional<PlayerData>)> callback) = 0;
 
-        // Met a jour les ressources d'un joueur dans un royaume
-        virtual void UpdateResources(int accountId, int kingdomId,
-            int food, int wood, int stone, int gold) = 0;
+        // Met a jour les ressources d'un joueur dans un royaume (chaque montant avec sa date de reglement)
+        virtual void UpdateResources(int accountId, int kingdomId, const StoredResources& resources) = 0;
+
+        // Met a jour l'armee d'un joueur dans un royaume (troupes vivantes, engagees comprises)
+        virtual void UpdateTroops(int accountId, int kingdomId, int troops) = 0;
     };
 }
@@ -19,8 +19,9 @@ namespace MMO::Database
         void Create(int accountId, int kingdomId,
             std::function<void(std::optional<PlayerData>)> callback) override;
 
-        void UpdateResources(int accountId, int kingdomId,
-            int food, int wood, int stone, int gold) override;
+        void UpdateResources(int accountId, int kingdomId, const StoredResources& resources) override;
+
+        void UpdateTroops(int accountId, int kingdomId, int troops) override;
 
     private:
         std::shared_ptr<DatabaseManager> m_dbManager;
@@ -0,0 +1,69 @@
+#pragma once
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <vector>
+
+
+namespace MMO::ECS
+{
+    // Armee de depart d'un nouveau joueur
+    constexpr uint32_t DEFAULT_TROOPS = 1000;
+    constexpr float DEFAULT_TROOP_ATTACK = 10.0f;   // Degats par troupe et par seconde
+    constexpr float DEFAULT_TROOP_DEFENSE = 1.0f;   // Multiplie les points de vie face aux degats
+    constexpr float DEFAULT_TROOP_HEALTH = 100.0f;  // Points de vie par troupe
+
+    // Distance maximale entre un attaquant et sa cible (zone visible 3x3)
+    constexpr float ATTACK_RANGE = 300.0f;
+
+    // Part des pertes d'une bataille seulement blessees, rendues a l'armee apres WOUNDED_RECOVERY_SEC
+    constexpr float WOUNDED_RATIO = 0.3f;
+    constexpr double WOUNDED_RECOVERY_SEC = 600.0;
+
+    // Armee d'un joueur, sauvegardee avec son profil. troops compte aussi les troupes engagees,
+    // rendues (moins les pertes) a la fin de leur bataille
+    struct ArmyComponent
+    {
+        uint32_t troops = DEFAULT_TROOPS;
+        uint32_t deployed = 0;          // Engagees dans une bataille (les batailles ne sont pas sauvegardees)
+        uint32_t wounded = 0;           // Hors de troops, en convalescence (timer TroopRecovery du royaume)
+        float attack = DEFAULT_TROOP_ATTACK;
+        float defense = DEFAULT_TROOP_DEFENSE;
+        float health = DEFAULT_TROOP_HEALTH;
+
+        uint32_t Available() const { return troops > deployed ? troops - deployed : 0; }
+    };
+
+    // Ordre d'attaque recu hors tick, consomme par le CombatSystem au tick suivant (le dernier ordre du tick l'emporte)
+    struct AttackOrderComponent
+    {
+        entt::entity target = entt::null;
+        uint32_t troops = 0;
+    };
+
+    enum class CombatEventKind : uint8_t
+    {
+        Engaged,
+        Round,
+        Victory,
+        Defeat
+    };
+
+    // Bilan d'une bataille pour un participant
+    struct CombatReport
+    {
+        uint32_t battleId = 0;
+        entt::entity target = entt::null;
+        CombatEventKind kind = CombatEventKind::Round;
+        uint32_t attackers = 0;         // Troupes restantes de chaque camp
+        uint32_t defenders = 0;
+        uint32_t troops = 0;            // Troupes restantes du participant dans la bataille
+        uint32_t losses = 0;            // Pertes du participant depuis le bilan precedent
+    };
+
+    // Bilans produits pendant le tick
+    // Poses par le combat, envoyes en un lot puis vides par la replication a la fin du tick
+    struct CombatReportComponent
+    {
+        std::vector<CombatReport> reports;
+    };
+}
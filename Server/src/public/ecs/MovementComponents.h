@@ -0,0 +1,51 @@
+#pragma once
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <vector>
+
+
+namespace MMO::ECS
+{
+    // Vitesse de base d'une entite en marche (unites monde par seconde)
+    constexpr float DEFAULT_MOVE_SPEED = 5.0f;
+
+    // Vitesse courante, fixee a chaque nouvelle destination (unites monde par seconde)
+    struct VelocityComponent
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+    };
+
+    // Destination d'une entite en marche — retiree a l'arrivee, avec la vitesse
+    struct MoveTargetComponent
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+    };
+
+    // Etape d'un chemin (position monde)
+    struct PathWaypoint
+    {
+        float x = 0.0f;
+        float y = 0.0f;
+    };
+
+    // Chemin calcule par le PathfindingService : l'entite marche d'etape en etape
+    struct PathComponent
+    {
+        std::vector<PathWaypoint> waypoints;
+        uint32_t next = 0;              // Prochaine etape a viser apres la destination courante
+        float speed = DEFAULT_MOVE_SPEED;
+    };
+
+    // Calcul de chemin en cours sur un worker — un resultat dont l'id ne correspond plus est ignore
+    struct PathRequestComponent
+    {
+        uint32_t requestId = 0;
+        float speed = DEFAULT_MOVE_SPEED;
+    };
+
+    // Etat de deplacement modifie pendant le tick (position, depart, arrivee)
+    // Pose par le mouvement, lu puis vide par la replication a la fin du tick
+    struct MovementDirtyTag {};
+}
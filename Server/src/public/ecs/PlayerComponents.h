@@ -1,18 +1,23 @@
 #pragma once
 #include <entt/entt.hpp>
-#include <string>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <type_traits>
 #include "core/Types.h"
+#include "utils/StringInterner.h"
 
 
 namespace MMO::ECS
 {
-    // Identite du joueur
+    // Identite du joueur. POD de 16 octets : le pseudo est un handle de l'interner global
     struct PlayerInfoComponent
     {
         PlayerID playerID = INVALID_PLAYER;
         int accountID = -1;
-        std::string username;
+        Utils::StringHandle username = Utils::EMPTY_STRING_HANDLE;     // Utils::Resolve pour le texte
     };
+    static_assert(std::is_trivially_copyable_v<PlayerInfoComponent>);
 
     // Position sur la carte du monde
     struct PositionComponent
@@ -21,12 +26,78 @@ namespace MMO::ECS
         float y = 0.0f;
     };
 
-    // Ressources du joueur
+    // Stock d'une ressource produit a la demande (montant, debit, date du dernier reglement)
+    // Rien n'est calcule par tick : la production ecoulee est ajoutee au reglement (lecture, depense, sauvegarde)
+    struct ResourceStock
+    {
+        static constexpr int64_t MS_PER_HOUR = 3'600'000;
+
+        int amount = 0;                 // Montant au dernier reglement
+        int ratePerHour = 0;            // Production horaire (negative pour une consommation)
+        int64_t settledAtMs = 0;        // Horloge murale (ms Unix) du dernier reglement
+
+        // Ajoute la production ecoulee depuis settledAtMs. Seul le temps converti en unites entieres
+        // est consomme : des reglements tres rapproches ne perdent pas la fraction en cours
+        void Settle(int64_t nowMs)
+        {
+            int64_t elapsed = nowMs - settledAtMs;
+            if (elapsed <= 0)
+                return;
+
+            if (ratePerHour == 0)
+            {
+                settledAtMs = nowMs;
+                return;
+            }
+
+            // Decoupe heures / reste pour eviter le debordement sur de longues absences
+            int64_t rate = ratePerHour < 0 ? -static_cast<int64_t>(ratePerHour) : ratePerHour;
+            int64_t units = (elapsed / MS_PER_HOUR) * rate + (elapsed % MS_PER_HOUR) * rate / MS_PER_HOUR;
+
+            if (units == 0)
+                return;
+
+            int64_t next = amount + (ratePerHour > 0 ? units : -units);
+            if (next < 0 || next > INT_MAX)
+            {
+                // Stock sature (vide ou plafond) : le temps restant n'a plus rien a produire
+                amount = static_cast<int>(std::clamp<int64_t>(next, 0, INT_MAX));
+                settledAtMs = nowMs;
+                return;
+            }
+
+            amount = static_cast<int>(next);
+            settledAtMs += units * MS_PER_HOUR / rate;
+        }
+
+        // Change le debit : la production a l'ancien debit est reglee d'abord
+        void SetRate(int newRatePerHour, int64_t nowMs)
+        {
+            Settle(nowMs);
+            ratePerHour = newRatePerHour;
+        }
+
+        // Ajoute (ou retire) un montant, plancher a 0. A appeler apres Settle
+        void Add(int delta)
+        {
+            amount = static_cast<int>(std::clamp<int64_t>(static_cast<int64_t>(amount) + delta, 0, INT_MAX));
+        }
+    };
+
+    // Ressources du joueur. Une cite inactive ne coute rien : les stocks ne bougent qu'au reglement
     struct ResourcesComponent
     {
-        int food  = 500;
-        int wood  = 500;
-        int stone = 200;
-        int gold  = 100;
+        ResourceStock food  { 500 };
+        ResourceStock wood  { 500 };
+        ResourceStock stone { 200 };
+        ResourceStock gold  { 100 };
+
+        void SettleAll(int64_t nowMs)
+        {
+            food.Settle(nowMs);
+            wood.Settle(nowMs);
+            stone.Settle(nowMs);
+            gold.Settle(nowMs);
+        }
     };
 }
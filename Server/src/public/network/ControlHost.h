@@ -0,0 +1,168 @@
+#pragma once
+#include "enet.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "Core_generated.h"
+#include "database/ConcurrentQueue.h"
+
+
+namespace MMO::Network
+{
+    // Lien avec un autre processus serveur (0 = invalide)
+    using ControlLinkId = uint32_t;
+    inline constexpr ControlLinkId INVALID_CONTROL_LINK = 0;
+
+    // Adresse d'un socket de controle (ip textuelle, port)
+    struct ControlAddress
+    {
+        std::string ip;
+        uint16_t port = 0;
+    };
+
+    // Canal ENet entre processus serveur (mode shard), sur un port distinct de celui des clients
+    // Un thread dedie sert le socket : un transfert volumineux avance a la vitesse du reseau, pas a celle du tick
+    // Les messages (Envelope, comme pour les clients) sont livres sur le main thread par ProcessEvents
+    //
+    // Securite : un lien entrant n'est accepte que depuis une adresse admise par l'Authorizer (processus vivant),
+    // puis chaque lien prouve la connaissance du secret partage (defi / reponse HMAC-SHA256 dans les deux sens)
+    // Un lien n'est annonce au main thread qu'une fois authentifie ; avant, tout autre message le ferme
+    class ControlHost
+    {
+    public:
+        using MessageHandler = std::function<void(ControlLinkId link, const flatbuffers::Vector<uint8_t>* payload)>;
+        using LinkCallback = std::function<void(ControlLinkId link, bool isConnected, const ControlAddress& remote)>;
+
+        // Appele sur le thread reseau a chaque connexion entrante : true si l'adresse est celle d'un processus connu
+        using Authorizer = std::function<bool(const ControlAddress& remote)>;
+
+        static constexpr size_t NONCE_SIZE = 32;
+
+        ControlHost() = default;
+        ~ControlHost();
+
+        ControlHost(const ControlHost&) = delete;
+        ControlHost& operator=(const ControlHost&) = delete;
+
+        // Ouvre le port de controle sur bindIp et demarre le thread reseau. secret : cle partagee par tous les processus
+        // L'Authorizer doit etre branche avant Start
+        bool Start(const std::string& bindIp, uint16_t port, const std::string& secret);
+
+        // Arrete le thread et ferme les liens (les envois en attente sont abandonnes)
+        void Stop();
+
+        // Ouvre un lien sortant ; la connexion (ou son echec) arrive par le LinkCallback
+        ControlLinkId Connect(const std::string& ip, uint16_t port);
+        void Disconnect(ControlLinkId link);
+
+        // Construit l'Envelope sur le thread appelant et la confie au thread reseau (fiable, dans l'ordre du lien)
+        template<typename BuilderFunc>
+        void Send(ControlLinkId link, Opcode opcode, BuilderFunc payloadBuilder)
+        {
+            m_commands.Push(Command{ CommandType::Send, link, {}, 0, BuildEnvelope(opcode, payloadBuilder) });
+        }
+
+        void RegisterHandler(Opcode opcode, MessageHandler handler);
+        void SetLinkCallback(LinkCallback callback) { m_onLink = std::move(callback); }
+        void SetAuthorizer(Authorizer authorizer) { m_authorizer = std::move(authorizer); }
+
+        // Main thread : livre les connexions, deconnexions et messages recus depuis le dernier appel
+        void ProcessEvents();
+
+    private:
+        enum class CommandType { Connect, Send, Disconnect };
+        struct Command
+        {
+            CommandType type;
+            ControlLinkId link = INVALID_CONTROL_LINK;
+            std::string ip;
+            uint16_t port = 0;
+            std::vector<uint8_t> data;
+        };
+
+        enum class EventType { Connected, Disconnected, Message };
+        struct Event
+        {
+            EventType type;
+            ControlLinkId link = INVALID_CONTROL_LINK;
+            std::vector<uint8_t> data;
+            ControlAddress remote;      // Connected uniquement
+        };
+
+        using Nonce = std::array<uint8_t, NONCE_SIZE>;
+        using Mac = std::array<uint8_t, 32>;
+
+        // Etat d'un lien cote thread reseau
+        struct Link
+        {
+            ENetPeer* peer = nullptr;
+            bool isOutbound = false;
+            bool isAuthenticated = false;
+            Nonce nonce{};                                      // Defi envoye au pair
+            std::chrono::steady_clock::time_point deadline;     // Fin de l'authentification
+        };
+
+        // Boucle du thread reseau : commandes du main thread puis service ENet
+        void NetworkMain();
+        void ExecuteCommand(Command& command);
+        void Dispatch(ControlLinkId link, const std::vector<uint8_t>& data);
+
+        // Thread reseau : echange d'authentification, false si le lien doit etre ferme
+        bool Authenticate(ControlLinkId link, Link& state, const ENetPacket* packet);
+
+        // Ferme un lien refuse ; seul un lien deja annonce au main thread (sortant) y est signale
+        void Reject(ControlLinkId link, const char* reason);
+
+        // Thread reseau : envoi direct d'une Envelope (messages d'authentification)
+        template<typename BuilderFunc>
+        void SendNow(ENetPeer* peer, Opcode opcode, BuilderFunc payloadBuilder)
+        {
+            std::vector<uint8_t> data = BuildEnvelope(opcode, payloadBuilder);
+            ENetPacket* packet = enet_packet_create(data.data(), data.size(), ENET_PACKET_FLAG_RELIABLE);
+            if (enet_peer_send(peer, 0, packet) < 0)
+            {
+                enet_packet_destroy(packet);
+            }
+        }
+
+        template<typename BuilderFunc>
+        static std::vector<uint8_t> BuildEnvelope(Opcode opcode, BuilderFunc payloadBuilder)
+        {
+            flatbuffers::FlatBufferBuilder payloadFbb;
+            payloadBuilder(payloadFbb);
+
+            flatbuffers::FlatBufferBuilder envBuilder;
+            auto payloadVector = envBuilder.CreateVector(payloadFbb.GetBufferPointer(), payloadFbb.GetSize());
+            EnvelopeBuilder env(envBuilder);
+            env.add_opcode(opcode);
+            env.add_payload_data(payloadVector);
+            envBuilder.Finish(env.Finish());
+
+            const uint8_t* bytes = envBuilder.GetBufferPointer();
+            return std::vector<uint8_t>(bytes, bytes + envBuilder.GetSize());
+        }
+
+        // HMAC-SHA256(secret, tag | nonce) : le tag distingue la preuve du demandeur de celle de l'accepteur
+        Mac ComputeMac(uint8_t tag, const uint8_t* nonce, size_t size) const;
+
+        ENetHost* m_host = nullptr;
+        std::thread m_thread;
+        std::atomic<bool> m_isRunning{ false };
+        std::atomic<ControlLinkId> m_nextLinkId{ 1 };
+        std::string m_secret;
+
+        Core::ConcurrentQueue<Command> m_commands;              // Main thread → thread reseau
+        Core::ConcurrentQueue<Event> m_events;                  // Thread reseau → main thread
+        std::unordered_map<ControlLinkId, Link> m_links;        // Thread reseau uniquement
+
+        std::unordered_map<Opcode, MessageHandler> m_handlers;
+        LinkCallback m_onLink;
+        Authorizer m_authorizer;
+    };
+}
@@ -1,9 +1,12 @@
 #pragma once
 #include "enet.h"
+#include <memory>
 #include <span>
+#include <unordered_map>
 #include "core/Config.h"
 #include "network/PacketDispatcher.h"
 #include "network/SessionManager.h"
+#include "network/TrafficLog.h"
 
 
 namespace MMO::Network 
@@ -21,7 +24,21 @@ namespace MMO::Network
         void Shutdown();
 
         // Traite tous les evenements ENet en attente (non-bloquant)
+        // En mode replay : rejoue les evenements enregistres pour le tick courant
         void ProcessEvents();
+
+        // Enregistre connexions, paquets et deconnexions entrants dans un fichier (voir TrafficLog.h)
+        bool StartRecording(const std::string& path, uint16_t tickRate);
+
+        // Remplace le socket par un enregistrement : aucun port ouvert, les evenements sont rejoues tick par tick
+        bool StartReplay(const std::string& path);
+
+        bool IsReplaying() const { return m_replayReader != nullptr; }
+        bool IsReplayFinished() const { return !m_hasReplayEvent; }
+        uint16_t GetReplayTickRate() const { return m_replayReader ? m_replayReader->GetTickRate() : 0; }
+
+        // Numero du tick en cours (horodatage de l'enregistrement, cadence du replay)
+        void SetCurrentTick(uint64_t tick);
         
         // Envoie un paquet a un client specifique
         void SendPacket(ENetPeer* peer, std::span<const uint8_t> data, bool reliable);
@@ -37,8 +54,23 @@ namespace MMO::Network
         void HandleReceive(const ENetEvent& event);
         void HandleDisconnect(const ENetEvent& event);
 
+        // Injecte les evenements enregistres dont le tick est atteint
+        void ProcessReplayEvents();
+
+        // Peer factice (jamais connecte : les envois echouent sans toucher au reseau)
+        ENetPeer* GetReplayPeer(uint32_t peerID);
+
         ENetHost* m_host;                   // Serveur ENet
         PacketDispatcher m_dispatcher;      // Routage des paquets
         SessionManager m_sessionManager;    // Gestion des sessions joueurs
+
+        uint64_t m_currentTick = 0;
+        TrafficRecorder m_recorder;
+
+        // Replay : lecteur, evenement en attente et peers factices (conserves jusqu'a la fin : des callbacks DB peuvent encore les referencer)
+        std::unique_ptr<TrafficReader> m_replayReader;
+        TrafficEvent m_replayEvent;
+        bool m_hasReplayEvent = false;
+        std::unordered_map<uint32_t, std::unique_ptr<ENetPeer>> m_replayPeers;
     };
 }
@@ -31,7 +31,11 @@ namespace MMO::Network
             // Envoi via ENet
             uint32_t flags = reliable ? ENET_PACKET_FLAG_RELIABLE : ENET_PACKET_FLAG_UNSEQUENCED;
             ENetPacket* packet = enet_packet_create(envBuilder.GetBufferPointer(), envBuilder.GetSize(), flags);
-            enet_peer_send(peer, 0, packet);
+            if (enet_peer_send(peer, 0, packet) < 0)
+            {
+                // Peer non connecte (deconnexion en cours, replay) : ENet ne prend pas possession du paquet
+                enet_packet_destroy(packet);
+            }
         }
     };
 }
@@ -0,0 +1,60 @@
+#pragma once
+#include "enet.h"
+#include <functional>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include "Core_generated.h"
+#include "core/Types.h"
+#include "network/PacketDispatcher.h"
+#include "network/SessionManager.h"
+
+namespace MMO::Core { class KingdomWorld; }
+
+namespace MMO::Network
+{
+    // Commande de gameplay d'un joueur, resolue vers son entite dans un royaume resident
+    struct PlayerCommand
+    {
+        ENetPeer* peer = nullptr;                   // nullptr : commande rejouee (migration), aucune reponse au client
+        MMO::Core::KingdomWorld* world = nullptr;
+        entt::entity entity = entt::null;
+        int kingdomId = -1;
+        PlayerID playerID = INVALID_PLAYER;         // Journaux uniquement
+    };
+
+    using PlayerCommandHandler = std::function<void(const PlayerCommand& command, std::span<const uint8_t> payload)>;
+
+    // Route les paquets de gameplay (joueur dans un royaume) vers leur handler
+    // La session et le royaume sont resolus ici : un handler ne recoit que des commandes applicables.
+    // Un royaume qui n'est pas resident (gele par une migration) confie la commande au DeferHandler,
+    // qui peut la rejouer plus tard par Apply, ici ou dans le processus qui recoit le royaume
+    class PlayerCommandRouter
+    {
+    public:
+        using DeferHandler = std::function<void(const PlayerSession& session, Opcode opcode, std::span<const uint8_t> payload)>;
+
+        PlayerCommandRouter(PacketDispatcher& dispatcher, SessionManager& sessionManager,
+            std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>>& kingdoms);
+
+        PlayerCommandRouter(const PlayerCommandRouter&) = delete;
+        PlayerCommandRouter& operator=(const PlayerCommandRouter&) = delete;
+
+        // Enregistre le handler aupres du dispatcher ; name sert aux journaux
+        void RegisterHandler(Opcode opcode, const char* name, PlayerCommandHandler handler);
+
+        // Commandes d'un royaume non resident (sans DeferHandler, elles sont ignorees)
+        void SetDeferHandler(DeferHandler handler) { m_onDefer = std::move(handler); }
+
+        // Rejoue une commande mise de cote. false si aucun handler ne gere l'opcode
+        bool Apply(Opcode opcode, const PlayerCommand& command, std::span<const uint8_t> payload) const;
+
+    private:
+        PacketDispatcher& m_dispatcher;
+        SessionManager& m_sessionManager;
+        std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>>& m_kingdoms;
+
+        std::unordered_map<Opcode, PlayerCommandHandler> m_handlers;
+        DeferHandler m_onDefer;
+    };
+}
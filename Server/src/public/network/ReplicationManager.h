@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <entt/entt.hpp>
+#include "network/SessionManager.h"
+
+namespace MMO::Core { class KingdomWorld; }
+
+namespace MMO::Network
+{
+    // Replication par zone d'interet (AOI) : chaque client ne recoit que les entites des 3x3 cellules autour de lui
+    // A chaque tick, l'ensemble visible est recalcule puis compare au tick precedent :
+    // entrees (etat complet), sorties, et snapshots des seules entites encore visibles qui ont bouge
+    // La bande passante par client depend de la densite locale, pas de la population du royaume
+    class ReplicationManager
+    {
+    public:
+        struct Stats
+        {
+            uint64_t batches = 0;       // Paquets envoyes
+            uint64_t bytes = 0;         // Octets de payload envoyes
+            uint64_t entered = 0;
+            uint64_t left = 0;
+            uint64_t updated = 0;
+            uint64_t combatBatches = 0; // Paquets S2C_CombatEvents
+            uint64_t combatEvents = 0;
+        };
+
+        // Calcule et envoie le lot de replication de chaque joueur et ses bilans de combat,
+        // puis vide les marqueurs de mouvement et les bilans
+        // Main thread uniquement, apres le tick des royaumes
+        void Replicate(const SessionManager& sessionManager,
+            std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>>& kingdoms);
+
+        const Stats& GetStats() const { return m_stats; }
+
+        // Affiche les compteurs (moyenne d'octets par lot)
+        void PrintStats() const;
+
+    private:
+        // Ensemble visible d'un client au dernier tick (trie pour les differences en O(n))
+        struct ClientView
+        {
+            int kingdomId = -1;
+            std::vector<entt::entity> visible;
+            uint64_t lastTick = 0;
+        };
+
+        void ReplicateClient(const PlayerSession& session, MMO::Core::KingdomWorld& world, ClientView& view);
+
+        // Bilans de combat du joueur produits ce tick, en un paquet
+        void SendCombatEvents(const PlayerSession& session, const entt::registry& registry);
+
+        std::unordered_map<uint32_t, ClientView> m_views; // PeerID → vue
+        uint64_t m_tick = 0;
+        Stats m_stats;
+
+        // Buffers reutilises d'un client a l'autre
+        std::vector<entt::entity> m_current;
+        std::vector<entt::entity> m_entered;
+        std::vector<entt::entity> m_left;
+        std::vector<entt::entity> m_updated;
+    };
+}
@@ -54,9 +54,15 @@ namespace MMO::Network
         // Rejoindre un royaume — associe le kingdomId et l'entite a la session
         void OnJoinKingdom(ENetPeer* peer, int kingdomId, EntityID entityID);
 
+        // Quitter le royaume sans se deconnecter (royaume migre ailleurs) : la session peut en selectionner un autre
+        void OnLeaveKingdom(ENetPeer* peer);
+
         // Retourne toutes les sessions dans un royaume donne
         std::vector<const PlayerSession*> GetSessionsByKingdom(int kingdomId) const;
 
+        // Toutes les sessions, par PeerID (parcours sans allocation)
+        const std::unordered_map<uint32_t, PlayerSession>& GetAllSessions() const { return m_sessions; }
+
     private:
         std::unordered_map<uint32_t, PlayerSession> m_sessions;
         std::unordered_map<PlayerID, std::string> m_sessionTokens; // PlayerID -> Token
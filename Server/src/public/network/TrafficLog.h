@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+namespace MMO::Network
+{
+    // Type d'evenement reseau enregistre
+    enum class TrafficEventType : uint8_t
+    {
+        Connect = 0,
+        Receive = 1,
+        Disconnect = 2
+    };
+
+    // Un evenement entrant, horodate par le numero de tick serveur
+    struct TrafficEvent
+    {
+        uint64_t tick = 0;
+        TrafficEventType type = TrafficEventType::Connect;
+        uint32_t peerID = 0;
+        std::vector<uint8_t> payload; // Envelope brute (Receive uniquement)
+    };
+
+    // Format binaire compact :
+    //   En-tete : "MMOT" | version (u16) | tickRate (u16)
+    //   Evenement : type (u8) | delta de tick (varint) | peerID (varint) | [taille (varint) | octets]
+    class TrafficRecorder
+    {
+    public:
+        ~TrafficRecorder() { Close(); }
+
+        // Cree le fichier et ecrit l'en-tete
+        bool Open(const std::string& path, uint16_t tickRate);
+        void Close();
+
+        bool IsOpen() const { return m_file.is_open(); }
+
+        // Numero du tick en cours (appele par le GameLoop avant ProcessNetworkIn)
+        void SetTick(uint64_t tick) { m_currentTick = tick; }
+
+        void RecordConnect(uint32_t peerID);
+        void RecordReceive(uint32_t peerID, const uint8_t* data, size_t size);
+        void RecordDisconnect(uint32_t peerID);
+
+        uint64_t GetEventCount() const { return m_eventCount; }
+
+    private:
+        void WriteEventHeader(TrafficEventType type, uint32_t peerID);
+        void WriteVarint(uint64_t value);
+
+        std::ofstream m_file;
+        std::vector<char> m_buffer; // Tampon d'ecriture (evite un flush par paquet)
+        uint64_t m_currentTick = 0;
+        uint64_t m_lastTick = 0;
+        uint64_t m_eventCount = 0;
+    };
+
+    // Relit un fichier produit par TrafficRecorder, evenement par evenement
+    class TrafficReader
+    {
+    public:
+        bool Open(const std::string& path);
+
+        // Lit l'evenement suivant. Retourne false en fin de fichier (ou si le fichier est tronque)
+        bool Next(TrafficEvent& out);
+
+        uint16_t GetTickRate() const { return m_tickRate; }
+
+    private:
+        bool ReadVarint(uint64_t& value);
+
+        std::ifstream m_file;
+        uint16_t m_tickRate = 0;
+        uint64_t m_lastTick = 0;
+    };
+}
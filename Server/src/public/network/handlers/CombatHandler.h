@@ -0,0 +1,9 @@
+#pragma once
+#include "network/PlayerCommandRouter.h"
+
+namespace MMO::Network
+{
+    // Enregistre le handler des ordres d'attaque (C2S_AttackTarget), resolus par le CombatSystem
+    // Les bilans repartent en lot a la fin du tick (S2C_CombatEvents, via la replication)
+    void RegisterCombatHandler(PlayerCommandRouter& router);
+}
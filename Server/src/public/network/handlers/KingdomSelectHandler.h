@@ -4,18 +4,33 @@
 #include "database/DatabaseManager.h"
 #include "database/repositories/IAccountRepository.h"
 #include "database/repositories/IPlayerRepository.h"
+#include "world/KingdomRegistry.h"
+#include "world/ShardDirectory.h"
 #include <memory>
 #include <functional>
 #include <unordered_map>
+#include <vector>
 
 namespace MMO::Core { class KingdomWorld; }
 
 namespace MMO::Network
 {
+    // Rend un royaume resident (reveil s'il est hiberne) puis appelle onReady sur le main thread
+    // onReady(false) : royaume inconnu
+    using KingdomLoader = std::function<void(int kingdomId, std::function<void(bool)> onReady)>;
+
+    // Envoie le client vers le processus qui heberge le royaume (mode shard, royaume distant ou migre)
+    void SendKingdomRedirect(ENetPeer* peer, int kingdomId, const MMO::Core::ShardEndpoint& endpoint);
+
     // Handler unifie pour la selection de royaume (remplace KingdomHandler + JoinHandler)
     // Sur une meme connexion : RequestKingdoms → KingdomList, SelectKingdom → PlayerData
+    // catalog : tous les royaumes (residents ou hiberne), kingdoms : ceux charges en memoire
+    // shards : propriete des royaumes entre processus (nullptr = ce processus les heberge tous) ;
+    // un royaume heberge ailleurs est liste avec l'adresse de son processus et sa selection renvoie S2C_KingdomRedirect
     void RegisterKingdomSelectHandler(PacketDispatcher& dispatcher, SessionManager& sessionManager,
         std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>>& kingdoms,
+        const std::vector<MMO::Core::KingdomInfo>& catalog, KingdomLoader loadKingdom,
+        const MMO::Core::ShardDirectory* shards,
         std::shared_ptr<Database::IAccountRepository> accountRepo,
         std::shared_ptr<Database::IPlayerRepository> playerRepo,
         std::function<void(std::function<void()>)> runOnMainThread);
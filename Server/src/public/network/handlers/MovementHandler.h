@@ -0,0 +1,8 @@
+#pragma once
+#include "network/PlayerCommandRouter.h"
+
+namespace MMO::Network
+{
+    // Enregistre le handler des demandes de deplacement (C2S_MoveRequest → S2C_MovementSnapshot)
+    void RegisterMovementHandler(PlayerCommandRouter& router);
+}
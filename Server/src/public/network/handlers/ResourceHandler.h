@@ -1,17 +1,15 @@
 #pragma once
-#include "network/PacketDispatcher.h"
-#include "network/SessionManager.h"
+#include "network/PlayerCommandRouter.h"
 #include "database/repositories/IPlayerRepository.h"
+#include "ecs/PlayerComponents.h"
 #include <entt/entt.hpp>
 #include <memory>
-#include <unordered_map>
-
-namespace MMO::Core { class KingdomWorld; }
 
 namespace MMO::Network
 {
+    // Montants et dates de reglement de chaque stock, tels qu'ecrits en DB
+    Database::StoredResources ToStoredResources(const ECS::ResourcesComponent& res);
+
     // Enregistre le handler de modification des ressources
-    void RegisterResourceHandler(PacketDispatcher& dispatcher, SessionManager& sessionManager,
-        std::unordered_map<int, std::unique_ptr<MMO::Core::KingdomWorld>>& kingdoms,
-        std::shared_ptr<Database::IPlayerRepository> playerRepo);
+    void RegisterResourceHandler(PlayerCommandRouter& router, std::shared_ptr<Database::IPlayerRepository> playerRepo);
 }
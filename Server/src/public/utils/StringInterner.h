@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+
+namespace MMO::Utils
+{
+    // Handle stable d'une chaine internee (0 = chaine vide)
+    using StringHandle = uint32_t;
+    constexpr StringHandle EMPTY_STRING_HANDLE = 0;
+
+    // Table de chaines partagee par tout le processus : une chaine n'est stockee qu'une fois
+    // et les composants ne gardent qu'un handle de 32 bits (pas d'allocation par entite)
+    // Les chaines ne sont jamais liberees : reserve aux ensembles bornes (pseudos, noms de royaume...)
+    // Thread-safe : lectures concurrentes, ecriture exclusive uniquement pour une chaine nouvelle
+    class StringInterner
+    {
+    public:
+        StringInterner();
+
+        StringInterner(const StringInterner&) = delete;
+        StringInterner& operator=(const StringInterner&) = delete;
+
+        // Instance globale du serveur
+        static StringInterner& Get();
+
+        // Retourne le handle de la chaine, en l'ajoutant si elle est nouvelle
+        StringHandle Intern(std::string_view text);
+
+        // Handle d'une chaine deja internee, EMPTY_STRING_HANDLE sinon (n'ajoute rien)
+        StringHandle Find(std::string_view text) const;
+
+        // Chaine d'un handle. La vue reste valide pendant toute la vie du processus
+        std::string_view Resolve(StringHandle handle) const;
+
+        size_t GetCount() const { return m_count.load(std::memory_order_relaxed); }
+        size_t GetBytes() const { return m_bytes.load(std::memory_order_relaxed); }
+
+    private:
+        mutable std::shared_mutex m_mutex;
+
+        // deque : push_back ne deplace pas les elements, les vues de m_lookup restent valides
+        std::deque<std::string> m_strings;
+        std::unordered_map<std::string_view, StringHandle> m_lookup;
+
+        std::atomic<size_t> m_count{ 0 };
+        std::atomic<size_t> m_bytes{ 0 };
+    };
+
+    // Raccourcis sur l'instance globale
+    inline StringHandle Intern(std::string_view text) { return StringInterner::Get().Intern(text); }
+    inline std::string_view Resolve(StringHandle handle) { return StringInterner::Get().Resolve(handle); }
+}
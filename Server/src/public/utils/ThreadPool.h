@@ -0,0 +1,160 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+
+namespace MMO::Utils
+{
+    // Pool de threads de taille fixe
+    // Les workers sont crees une seule fois et consomment une file de jobs partagee
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(size_t threadCount)
+        {
+            m_workers.reserve(threadCount);
+            for (size_t i = 0; i < threadCount; ++i)
+            {
+                m_workers.emplace_back(&ThreadPool::WorkerMain, this);
+            }
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::scoped_lock lock(m_mutex);
+                m_isRunning = false;
+            }
+            m_condVar.notify_all();
+
+            for (auto& worker : m_workers)
+            {
+                if (worker.joinable())
+                    worker.join();
+            }
+        }
+
+        // Non copiable
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        // Ajoute un job a executer sur un worker (fire-and-forget)
+        void Enqueue(std::function<void()> job)
+        {
+            {
+                std::scoped_lock lock(m_mutex);
+                m_jobs.push(std::move(job));
+            }
+            m_condVar.notify_one();
+        }
+
+        // Execute func(i) pour i dans [0, count) et bloque jusqu'a la fin de tous les indices (barriere)
+        // Le thread appelant participe au travail : un appel imbrique depuis un worker ne peut pas bloquer le pool
+        // Un indice qui leve compte quand meme comme termine ; la premiere exception est relancee a l'appelant
+        void ParallelFor(size_t count, const std::function<void(size_t)>& func)
+        {
+            if (count == 0)
+                return;
+
+            if (count == 1 || m_workers.empty())
+            {
+                for (size_t i = 0; i < count; ++i)
+                    func(i);
+                return;
+            }
+
+            // Etat partage avec les helpers — un helper qui demarre apres la fin ne trouve plus d'indice
+            struct Batch
+            {
+                std::atomic<size_t> nextIndex{ 0 };
+                std::atomic<size_t> doneCount{ 0 };
+                size_t count = 0;
+                const std::function<void(size_t)>* func = nullptr;
+                std::mutex mutex;
+                std::condition_variable doneCondVar;
+                std::exception_ptr error;           // Premiere exception, protegee par mutex
+            };
+
+            auto batch = std::make_shared<Batch>();
+            batch->count = count;
+            batch->func = &func;
+
+            auto runIndices = [](Batch& b)
+            {
+                size_t index;
+                while ((index = b.nextIndex.fetch_add(1)) < b.count)
+                {
+                    try
+                    {
+                        (*b.func)(index);
+                    }
+                    catch (...)
+                    {
+                        std::scoped_lock lock(b.mutex);
+                        if (!b.error)
+                            b.error = std::current_exception();
+                    }
+
+                    if (b.doneCount.fetch_add(1) + 1 == b.count)
+                    {
+                        std::scoped_lock lock(b.mutex);
+                        b.doneCondVar.notify_all();
+                    }
+                }
+            };
+
+            size_t helperCount = std::min(count - 1, m_workers.size());
+            for (size_t i = 0; i < helperCount; ++i)
+            {
+                Enqueue([batch, runIndices]() { runIndices(*batch); });
+            }
+
+            runIndices(*batch);
+
+            std::unique_lock lock(batch->mutex);
+            batch->doneCondVar.wait(lock, [&batch]() { return batch->doneCount.load() == batch->count; });
+
+            if (batch->error)
+                std::rethrow_exception(batch->error);
+        }
+
+        size_t GetThreadCount() const { return m_workers.size(); }
+
+    private:
+        // Boucle d'un worker : attend et execute les jobs
+        void WorkerMain()
+        {
+            while (true)
+            {
+                std::function<void()> job;
+                {
+                    std::unique_lock lock(m_mutex);
+                    m_condVar.wait(lock, [this]() { return !m_isRunning || !m_jobs.empty(); });
+
+                    if (!m_isRunning && m_jobs.empty())
+                        return;
+
+                    job = std::move(m_jobs.front());
+                    m_jobs.pop();
+                }
+
+                if (job)
+                    job();
+            }
+        }
+
+        std::vector<std::thread> m_workers;
+        std::queue<std::function<void()>> m_jobs;
+        std::mutex m_mutex;
+        std::condition_variable m_condVar;
+        bool m_isRunning = true;
+    };
+}
@@ -1,9 +1,17 @@
 ﻿#pragma once
 #include <chrono>
+#include <cstdint>
 
 
 namespace MMO::Time 
 {
+    // Horloge murale en millisecondes Unix (survit aux redemarrages, contrairement a steady_clock)
+    inline int64_t UnixMilliseconds()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
     // Chronometre haute precision pour mesurer les durees
     class Stopwatch 
     {
@@ -1,6 +1,7 @@
 #pragma once
 #include <string>
 #include <entt/entt.hpp>
+#include "world/SystemAccess.h"
 
 namespace MMO::Core
 {
@@ -11,10 +12,21 @@ namespace MMO::Core
     public:
         virtual ~IGameSystem() = default;
 
-        // Appele chaque tick par le KingdomWorld parent
+        // Appele une fois a l'enregistrement dans le royaume (creation des groupes, signaux...)
+        virtual void OnAttach(entt::registry& /*registry*/) {}
+
+        // Appele par le KingdomWorld parent a la frequence du systeme (voir GetUpdateRate)
         virtual void OnTick(float dt, entt::registry& registry) = 0;
 
         // Nom du systeme (pour logs et debug)
         virtual std::string GetName() const = 0;
+
+        // Frequence de mise a jour en Hz (0 = a chaque tick serveur)
+        // Un systeme basse frequence recoit le dt cumule depuis son dernier passage
+        virtual float GetUpdateRate() const { return 0.0f; }
+
+        // Declare les composants et ressources lus/ecrits pour l'execution en parallele
+        // Par defaut un systeme est exclusif : il tourne seul, dans l'ordre d'enregistrement
+        virtual void DeclareAccess(SystemAccess& access) const { access.Exclusive(); }
     };
 }
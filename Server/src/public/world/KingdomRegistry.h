@@ -13,6 +13,9 @@ namespace MMO::Core
         std::string ip;
         uint16_t port = 0;
         int maxPlayers = 1000;
+        float mapWidth = 0.0f;  // Carte bornee (grille spatiale dense), 0 = monde non borne
+        float mapHeight = 0.0f;
+        std::string mapPath;    // Carte statique (WorldMap), vide = monde sans terrain
         int playerCount = 0;    // Dynamique, mis a jour par les kingdoms
         uint8_t status = 0;     // 0=offline, 1=online, 2=full, 3=maintenance
     };
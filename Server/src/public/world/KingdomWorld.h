@@ -1,38 +1,162 @@
 #pragma once
+#include <span>
 #include <string>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 #include <entt/entt.hpp>
 #include "world/IGameSystem.h"
 #include "world/SpatialGrid.h"
+#include "world/TimingWheel.h"
+#include "world/WorldMap.h"
+#include "world/PathfindingService.h"
+#include "core/TickProfiler.h"
+#include "utils/ThreadPool.h"
 
 
 namespace MMO::Core
 {
+    struct WorldSnapshotInfo;
+
     // Un royaume = un monde autonome avec sa propre registry ECS et ses systemes de jeu
     class KingdomWorld
     {
     public:
-        KingdomWorld(int id, const std::string& name);
+        // mapWidth/mapHeight > 0 : carte bornee, grille spatiale dense ; sinon grille sparse non bornee
+        KingdomWorld(int id, const std::string& name, float mapWidth = 0.0f, float mapHeight = 0.0f);
+        ~KingdomWorld();
+
+        KingdomWorld(const KingdomWorld&) = delete;
+        KingdomWorld& operator=(const KingdomWorld&) = delete;
 
-        // Tick tous les systemes enregistres
+        // Livre les chemins calcules, declenche les timers expires puis tick tous les systemes enregistres
+        // (par lots sans conflit, en parallele si un pool est branche)
+        // puis applique a la grille spatiale les changements de position du tick
         void OnTick(float dt);
 
         // Enregistre un systeme de gameplay (movement, combat, production...)
+        // Les systemes basse frequence sont decales selon le royaume pour lisser la charge entre les ticks
         void AddSystem(std::unique_ptr<IGameSystem> system);
 
+        // Branche le profiler du tick (histogrammes du royaume et de chaque systeme)
+        void SetProfiler(TickProfiler* profiler);
+
+        // Carte statique (terrain, passabilite, objets), partagee entre royaumes
+        void SetMap(std::shared_ptr<const WorldMap> map) { m_map = std::move(map); }
+
+        // Branche le service de pathfinding (nullptr = deplacements en ligne droite)
+        void SetPathfinding(PathfindingService* pathfinding) { m_pathfinding = pathfinding; }
+
+        // Lance le calcul d'un chemin vers (goalX, goalY) sur les workers de pathfinding
+        // Le chemin est suivi des sa livraison au debut d'un tick. Retourne false sans carte ou sans service
+        bool RequestPath(entt::entity entity, float goalX, float goalY, float speed);
+
+        // Sauvegarde binaire de la registry (la grille se reconstruit au chargement). Hors tick uniquement
+        // isClean : aucune ecriture DB ne peut suivre (arret, hibernation) ; ignore si des joueurs restaures non fiables restent
+        std::vector<uint8_t> CaptureSnapshot(bool isClean) const;
+
+        // Charge un snapshot dans le royaume encore vide : registry, grille spatiale et index des joueurs restaures
+        bool LoadSnapshot(const std::string& path);
+
+        // Meme chargement depuis un snapshot recu en memoire (migration entre processus)
+        bool LoadSnapshot(std::span<const uint8_t> buffer, const std::string& source);
+
+        // Entite restauree d'un compte, reprise par sa nouvelle session (retiree de l'index). entt::null si aucune
+        entt::entity ClaimRestoredPlayer(int accountId);
+
+        // Snapshot ecrit a l'arret : l'etat restaure est au moins aussi recent que la DB
+        bool IsRestoredStateClean() const { return m_restoredClean; }
+
+        // Joueur deconnecte pendant une bataille : son entite reste dans le monde (et dans ses combats)
+        // jusqu'a ce que son armee ne soit plus engagee, ou jusqu'a sa reconnexion
+        void KeepOfflinePlayer(int accountId, entt::entity entity) { m_offlinePlayers[accountId] = entity; }
+
+        // Entite gardee hors ligne d'un compte, reprise par sa nouvelle session (retiree de l'index). entt::null si aucune
+        entt::entity ClaimOfflinePlayer(int accountId);
+
+        // Retire de l'index les joueurs hors ligne dont l'armee n'est plus engagee
+        // L'appelant sauvegarde puis detruit les entites ajoutees a released
+        void ReleaseOfflinePlayers(std::vector<entt::entity>& released);
+
+        bool HasOfflinePlayers() const { return !m_offlinePlayers.empty(); }
+
+        // Troupes engagees ou ordre d'attaque en attente. Les batailles ne sont pas dans le snapshot :
+        // une migration attend qu'il n'y en ait plus pour geler le royaume
+        bool HasActiveBattles() const;
+
+        // Branche le pool de jobs pour les systemes sans conflit (nullptr = sequentiel)
+        void SetJobPool(MMO::Utils::ThreadPool* jobPool) { m_jobPool = jobPool; }
+
         // Accesseurs
         int GetId() const { return m_id; }
         const std::string& GetName() const { return m_name; }
         entt::registry& GetRegistry() { return m_registry; }
         const entt::registry& GetRegistry() const { return m_registry; }
         SpatialGrid& GetSpatialGrid() { return m_spatialGrid; }
+        TimingWheel& GetTimers() { return m_timers; }
+        const WorldMap* GetMap() const { return m_map.get(); } // nullptr = pas de carte
 
     private:
+        struct SystemEntry
+        {
+            std::unique_ptr<IGameSystem> system;
+            SystemAccess access;
+            TimingHistogram* histogram = nullptr; // nullptr = pas de profiling
+
+            float interval = 0.0f;      // Periode en secondes (0 = chaque tick)
+            float countdown = 0.0f;     // Temps restant avant le prochain passage
+            float accumulated = 0.0f;   // dt cumule depuis le dernier passage
+            bool isDue = false;         // A executer pendant le tick courant
+        };
+
+        // Avance les compteurs de chaque systeme et marque ceux a executer ce tick
+        void UpdateDueSystems(float dt);
+
+        // Recalcule les lots d'execution a partir des conflits d'acces
+        void RebuildSchedule();
+
+        // Execute un systeme avec le dt cumule depuis son dernier passage
+        void RunSystem(SystemEntry& entry);
+
+        // Applique les chemins livres par les workers (ignore ceux d'une requete remplacee)
+        void ApplyPathResults();
+
+        // Apres un snapshot charge : grille spatiale et index des joueurs restaures
+        void OnSnapshotLoaded(const WorldSnapshotInfo& info, const std::string& source);
+
+        static constexpr float GRID_CELL_SIZE = 100.0f; // Taille d'une cellule AOI (zone 3x3 visible)
+
         int m_id;
         std::string m_name;
         entt::registry m_registry;
-        SpatialGrid m_spatialGrid;
-        std::vector<std::unique_ptr<IGameSystem>> m_systems;
+        SpatialGrid m_spatialGrid; // Suit PositionComponent via les signaux de m_registry
+        TimingWheel m_timers; // Evenements planifies du royaume (constructions, entrainements...)
+        std::shared_ptr<const WorldMap> m_map;
+
+        PathfindingService* m_pathfinding = nullptr;
+        std::shared_ptr<PathInbox> m_pathInbox = std::make_shared<PathInbox>(); // Partagee avec les jobs en vol
+        uint32_t m_nextPathRequestId = 1;
+
+        // Joueurs charges depuis un snapshot, pas encore repris par une session (accountID -> entite)
+        std::unordered_map<int, entt::entity> m_restoredPlayers;
+        bool m_restoredClean = false;
+
+        // Joueurs deconnectes en pleine bataille (accountID -> entite)
+        std::unordered_map<int, entt::entity> m_offlinePlayers;
+
+        std::vector<SystemEntry> m_systems;
+
+        // Lots d'indices dans m_systems — les systemes d'un meme lot ne sont jamais en conflit
+        // Deux systemes en conflit restent dans l'ordre d'enregistrement : le resultat est deterministe
+        std::vector<std::vector<size_t>> m_batches;
+        std::vector<size_t> m_dueScratch; // Systemes dus du lot courant (reutilise a chaque tick)
+
+        MMO::Utils::ThreadPool* m_jobPool = nullptr;
+
+        // Histogrammes resolus une seule fois
+        TickProfiler* m_profiler = nullptr;
+        TimingHistogram* m_tickHistogram = nullptr;
+        TimingHistogram* m_timersHistogram = nullptr;
+        TimingHistogram* m_gridHistogram = nullptr;
     };
 }
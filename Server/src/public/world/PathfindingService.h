@@ -0,0 +1,136 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <entt/entt.hpp>
+#include "database/ConcurrentQueue.h"
+#include "ecs/MovementComponents.h"
+#include "utils/ThreadPool.h"
+#include "world/WorldMap.h"
+
+
+namespace MMO::Core
+{
+    // Chemin calcule, livre au royaume demandeur
+    struct PathResult
+    {
+        entt::entity entity = entt::null;
+        uint32_t requestId = 0;
+        bool found = false;
+        std::vector<ECS::PathWaypoint> waypoints; // Sans la position de depart, derniere etape = destination exacte
+    };
+
+    // Boite de reception d'un royaume : remplie par les workers, videe au debut du tick du royaume
+    using PathInbox = ConcurrentQueue<PathResult>;
+
+    // Calcul de chemins sur la grille de tuiles d'une WorldMap, sur des threads dedies (jamais le thread du tick)
+    // A* 8 directions (pas de coupe de coin). Une destination demandee souvent recoit un flow field
+    // (direction vers la destination pour chaque tuile) partage par toutes les marches qui s'y rendent
+    // Seule la derniere requete d'une entite est calculee, et la file de chaque royaume (boite de reception) est bornee
+    class PathfindingService
+    {
+    public:
+        // threadCount 0 : calcul synchrone dans Submit (replay reproductible), resultat livre au tick suivant
+        explicit PathfindingService(size_t threadCount);
+
+        PathfindingService(const PathfindingService&) = delete;
+        PathfindingService& operator=(const PathfindingService&) = delete;
+
+        // Planifie un calcul ; le resultat arrive dans inbox (jamais calcule sur le thread appelant)
+        // File du royaume pleine : echec immediat (chemin vide, l'entite s'arrete)
+        void Submit(std::shared_ptr<const WorldMap> map, std::shared_ptr<PathInbox> inbox,
+                    entt::entity entity, uint32_t requestId,
+                    float startX, float startY, float goalX, float goalY);
+
+        // Compteurs (requetes, A*, flow fields, echecs, temps de calcul)
+        void PrintStats() const;
+
+    private:
+        static constexpr uint8_t NO_DIRECTION = 0xFF;
+        static constexpr uint32_t FLOW_FIELD_THRESHOLD = 4;     // Requetes vers une tuile avant de lui construire un flow field
+        static constexpr size_t MAX_FLOW_FIELDS = 16;           // Flow fields gardes en memoire (1 octet par tuile chacun)
+        static constexpr size_t MAX_TRACKED_GOALS = 4096;       // Compteurs de popularite remis a zero au-dela
+        static constexpr uint32_t MAX_EXPANSIONS = 500000;      // Borne d'un A* (tuiles developpees)
+        static constexpr uint32_t MAX_PENDING_PER_INBOX = 1024; // Calculs en file par royaume
+
+        // Calculs en file d'un royaume
+        struct InboxQueue
+        {
+            uint32_t pending = 0;
+            std::unordered_map<entt::entity, uint32_t> latest;  // Derniere requete de chaque entite
+        };
+
+        struct FlowField
+        {
+            std::shared_ptr<const WorldMap> map;                // Garde la carte projetee tant que le champ existe
+            uint32_t goal = 0;
+            std::vector<uint8_t> directions;                    // Direction vers la tuile suivante, NO_DIRECTION si inatteignable
+        };
+
+        struct CachedFlowField
+        {
+            std::shared_ptr<const FlowField> field;
+            uint64_t lastUse = 0;                               // Eviction LRU
+        };
+
+        // Carte + tuile destination
+        struct GoalKey
+        {
+            const WorldMap* map;
+            uint32_t goal;
+
+            bool operator==(const GoalKey&) const = default;
+        };
+
+        struct GoalKeyHash
+        {
+            size_t operator()(const GoalKey& key) const
+            {
+                return std::hash<const void*>{}(key.map) ^ (static_cast<size_t>(key.goal) * 0x9E3779B97F4A7C15ull);
+            }
+        };
+
+        void Run(const std::shared_ptr<const WorldMap>& map, PathInbox& inbox, entt::entity entity, uint32_t requestId,
+                 float startX, float startY, float goalX, float goalY);
+
+        // false : une requete plus recente de la meme entite remplace celle-ci (resultat ignore par le royaume)
+        bool IsLatest(const PathInbox* inbox, entt::entity entity, uint32_t requestId) const;
+        void FinishJob(const PathInbox* inbox, entt::entity entity, uint32_t requestId);
+
+        // Flow field en cache pour cette destination ; le construit si elle est devenue populaire (nullptr sinon)
+        std::shared_ptr<const FlowField> AcquireFlowField(const std::shared_ptr<const WorldMap>& map, uint32_t goal);
+
+        static bool FindPath(const WorldMap& map, uint32_t start, uint32_t goal, std::vector<uint32_t>& tiles);
+        static std::shared_ptr<FlowField> BuildFlowField(const std::shared_ptr<const WorldMap>& map, uint32_t goal);
+        static bool FollowFlowField(const FlowField& field, uint32_t start, std::vector<uint32_t>& tiles);
+
+        // Tuiles → etapes : un point a chaque changement de direction, puis la destination exacte
+        static void ToWaypoints(const WorldMap& map, const std::vector<uint32_t>& tiles,
+                                float goalX, float goalY, std::vector<ECS::PathWaypoint>& out);
+
+        mutable std::mutex m_cacheMutex;
+        std::unordered_map<GoalKey, uint32_t, GoalKeyHash> m_goalRequests;
+        std::unordered_map<GoalKey, CachedFlowField, GoalKeyHash> m_flowFields;
+        std::unordered_set<GoalKey, GoalKeyHash> m_building;   // Construction en cours sur un worker
+        uint64_t m_useCounter = 0;
+
+        mutable std::mutex m_queueMutex;
+        std::unordered_map<const PathInbox*, InboxQueue> m_queues;
+
+        std::atomic<uint64_t> m_requestCount{ 0 };
+        std::atomic<uint64_t> m_aStarCount{ 0 };
+        std::atomic<uint64_t> m_flowFieldHits{ 0 };
+        std::atomic<uint64_t> m_flowFieldsBuilt{ 0 };
+        std::atomic<uint64_t> m_failureCount{ 0 };
+        std::atomic<uint64_t> m_staleCount{ 0 };
+        std::atomic<uint64_t> m_rejectedCount{ 0 };
+        std::atomic<uint64_t> m_searchMicroseconds{ 0 };
+
+        // Declare en dernier : detruit (et joint) avant l'etat partage que les jobs utilisent
+        MMO::Utils::ThreadPool m_pool;
+    };
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+
+namespace MMO::Core
+{
+    // Adresse publique d'un processus serveur (celle que le client doit joindre)
+    struct ShardEndpoint
+    {
+        std::string ip;
+        uint16_t port = 0;
+
+        bool operator==(const ShardEndpoint&) const = default;
+    };
+
+    // Royaume distant revendique par un processus vivant
+    struct ShardKingdomOwner
+    {
+        ShardEndpoint endpoint;
+        int playerCount = 0;
+        int64_t heartbeatMs = 0;    // Horloge murale (ms Unix) du dernier bail lu
+    };
+
+    // Propriete des royaumes entre processus (mode shard)
+    // Chaque processus publie un bail shard_<ip>_<port>.json (adresse, canal de controle, royaumes heberges, joueurs, horodatage)
+    // dans un dossier partage et relit ceux des autres. Un bail non renouvele depuis LEASE_TIMEOUT_MS est ignore :
+    // ses royaumes apparaissent hors ligne. Une migration enregistre le nouveau proprietaire (owner_<id>.json),
+    // qui prime au demarrage sur l'ip/port de kingdoms.json
+    class ShardDirectory
+    {
+    public:
+        static constexpr int64_t LEASE_TIMEOUT_MS = 5000;
+
+        // control : adresse du canal de controle annoncee aux autres processus (port 0 = pas de canal)
+        ShardDirectory(std::string directory, ShardEndpoint self, ShardEndpoint control);
+
+        ShardDirectory(const ShardDirectory&) = delete;
+        ShardDirectory& operator=(const ShardDirectory&) = delete;
+
+        const ShardEndpoint& GetSelf() const { return m_self; }
+
+        // Royaumes heberges par ce processus, residents ou hiberne
+        void SetLocalKingdoms(const std::vector<int>& kingdomIds);
+        bool IsLocal(int kingdomId) const;
+
+        // Migration : le royaume arrive ici, ou part vers newOwner (connu avant que son bail ne le revendique)
+        void AddLocalKingdom(int kingdomId);
+        void RemoveLocalKingdom(int kingdomId, const ShardEndpoint& newOwner);
+
+        // Ecrit notre bail puis relit ceux des autres. E/S disque : jamais sur le thread du tick
+        void Heartbeat(const std::unordered_map<int, int>& playerCounts);
+
+        // Supprime notre bail (arret propre) : les autres processus voient nos royaumes hors ligne sans attendre
+        void Withdraw();
+
+        // Relit les baux des autres sans publier le notre (demarrage, avant ResolveOwner)
+        void Refresh();
+
+        // Proprietaire durable d'un royaume apres migration. E/S disque : jamais sur le thread du tick
+        bool RecordOwner(int kingdomId, const ShardEndpoint& owner);
+        std::optional<ShardEndpoint> ReadRecordedOwner(int kingdomId) const;
+
+        // Demarrage : processus qui heberge le royaume. Bail frais d'un autre processus, sinon proprietaire
+        // enregistre par la derniere migration, sinon configured (kingdoms.json)
+        ShardEndpoint ResolveOwner(int kingdomId, const ShardEndpoint& configured) const;
+
+        // Proprietaire vivant d'un royaume distant (nullopt : aucun bail frais ne le revendique)
+        std::optional<ShardKingdomOwner> FindOwner(int kingdomId) const;
+
+        // Canal de controle d'un processus vivant (migration), nullopt sans bail frais
+        std::optional<ShardEndpoint> FindControlAddress(const ShardEndpoint& endpoint) const;
+
+        // Processus vivant dont le canal de controle est a cette adresse (un lien sortant part de son port de controle)
+        // Thread-safe : appele par le thread reseau du canal de controle pour filtrer les liens entrants
+        std::optional<ShardEndpoint> FindShardByControlAddress(const ShardEndpoint& control) const;
+
+    private:
+        std::string GetLeasePath(const ShardEndpoint& endpoint) const;
+        std::string GetOwnerPath(int kingdomId) const;
+
+        // Ecriture dans un fichier temporaire puis renommage : un autre processus ne lit jamais un fichier a moitie ecrit
+        static bool WriteFileAtomically(const std::string& path, const std::string& content);
+
+        void WriteLease(const std::unordered_map<int, int>& playerCounts);
+        void ReadLeases();
+
+        // Canal de controle d'un processus vivant
+        struct ShardControl
+        {
+            ShardEndpoint endpoint;
+            ShardEndpoint control;
+            int64_t heartbeatMs = 0;
+        };
+
+        std::string m_directory;
+        ShardEndpoint m_self;
+        ShardEndpoint m_control;
+
+        mutable std::mutex m_mutex;
+        std::unordered_set<int> m_localKingdoms;
+        std::unordered_map<int, ShardKingdomOwner> m_owners;   // Derniere relecture (baux des autres processus)
+        std::unordered_set<int> m_conflicts;                    // Royaumes revendiques deux fois (signales une fois)
+        std::unordered_map<int, ShardKingdomOwner> m_handoffs;  // Royaumes cedes, en attente du bail du nouveau proprietaire
+        std::vector<ShardControl> m_controls;                   // Processus vivants et leur canal de controle
+    };
+}
@@ -1,20 +1,39 @@
 #pragma once
 #include <vector>
 #include <unordered_map>
-#include <unordered_set>
 #include <entt/entt.hpp>
 #include <cstdint>
 
 
 namespace MMO::Core
 {
-    // Grille spatiale pour les requetes d'Area of Interest (AOI)
-    // Insert/Remove/Move en O(1), Query en O(k) ou k = entites dans les cellules voisines
+    // Resume d'une zone de la carte pour une vue dezoomee
+    struct LodAggregate
+    {
+        float minX = 0.0f;                          // Bornes de la zone couverte
+        float minY = 0.0f;
+        float maxX = 0.0f;
+        float maxY = 0.0f;
+        uint32_t count = 0;                         // Entites dans la zone
+        entt::entity representative = entt::null;   // Une entite de la zone (affichage, focus)
+        float x = 0.0f;                             // Position de la representative
+        float y = 0.0f;
+    };
+
+    // Grille spatiale pour les requetes d'Area of Interest (AOI) et de portee
+    // Insert/Remove/Move en O(1), Query en O(k) ou k = entites dans les cellules couvertes
+    // Les cellules gardent les positions : filtre a la distance exacte sans passer par la registry
     class SpatialGrid
     {
     public:
+        static constexpr int LOD_LEVEL_COUNT = 6; // Niveau 6 = cellules 64x plus larges que la grille
+
+        // Grille sparse, non bornee (tables de hachage)
         explicit SpatialGrid(float cellSize = 100.0f);
 
+        // Grille dense couvrant [0, worldWidth] x [0, worldHeight], sans hachage ; hors carte ramene au bord
+        SpatialGrid(float cellSize, float worldWidth, float worldHeight);
+
         // Insere une entite a la position donnee
         void Insert(entt::entity entity, float x, float y);
 
@@ -27,10 +46,88 @@ namespace MMO::Core
         // Retourne toutes les entites dans les cellules voisines (3x3 autour)
         void QueryNeighbors(float x, float y, std::vector<entt::entity>& out) const;
 
-        // Vide la grille completement
+        // Retourne les entites a distance <= radius de (x, y), sur autant de cellules que necessaire
+        void QueryRadius(float x, float y, float radius, std::vector<entt::entity>& out) const;
+
+        // Retourne les entites dans le rectangle [minX, maxX] x [minY, maxY] (bornes incluses)
+        void QueryRect(float minX, float minY, float maxX, float maxY, std::vector<entt::entity>& out) const;
+
+        // Vue de la carte, cout borne par maxNodes (pyramide de LOD mise a jour aux changements de cellule)
+        // Si le rectangle couvre au plus maxNodes cellules, entites exactes dans entities ;
+        // sinon un agregat par noeud non vide du premier niveau qui tient dans maxNodes (le plus grossier au pire)
+        // Retourne le niveau utilise (0 = entites exactes)
+        int QueryLod(float minX, float minY, float maxX, float maxY, uint32_t maxNodes,
+                     std::vector<entt::entity>& entities, std::vector<LodAggregate>& aggregates) const;
+
+        // Vide la grille completement (changements en attente compris)
         void Clear();
 
+        // Abonne / desabonne la grille aux signaux de PositionComponent de la registry
+        // Les systemes qui ecrivent Position doivent declarer WriteResource<SpatialGrid>()
+        void Connect(entt::registry& registry);
+        void Disconnect(entt::registry& registry);
+
+        // Applique les changements de position accumules depuis le dernier appel, tries par cellule (une fois par tick)
+        void ApplyBatch(const entt::registry& registry);
+
+        size_t GetPendingCount() const { return m_pendingUpdates.size() + m_pendingRemovals.size(); }
+
+        bool IsDense() const { return m_isDense; }
+
     private:
+        // Entites d'une cellule en SoA : les filtres chargent 4 x et 4 y contigus a la fois
+        struct Cell
+        {
+            std::vector<entt::entity> entities;
+            std::vector<float> xs;
+            std::vector<float> ys;
+
+            uint32_t Push(entt::entity entity, float x, float y);
+
+            // Retrait par swap ; retourne l'entite deplacee a index (entt::null si c'etait la derniere)
+            entt::entity SwapRemove(uint32_t index);
+
+            void Clear();
+        };
+
+        // Signaux EnTT de PositionComponent
+        void OnPositionChanged(entt::registry& registry, entt::entity entity);
+        void OnPositionDestroyed(entt::registry& registry, entt::entity entity);
+
+        // Cellule cible d'une position (clef de hachage ou indice dense), pour le tri du lot
+        uint64_t SortKey(float x, float y) const;
+
+        // Filtre exact d'une cellule (noyau SIMD quand disponible)
+        static void FilterRadius(const Cell& cell, float x, float y, float radiusSq, std::vector<entt::entity>& out);
+        static void FilterRect(const Cell& cell, float minX, float minY, float maxX, float maxY, std::vector<entt::entity>& out);
+
+        // Parcourt les cellules couvrant le rectangle (cellules bornees en mode dense)
+        template <typename Visitor>
+        void ForEachCellInRect(float minX, float minY, float maxX, float maxY, Visitor&& visitor) const;
+
+        // --- Niveaux de detail ---
+        struct LodNode
+        {
+            uint32_t count = 0;
+            entt::entity representative = entt::null;
+        };
+
+        // Une entite entre / sort de la cellule (cx, cy) : met a jour chaque niveau
+        // remaining = la cellule apres le retrait, premiere candidate pour remplacer la representative
+        void LodAdd(entt::entity entity, int cx, int cy, int levels);
+        void LodRemove(entt::entity entity, int cx, int cy, const Cell* remaining, int levels);
+
+        // Nombre de niveaux ou les ancetres de deux cellules different
+        static int LodLevelsBetween(int oldCx, int oldCy, int newCx, int newCy);
+
+        const Cell* FindCell(int cx, int cy) const;
+
+        // Position stockee d'une entite presente dans la grille
+        bool FindStoredPosition(entt::entity entity, float& x, float& y) const;
+
+        // Coordonnee monde → indice de cellule, borne (pas de debordement d'int), commun a l'insertion et aux requetes
+        int ToCellClamped(float v) const;
+
         // Hash 2D → clef unique pour une cellule
         int64_t CellKey(int cx, int cy) const;
 
@@ -38,13 +135,64 @@ namespace MMO::Core
         int ToCellX(float x) const;
         int ToCellY(float y) const;
 
+        // --- Stockage sparse ---
+        struct SparseSlot
+        {
+            int64_t key = 0;
+            uint32_t index = 0;
+        };
+
+        // lodLevels : niveaux de detail a mettre a jour (moins que tous quand l'ancienne et la nouvelle cellule
+        // partagent leurs ancetres)
+        void SparseAdd(entt::entity entity, int64_t key, float x, float y, int lodLevels = LOD_LEVEL_COUNT);
+        void SparseRemoveFromCell(const SparseSlot& slot, int lodLevels = LOD_LEVEL_COUNT);
+
+        // --- Stockage dense ---
+        static constexpr uint32_t INVALID_CELL = UINT32_MAX;
+
+        // Emplacement d'une entite : cellule et rang dans les vecteurs de la cellule
+        struct DenseSlot
+        {
+            uint32_t cell = INVALID_CELL;
+            uint32_t index = 0;
+        };
+
+        uint32_t DenseCellIndex(float x, float y) const;
+        void DenseAdd(entt::entity entity, uint32_t cell, float x, float y, int lodLevels = LOD_LEVEL_COUNT);
+        void DenseRemoveFromCell(const DenseSlot& slot, int lodLevels = LOD_LEVEL_COUNT);
+        DenseSlot* FindDenseSlot(entt::entity entity);
+
         float m_cellSize;
         float m_inverseCellSize; // Pre-calcule pour eviter la division a chaque frame
+        bool m_isDense = false;
+
+        // Cellule → entites et positions
+        std::unordered_map<int64_t, Cell> m_cells;
+
+        // Entite → sa cellule actuelle et son rang (pour suppression O(1))
+        std::unordered_map<entt::entity, SparseSlot> m_entityToCell;
+
+        // Cellules denses (ligne par ligne) et emplacements indexes par entt::to_entity
+        int m_cellsX = 0;
+        int m_cellsY = 0;
+        std::vector<Cell> m_denseCells;
+        std::vector<DenseSlot> m_denseSlots;
+
+        // Niveaux 1..LOD_LEVEL_COUNT (index 0 = niveau 1), cle = CellKey(cx >> niveau, cy >> niveau)
+        std::vector<std::unordered_map<int64_t, LodNode>> m_lodLevels;
 
-        // Cellule → ensemble d'entites
-        std::unordered_map<int64_t, std::unordered_set<entt::entity>> m_cells;
+        // Changement de position en attente, trie par cellule avant application
+        struct PendingMove
+        {
+            uint64_t cell;
+            entt::entity entity;
+            float x;
+            float y;
+        };
 
-        // Entite → sa cellule actuelle (pour suppression O(1))
-        std::unordered_map<entt::entity, int64_t> m_entityToCell;
+        // Changements en attente (une entite peut apparaitre plusieurs fois, dedoublonnee a l'application)
+        std::vector<entt::entity> m_pendingUpdates;
+        std::vector<entt::entity> m_pendingRemovals;
+        std::vector<PendingMove> m_batchScratch; // Reutilise a chaque ApplyBatch
     };
 }
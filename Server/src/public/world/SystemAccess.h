@@ -0,0 +1,104 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+#include <entt/entt.hpp>
+
+
+namespace MMO::Core
+{
+    // Declaration des acces d'un systeme aux composants ECS et aux ressources partagees
+    // Deux systemes sans conflit (aucune ecriture sur ce que l'autre lit ou ecrit) peuvent tourner en parallele
+    class SystemAccess
+    {
+    public:
+        // Composant lu par le systeme
+        template<typename Component>
+        SystemAccess& Read()
+        {
+            Add(m_reads, entt::type_hash<Component>::value());
+            AddStorage<Component>();
+            return *this;
+        }
+
+        // Composant modifie par le systeme (valeurs, ajout ou retrait sur une entite existante)
+        template<typename Component>
+        SystemAccess& Write()
+        {
+            Add(m_writes, entt::type_hash<Component>::value());
+            AddStorage<Component>();
+            return *this;
+        }
+
+        // Ressource hors registry lue par le systeme (SpatialGrid, carte...)
+        template<typename Resource>
+        SystemAccess& ReadResource()
+        {
+            Add(m_reads, entt::type_hash<Resource>::value());
+            return *this;
+        }
+
+        // Ressource hors registry modifiee par le systeme
+        template<typename Resource>
+        SystemAccess& WriteResource()
+        {
+            Add(m_writes, entt::type_hash<Resource>::value());
+            return *this;
+        }
+
+        // Acces exclusif : creation/destruction d'entites ou acces non declares
+        // Un systeme exclusif ne tourne jamais en meme temps qu'un autre
+        SystemAccess& Exclusive()
+        {
+            m_isExclusive = true;
+            return *this;
+        }
+
+        bool IsExclusive() const { return m_isExclusive; }
+
+        // Vrai si les deux systemes ne peuvent pas s'executer en meme temps
+        bool ConflictsWith(const SystemAccess& other) const
+        {
+            if (m_isExclusive || other.m_isExclusive)
+                return true;
+
+            return Intersects(m_writes, other.m_writes)
+                || Intersects(m_writes, other.m_reads)
+                || Intersects(m_reads, other.m_writes);
+        }
+
+        // Cree a l'avance les storages declares : la registry ne doit pas etre modifiee pendant le tick parallele
+        void PrepareStorages(entt::registry& registry) const
+        {
+            for (auto prepare : m_storagePreparers)
+                prepare(registry);
+        }
+
+    private:
+        static void Add(std::vector<entt::id_type>& ids, entt::id_type id)
+        {
+            if (std::find(ids.begin(), ids.end(), id) == ids.end())
+                ids.push_back(id);
+        }
+
+        static bool Intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b)
+        {
+            for (auto id : a)
+            {
+                if (std::find(b.begin(), b.end(), id) != b.end())
+                    return true;
+            }
+            return false;
+        }
+
+        template<typename Component>
+        void AddStorage()
+        {
+            m_storagePreparers.push_back([](entt::registry& registry) { registry.storage<Component>(); });
+        }
+
+        std::vector<entt::id_type> m_reads;
+        std::vector<entt::id_type> m_writes;
+        std::vector<void(*)(entt::registry&)> m_storagePreparers;
+        bool m_isExclusive = false;
+    };
+}
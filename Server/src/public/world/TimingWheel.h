@@ -0,0 +1,132 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <entt/entt.hpp>
+
+
+namespace MMO::Core
+{
+    // Types d'evenements du jeu. Sauvegardes avec le royaume (WorldSnapshot) : ne jamais renumeroter
+    enum class TimerEventType : uint16_t
+    {
+        TroopRecovery = 1,      // Blesses d'une bataille rendus a l'armee (data : troupes)
+    };
+
+    // Evenement de timer sans allocation (fin de construction, entrainement de troupes...)
+    // L'entite peut avoir disparu a l'expiration : le handler verifie registry.valid
+    struct TimerEvent
+    {
+        uint16_t type = 0;                      // Route vers le handler enregistre pour ce type
+        entt::entity entity = entt::null;       // Entite concernee
+        uint32_t data = 0;                      // Donnee libre (id de batiment, quantite...)
+    };
+
+    // Evenement en attente et son delai restant (sauvegarde du royaume)
+    struct ScheduledTimerEvent
+    {
+        TimerEvent event;
+        double remainingSeconds = 0.0;
+    };
+
+    // Roue de timers hierarchique : 4 niveaux de 256 cases
+    // Schedule et Cancel en O(1). Le cout par tick ne depend que des timers qui expirent ou descendent de niveau,
+    // pas du nombre total de timers en attente (un timer de plusieurs jours est deplace au plus 3 fois)
+    // Seuls les evenements survivent a un snapshot du royaume : un callback est perdu a l'hibernation ou a la migration
+    // Non thread-safe : un systeme qui planifie des timers doit declarer WriteResource<TimingWheel>()
+    class TimingWheel
+    {
+    public:
+        using Callback = std::function<void()>;
+        using EventHandler = std::function<void(const TimerEvent&)>;
+
+        static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+        // Identifiant d'un timer. La generation rend le handle inerte une fois le timer expire ou annule
+        struct Handle
+        {
+            uint32_t index = INVALID_INDEX;
+            uint32_t generation = 0;
+
+            bool IsValid() const { return index != INVALID_INDEX; }
+        };
+
+        // resolutionMs : granularite de la roue. 10 ms couvre ~2.5 s / 11 min / 46 h / 497 jours par niveau
+        explicit TimingWheel(float resolutionMs = 10.0f);
+
+        // Planifie un callback dans delaySeconds secondes de temps simule
+        Handle Schedule(double delaySeconds, Callback callback);
+
+        // Planifie un evenement, livre au handler de son type
+        Handle ScheduleEvent(double delaySeconds, const TimerEvent& event);
+
+        // Annule un timer en attente. Retourne false s'il a deja expire ou ete annule
+        bool Cancel(Handle handle);
+
+        bool IsPending(Handle handle) const;
+
+        // Temps restant (secondes) avant expiration, 0 si le timer n'est plus en attente
+        float GetRemaining(Handle handle) const;
+
+        // Handler appele pour chaque evenement expire du type donne
+        void SetEventHandler(uint16_t type, EventHandler handler);
+
+        // Avance le temps simule et declenche les timers expires (dans l'ordre d'expiration)
+        void Advance(float dt);
+
+        size_t GetPendingCount() const { return m_pendingCount; }
+
+        // Evenements en attente (callbacks exclus), pour la sauvegarde du royaume
+        void CollectEvents(std::vector<ScheduledTimerEvent>& out) const;
+
+    private:
+        static constexpr int LEVEL_COUNT = 4;
+        static constexpr int SLOT_BITS = 8;
+        static constexpr uint32_t SLOT_COUNT = 1u << SLOT_BITS;
+        static constexpr uint32_t SLOT_MASK = SLOT_COUNT - 1;
+
+        // Noeud d'une liste intrusive doublement chainee (indices dans m_nodes)
+        struct Node
+        {
+            uint64_t expiry = 0;                // Echeance absolue, en unites de la roue
+            uint32_t prev = INVALID_INDEX;
+            uint32_t next = INVALID_INDEX;
+            uint32_t generation = 0;
+            uint16_t slot = 0;                  // niveau * SLOT_COUNT + case (pour le retrait en O(1))
+            bool isActive = false;
+            bool hasCallback = false;           // Callback stocke dans m_callbacks, sinon evenement
+            TimerEvent event;
+        };
+
+        Handle Insert(double delaySeconds);
+
+        uint32_t AllocateNode();
+        void FreeNode(uint32_t index);
+
+        // Range le noeud dans le niveau correspondant a son echeance
+        void Link(uint32_t index);
+        void Unlink(uint32_t index);
+
+        // Avance d'une unite : redescend les niveaux superieurs puis declenche la case courante
+        void Step();
+        void Cascade(int level);
+        void Fire(uint32_t index);
+
+        const Node* FindActive(Handle handle) const;
+
+        double m_unitsPerSecond;
+        double m_accumulator = 0.0;     // Fraction d'unite pas encore consommee
+        uint64_t m_now = 0;             // Temps courant, en unites
+
+        std::vector<Node> m_nodes;
+        std::vector<uint32_t> m_freeNodes;
+        std::array<uint32_t, LEVEL_COUNT * SLOT_COUNT> m_slotHeads;
+        size_t m_pendingCount = 0;
+
+        // Les callbacks sont rares face aux evenements : stockes a part pour garder des noeuds compacts
+        std::unordered_map<uint32_t, Callback> m_callbacks;
+        std::vector<EventHandler> m_eventHandlers;
+    };
+}
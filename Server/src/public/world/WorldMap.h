@@ -0,0 +1,144 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "utils/MappedFile.h"
+
+
+namespace MMO::Core
+{
+    // Format binaire d'une carte statique (little-endian, sections alignees sur 8 octets) :
+    //   WorldMapHeader | types de tuiles (u8, ligne par ligne) | passabilite (1 bit par tuile) | StaticObject[]
+    // Lu tel quel depuis la projection memoire : aucun parsing, aucune copie
+    static_assert(std::endian::native == std::endian::little, "WorldMap: format little-endian uniquement");
+
+    inline constexpr char WORLD_MAP_MAGIC[4] = { 'M', 'M', 'O', 'M' };
+    inline constexpr uint16_t WORLD_MAP_VERSION = 1;
+
+    struct WorldMapHeader
+    {
+        char magic[4];                  // "MMOM"
+        uint16_t version;
+        uint16_t headerSize;            // sizeof(WorldMapHeader) a l'ecriture
+        uint32_t width;                 // En tuiles
+        uint32_t height;
+        float tileSize;                 // Unites monde par tuile
+        uint32_t objectCount;
+        uint64_t tilesOffset;
+        uint64_t passabilityOffset;
+        uint64_t objectsOffset;
+        uint64_t fileSize;              // Detecte un fichier tronque
+    };
+    static_assert(sizeof(WorldMapHeader) == 56);
+
+    // Types de terrain (valeurs stables : ecrites dans les fichiers)
+    enum class TileType : uint8_t
+    {
+        Plain = 0,
+        Forest = 1,
+        Mountain = 2,
+        Water = 3
+    };
+
+    // Types d'objets statiques (valeurs stables : ecrites dans les fichiers)
+    enum class StaticObjectType : uint16_t
+    {
+        FoodNode = 1,
+        WoodNode = 2,
+        StoneNode = 3,
+        GoldNode = 4
+    };
+
+    // Objet statique pose sur la carte (noeud de ressource, ruine, sanctuaire...)
+    struct StaticObject
+    {
+        uint16_t type;
+        uint16_t flags;
+        uint32_t tileX;
+        uint32_t tileY;
+        uint32_t data;                  // Donnee libre selon le type (quantite, niveau...)
+    };
+    static_assert(sizeof(StaticObject) == 16);
+
+    // Carte statique d'un royaume, projetee en lecture seule
+    // Immuable une fois ouverte : lisible depuis n'importe quel thread sans synchronisation
+    class WorldMap
+    {
+    public:
+        // Projette et valide le fichier (en-tete, bornes des sections). Retourne false et logge si invalide
+        bool Open(const std::string& path);
+
+        uint32_t GetWidth() const { return m_header->width; }
+        uint32_t GetHeight() const { return m_header->height; }
+        float GetTileSize() const { return m_header->tileSize; }
+
+        // Dimensions en unites monde
+        float GetWorldWidth() const { return static_cast<float>(m_header->width) * m_header->tileSize; }
+        float GetWorldHeight() const { return static_cast<float>(m_header->height) * m_header->tileSize; }
+
+        bool IsInBounds(int tileX, int tileY) const;
+        TileType GetTile(int tileX, int tileY) const;
+        bool IsPassable(int tileX, int tileY) const;   // false hors carte
+
+        // Passabilite de la tuile sous une position monde
+        bool IsPassableAt(float x, float y) const;
+
+        std::span<const StaticObject> GetObjects() const { return { m_objects, m_header->objectCount }; }
+
+        const std::string& GetPath() const { return m_path; }
+        size_t GetFileSize() const { return m_file.GetSize(); }
+
+    private:
+        MMO::Utils::MappedFile m_file;
+        std::string m_path;
+
+        const WorldMapHeader* m_header = nullptr;
+        const uint8_t* m_tiles = nullptr;
+        const uint8_t* m_passability = nullptr;
+        const StaticObject* m_objects = nullptr;
+    };
+
+    // Partage des cartes entre royaumes : une seule projection par fichier
+    // Garde des weak_ptr : une carte qui n'est plus utilisee par aucun royaume est deprojetee
+    class WorldMapCache
+    {
+    public:
+        // Carte deja projetee ou ouverture. nullptr si le fichier est invalide
+        std::shared_ptr<const WorldMap> Load(const std::string& path);
+
+    private:
+        std::unordered_map<std::string, std::weak_ptr<const WorldMap>> m_maps;
+    };
+
+    // Construction et ecriture d'une carte (outils, generation procedurale)
+    class WorldMapBuilder
+    {
+    public:
+        WorldMapBuilder(uint32_t width, uint32_t height, float tileSize);
+
+        // Une tuile Mountain ou Water devient infranchissable, les autres franchissables
+        void SetTile(uint32_t tileX, uint32_t tileY, TileType type);
+        void SetPassable(uint32_t tileX, uint32_t tileY, bool passable);
+        void AddObject(const StaticObject& object);
+
+        TileType GetTile(uint32_t tileX, uint32_t tileY) const;
+        bool IsPassable(uint32_t tileX, uint32_t tileY) const;
+
+        bool Save(const std::string& path) const;
+
+    private:
+        uint32_t m_width;
+        uint32_t m_height;
+        float m_tileSize;
+        std::vector<uint8_t> m_tiles;
+        std::vector<uint8_t> m_passability;
+        std::vector<StaticObject> m_objects;
+    };
+
+    // Carte procedurale (massifs, lacs, forets et noeuds de ressources), deterministe pour une graine donnee
+    WorldMapBuilder GenerateWorldMap(uint32_t width, uint32_t height, float tileSize, uint32_t seed);
+}
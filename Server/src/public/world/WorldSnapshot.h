@@ -0,0 +1,65 @@
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+#include <entt/entt.hpp>
+#include "world/TimingWheel.h"
+
+
+namespace MMO::Core
+{
+    // Format binaire d'une sauvegarde de royaume (little-endian) :
+    //   WorldSnapshotHeader | archive EnTT (entites puis un bloc par type de composant) | evenements de timers
+    // La grille spatiale n'est pas stockee : elle se reconstruit depuis PositionComponent au chargement
+    // Les timers gardent leur delai restant en temps simule : un royaume hiberne ne les fait pas avancer
+    static_assert(std::endian::native == std::endian::little, "WorldSnapshot: format little-endian uniquement");
+
+    inline constexpr char WORLD_SNAPSHOT_MAGIC[4] = { 'M', 'M', 'O', 'S' };
+
+    // A incrementer a chaque changement de composant sauvegarde : un fichier d'une autre version est ignore
+    inline constexpr uint16_t WORLD_SNAPSHOT_VERSION = 3;
+
+    enum WorldSnapshotFlags : uint32_t
+    {
+        SNAPSHOT_FLAG_CLEAN = 1u << 0,  // Ecrit a l'arret : aucune ecriture DB posterieure possible
+    };
+
+    struct WorldSnapshotHeader
+    {
+        char magic[4];                  // "MMOS"
+        uint16_t version;
+        uint16_t headerSize;            // sizeof(WorldSnapshotHeader) a l'ecriture
+        int32_t kingdomId;
+        uint32_t flags;                 // WorldSnapshotFlags
+        int64_t savedAtMs;              // Horloge murale (ms Unix) de la capture
+        uint64_t payloadSize;           // Detecte un fichier tronque
+        uint32_t entityCount;           // Entites vivantes (information)
+        uint32_t checksum;              // FNV-1a du payload
+    };
+    static_assert(sizeof(WorldSnapshotHeader) == 40);
+
+    // Informations d'un snapshot charge
+    struct WorldSnapshotInfo
+    {
+        bool isClean = false;
+        int64_t savedAtMs = 0;
+        uint32_t entityCount = 0;
+    };
+
+    // Serialise la registry et les evenements en attente (en-tete compris) dans un buffer
+    // Le royaume ne doit pas etre ticke pendant l'appel
+    std::vector<uint8_t> CaptureWorldSnapshot(const entt::registry& registry, const TimingWheel& timers, int kingdomId, bool isClean);
+
+    // Ecrit le buffer de facon atomique (fichier temporaire puis renommage)
+    bool WriteWorldSnapshot(const std::string& path, const std::vector<uint8_t>& buffer);
+
+    // Valide le fichier puis le charge dans une registry et des timers vides. Retourne false et logge si absent ou invalide
+    // Les signaux de la registry sont emis : une grille connectee voit passer les positions chargees
+    bool LoadWorldSnapshot(const std::string& path, entt::registry& registry, TimingWheel& timers, int kingdomId, WorldSnapshotInfo& info);
+
+    // Meme validation depuis un buffer deja en memoire (snapshot recu d'un autre processus). source : nom pour les logs
+    bool LoadWorldSnapshot(std::span<const uint8_t> buffer, const std::string& source,
+        entt::registry& registry, TimingWheel& timers, int kingdomId, WorldSnapshotInfo& info);
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "world/IGameSystem.h"
+#include "world/TimingWheel.h"
+#include "ecs/CombatComponents.h"
+
+
+namespace MMO::Core
+{
+    // Combat par batailles : les ordres d'attaque du tick sont regroupes par cible (un ralliement = une bataille),
+    // puis chaque bataille active est resolue une fois par tick, les deux camps frappant simultanement
+    // Les piles de troupes (une par participant) sont rangees en structure de tableaux : le noyau de degats
+    // parcourt des float contigus sans branche et se vectorise. Son cout suit le nombre de participants, pas de troupes
+    // En fin de bataille, une part des pertes revient blessee : rendue par un evenement TroopRecovery des timers du royaume
+    class CombatSystem : public IGameSystem
+    {
+    public:
+        // Periode des bilans intermediaires envoyes aux participants
+        static constexpr float REPORT_INTERVAL = 1.0f;
+
+        void OnAttach(entt::registry& registry) override;
+        void OnTick(float dt, entt::registry& registry) override;
+        std::string GetName() const override { return "Combat"; }
+        void DeclareAccess(SystemAccess& access) const override;
+
+        // Donne un ordre d'attaque (hors tick), engage au prochain tick avec au plus troops troupes disponibles
+        // Retourne false si l'attaquant n'a aucune troupe disponible
+        static bool QueueAttack(entt::registry& registry, entt::entity attacker, entt::entity target, uint32_t troops);
+
+    private:
+        // Piles d'un camp, une par engagement
+        struct TroopStacks
+        {
+            std::vector<entt::entity> owners;
+            std::vector<uint32_t> committed;    // Troupes engagees
+            std::vector<uint32_t> reported;     // Pertes deja retirees de l'armee du participant
+            std::vector<float> troops;          // Restantes, fractionnaires pendant la bataille
+            std::vector<float> attack;
+            std::vector<float> toughness;       // health * defense : degats pour abattre une troupe
+
+            size_t Size() const { return owners.size(); }
+            void Add(entt::entity owner, uint32_t count, const ECS::ArmyComponent& army);
+        };
+
+        struct Battle
+        {
+            uint32_t id = 0;
+            entt::entity target = entt::null;
+            TroopStacks attackers;
+            TroopStacks defenders;
+            std::vector<std::pair<bool, size_t>> joined;    // Piles engagees ce tick (camp defenseur, index), annoncees apres le round
+            float reportCountdown = REPORT_INTERVAL;
+        };
+
+        // Cree la bataille contre la cible (qui defend avec ses troupes disponibles) ou y ajoute l'attaquant
+        void Engage(entt::registry& registry, entt::entity attacker, const ECS::AttackOrderComponent& order);
+
+        // Un round : puissance des deux camps puis degats repartis au prorata des piles
+        static void ResolveRound(Battle& battle, float dt);
+
+        // Bilan de chaque participant d'un camp : retire les nouvelles pertes de son armee
+        // isOver : fin de bataille, les survivants sont rendus et les blesses planifies
+        void ReportSide(entt::registry& registry, const Battle& battle, TroopStacks& side,
+            ECS::CombatEventKind kind, bool isOver, uint32_t attackersLeft, uint32_t defendersLeft);
+
+        // Evenement TroopRecovery : les blesses reviennent dans troops
+        static void OnTroopRecovery(entt::registry& registry, const TimerEvent& event);
+
+        TimingWheel* m_timers = nullptr;    // Timers du royaume (contexte de la registry), absents : pas de blesses
+        std::vector<Battle> m_battles;
+        std::unordered_map<entt::entity, size_t> m_battleByTarget;  // Cible → index dans m_battles
+        uint32_t m_nextBattleId = 1;
+        std::vector<entt::entity> m_orders;                         // Ordres du tick (reutilise)
+    };
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <vector>
+#include "world/IGameSystem.h"
+#include "ecs/MovementComponents.h"
+
+
+namespace MMO::Core
+{
+    // Deplacement autoritaire : avance chaque entite en marche vers sa destination (ou d'etape en etape sur un chemin)
+    // Itere un groupe EnTT qui possede Velocity + MoveTarget (stockage contigu, seules les entites en marche)
+    // Les positions sont ecrites par patch : la grille spatiale les re-range en fin de tick
+    class MovementSystem : public IGameSystem
+    {
+    public:
+        void OnAttach(entt::registry& registry) override;
+        void OnTick(float dt, entt::registry& registry) override;
+        std::string GetName() const override { return "Movement"; }
+        void DeclareAccess(SystemAccess& access) const override;
+
+        // Donne une destination a une entite (vitesse en unites par seconde), en ligne droite
+        // Annule le chemin en cours (ou en calcul). Retourne false si deja arrivee
+        static bool SetDestination(entt::registry& registry, entt::entity entity, float targetX, float targetY, float speed);
+
+        // Fait suivre un chemin a une entite ; un chemin vide l'arrete
+        static void FollowPath(entt::registry& registry, entt::entity entity, std::vector<ECS::PathWaypoint> waypoints, float speed);
+
+    private:
+        // Vise la prochaine etape du chemin ; retire le chemin et le mouvement quand il n'en reste plus
+        static void AdvancePath(entt::registry& registry, entt::entity entity);
+
+        // Part en ligne droite vers (targetX, targetY) sans toucher au chemin
+        static bool StartLeg(entt::registry& registry, entt::entity entity, float targetX, float targetY, float speed);
+
+        std::vector<entt::entity> m_arrived; // Entites arrivees ce tick (reutilise)
+    };
+}
@@ -0,0 +1,248 @@
+#include "TestFramework.h"
+#include "world/PathfindingService.h"
+#include "world/WorldMap.h"
+#include <cmath>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace MMO::Core;
+using MMO::ECS::PathWaypoint;
+
+
+namespace
+{
+    constexpr uint32_t MAP_TILES = 20;
+    constexpr float TILE_SIZE = 10.0f;
+
+    // Carte ecrite dans le dossier temporaire puis projetee, supprimee apres le test
+    class TempMap
+    {
+    public:
+        TempMap(const std::string& name, const WorldMapBuilder& builder)
+            : m_path((std::filesystem::temp_directory_path() / ("mmo_test_" + name + ".map")).string())
+        {
+            auto map = std::make_shared<WorldMap>();
+            if (builder.Save(m_path) && map->Open(m_path))
+                m_map = std::move(map);
+        }
+
+        ~TempMap()
+        {
+            m_map.reset();
+            std::error_code error;
+            std::filesystem::remove(m_path, error);
+        }
+
+        const std::shared_ptr<const WorldMap>& Get() const { return m_map; }
+
+    private:
+        std::string m_path;
+        std::shared_ptr<const WorldMap> m_map;
+    };
+
+    float TileCenter(uint32_t tile)
+    {
+        return (static_cast<float>(tile) + 0.5f) * TILE_SIZE;
+    }
+
+    PathResult FindPath(PathfindingService& service, const std::shared_ptr<const WorldMap>& map,
+                        float startX, float startY, float goalX, float goalY, uint32_t requestId = 1)
+    {
+        auto inbox = std::make_shared<PathInbox>();
+        service.Submit(map, inbox, static_cast<entt::entity>(requestId), requestId, startX, startY, goalX, goalY);
+        return inbox->WaitAndPop();
+    }
+
+    // Chaque segment du chemin (depart compris) ne traverse que des tuiles franchissables
+    bool IsWalkable(const WorldMap& map, float startX, float startY, const std::vector<PathWaypoint>& waypoints)
+    {
+        float x = startX;
+        float y = startY;
+        for (const PathWaypoint& waypoint : waypoints)
+        {
+            float length = std::hypot(waypoint.x - x, waypoint.y - y);
+            int samples = std::max(1, static_cast<int>(length / (TILE_SIZE * 0.25f)));
+            for (int i = 0; i <= samples; ++i)
+            {
+                float t = static_cast<float>(i) / static_cast<float>(samples);
+                if (!map.IsPassableAt(x + (waypoint.x - x) * t, y + (waypoint.y - y) * t))
+                    return false;
+            }
+            x = waypoint.x;
+            y = waypoint.y;
+        }
+        return true;
+    }
+
+    // Mur vertical en x = 10, ouvert seulement en y = 15
+    WorldMapBuilder MakeWallMap()
+    {
+        WorldMapBuilder builder(MAP_TILES, MAP_TILES, TILE_SIZE);
+        for (uint32_t y = 0; y < MAP_TILES; ++y)
+        {
+            if (y != 15)
+                builder.SetTile(10, y, TileType::Mountain);
+        }
+        return builder;
+    }
+}
+
+TEST(Pathfinding_StraightPathEndsOnExactGoal)
+{
+    TempMap map("straight", WorldMapBuilder(MAP_TILES, MAP_TILES, TILE_SIZE));
+    REQUIRE(map.Get());
+    PathfindingService service(1);
+
+    PathResult result = FindPath(service, map.Get(), TileCenter(2), TileCenter(2), 173.0f, 21.5f, 9);
+    CHECK(result.found);
+    CHECK(result.requestId == 9);
+    CHECK(result.entity == static_cast<entt::entity>(9));
+
+    // Ligne droite : aucune etape intermediaire, la derniere est la destination exacte
+    REQUIRE(result.waypoints.size() == 1);
+    CHECK(result.waypoints.back().x == 173.0f);
+    CHECK(result.waypoints.back().y == 21.5f);
+}
+
+TEST(Pathfinding_HugeCoordinatesStayOnTheMap)
+{
+    TempMap map("huge", WorldMapBuilder(MAP_TILES, MAP_TILES, TILE_SIZE));
+    REQUIRE(map.Get());
+    PathfindingService service(1);
+
+    // Hors de la plage de l'int : bornees a la carte avant la conversion en tuile
+    PathResult far = FindPath(service, map.Get(), -1e30f, TileCenter(2), 1e30f, 3e38f);
+    CHECK(far.found);
+    REQUIRE(!far.waypoints.empty());
+    CHECK(far.waypoints.back().x == 1e30f);
+
+    PathResult invalid = FindPath(service, map.Get(), TileCenter(2), TileCenter(2), std::nanf(""), TileCenter(4));
+    CHECK(invalid.requestId == 1);
+}
+
+TEST(Pathfinding_GoesThroughTheOnlyGap)
+{
+    TempMap map("wall", MakeWallMap());
+    REQUIRE(map.Get());
+    PathfindingService service(1);
+
+    const float startX = TileCenter(2);
+    const float startY = TileCenter(2);
+    PathResult result = FindPath(service, map.Get(), startX, startY, TileCenter(17), TileCenter(2));
+    REQUIRE(result.found);
+    CHECK(result.waypoints.size() > 1);
+    CHECK(IsWalkable(*map.Get(), startX, startY, result.waypoints));
+
+    bool usesGap = false;
+    for (const PathWaypoint& waypoint : result.waypoints)
+    {
+        usesGap |= std::floor(waypoint.y / TILE_SIZE) == 15.0f;
+    }
+    CHECK(usesGap);
+}
+
+TEST(Pathfinding_DoesNotCutCorners)
+{
+    // Deux tuiles bloquees en diagonale : le pas diagonal entre elles est interdit
+    WorldMapBuilder builder(MAP_TILES, MAP_TILES, TILE_SIZE);
+    builder.SetTile(5, 4, TileType::Water);
+    builder.SetTile(4, 5, TileType::Water);
+    TempMap map("corner", builder);
+    REQUIRE(map.Get());
+    PathfindingService service(1);
+
+    PathResult result = FindPath(service, map.Get(), TileCenter(4), TileCenter(4), TileCenter(5), TileCenter(5));
+    REQUIRE(result.found);
+    CHECK(result.waypoints.size() > 1);
+    CHECK(IsWalkable(*map.Get(), TileCenter(4), TileCenter(4), result.waypoints));
+}
+
+TEST(Pathfinding_FailsOnBlockedOrEnclosedGoal)
+{
+    WorldMapBuilder builder(MAP_TILES, MAP_TILES, TILE_SIZE);
+    builder.SetTile(3, 3, TileType::Mountain);
+
+    // Tuile (15, 15) entouree de montagnes
+    for (uint32_t y = 14; y <= 16; ++y)
+    {
+        for (uint32_t x = 14; x <= 16; ++x)
+        {
+            if (x != 15 || y != 15)
+                builder.SetTile(x, y, TileType::Mountain);
+        }
+    }
+
+    TempMap map("enclosed", builder);
+    REQUIRE(map.Get());
+    PathfindingService service(1);
+
+    PathResult blocked = FindPath(service, map.Get(), TileCenter(0), TileCenter(0), TileCenter(3), TileCenter(3));
+    CHECK(!blocked.found);
+    CHECK(blocked.waypoints.empty());
+
+    PathResult enclosed = FindPath(service, map.Get(), TileCenter(0), TileCenter(0), TileCenter(15), TileCenter(15));
+    CHECK(!enclosed.found);
+    CHECK(enclosed.waypoints.empty());
+}
+
+TEST(Pathfinding_LatestRequestOfAnEntityIsDelivered)
+{
+    TempMap map("latest", MakeWallMap());
+    REQUIRE(map.Get());
+    PathfindingService service(1);
+
+    // Destinations successives de la meme entite : les requetes remplacees peuvent etre abandonnees, jamais la derniere
+    constexpr uint32_t REQUEST_COUNT = 20;
+    auto inbox = std::make_shared<PathInbox>();
+    const entt::entity entity = static_cast<entt::entity>(3);
+    for (uint32_t requestId = 1; requestId <= REQUEST_COUNT; ++requestId)
+    {
+        service.Submit(map.Get(), inbox, entity, requestId, TileCenter(2), TileCenter(2), TileCenter(17), TileCenter(requestId % MAP_TILES));
+    }
+
+    uint32_t lastId = 0;
+    bool isOrdered = true;
+    PathResult result;
+    do
+    {
+        result = inbox->WaitAndPop();
+        isOrdered = isOrdered && result.requestId > lastId;
+        lastId = result.requestId;
+    } while (result.requestId < REQUEST_COUNT);
+
+    CHECK(isOrdered);
+    CHECK(result.found);
+    CHECK(result.waypoints.back().y == TileCenter(REQUEST_COUNT % MAP_TILES));
+}
+
+TEST(Pathfinding_PopularGoalKeepsValidPaths)
+{
+    TempMap map("popular", MakeWallMap());
+    REQUIRE(map.Get());
+    PathfindingService service(2);
+
+    // Assez de requetes vers la meme tuile pour passer par un flow field, y compris depuis l'autre cote du mur
+    const float goalX = TileCenter(17);
+    const float goalY = TileCenter(2);
+    auto inbox = std::make_shared<PathInbox>();
+    std::vector<PathWaypoint> starts;
+    for (uint32_t i = 0; i < 12; ++i)
+    {
+        starts.push_back({ TileCenter(i % 8), TileCenter(i) });
+        service.Submit(map.Get(), inbox, static_cast<entt::entity>(i), i, starts.back().x, starts.back().y, goalX, goalY);
+    }
+
+    for (size_t i = 0; i < starts.size(); ++i)
+    {
+        PathResult result = inbox->WaitAndPop();
+        REQUIRE(result.requestId < starts.size());
+        const PathWaypoint& start = starts[result.requestId];
+
+        CHECK(result.found);
+        REQUIRE(!result.waypoints.empty());
+        CHECK(result.waypoints.back().x == goalX && result.waypoints.back().y == goalY);
+        CHECK(IsWalkable(*map.Get(), start.x, start.y, result.waypoints));
+    }
+}
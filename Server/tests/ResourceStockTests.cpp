@@ -0,0 +1,122 @@
+#include "TestFramework.h"
+#include "ecs/PlayerComponents.h"
+#include <climits>
+
+using MMO::ECS::ResourceStock;
+
+
+namespace
+{
+    constexpr int64_t START_MS = 1'700'000'000'000;
+    constexpr int64_t HOUR_MS = ResourceStock::MS_PER_HOUR;
+}
+
+TEST(ResourceStock_SettleProducesWholeUnits)
+{
+    ResourceStock stock{ 100, 3600, START_MS };    // 1 unite par seconde
+    stock.Settle(START_MS + 10'500);
+
+    CHECK(stock.amount == 110);
+    CHECK(stock.settledAtMs == START_MS + 10'000);   // Les 500 ms entamees restent a produire
+}
+
+TEST(ResourceStock_SettleCarriesFractionAcrossFrequentSettles)
+{
+    // 50/h : une unite toutes les 72 s. Un reglement par seconde pendant 144 s donne 2 unites, pas 0
+    ResourceStock stock{ 0, 50, START_MS };
+    for (int64_t t = 1'000; t <= 144'000; t += 1'000)
+    {
+        stock.Settle(START_MS + t);
+    }
+
+    CHECK(stock.amount == 2);
+    CHECK(stock.settledAtMs == START_MS + 144'000);
+}
+
+TEST(ResourceStock_SettleKeepsFractionWhenNoUnitIsDue)
+{
+    ResourceStock stock{ 7, 50, START_MS };
+    stock.Settle(START_MS + 71'999);
+
+    CHECK(stock.amount == 7);
+    CHECK(stock.settledAtMs == START_MS);
+}
+
+TEST(ResourceStock_SettleIgnoresPastAndPresent)
+{
+    ResourceStock stock{ 10, 3600, START_MS };
+    stock.Settle(START_MS);
+    stock.Settle(START_MS - 5'000);
+
+    CHECK(stock.amount == 10);
+    CHECK(stock.settledAtMs == START_MS);
+}
+
+TEST(ResourceStock_SettleWithZeroRateAdvancesClock)
+{
+    ResourceStock stock{ 10, 0, START_MS };
+    stock.Settle(START_MS + HOUR_MS);
+
+    CHECK(stock.amount == 10);
+    CHECK(stock.settledAtMs == START_MS + HOUR_MS);
+}
+
+TEST(ResourceStock_NegativeRateConsumesWithFractionCarry)
+{
+    ResourceStock stock{ 100, -50, START_MS };
+    stock.Settle(START_MS + 100'000);
+
+    CHECK(stock.amount == 99);
+    CHECK(stock.settledAtMs == START_MS + 72'000);
+
+    stock.Settle(START_MS + 144'000);
+    CHECK(stock.amount == 98);
+    CHECK(stock.settledAtMs == START_MS + 144'000);
+}
+
+TEST(ResourceStock_NegativeRateSaturatesAtZero)
+{
+    ResourceStock stock{ 1, -100, START_MS };
+    stock.Settle(START_MS + 2 * HOUR_MS + 123);
+
+    CHECK(stock.amount == 0);
+    CHECK(stock.settledAtMs == START_MS + 2 * HOUR_MS + 123);    // Rien a reporter une fois vide
+}
+
+TEST(ResourceStock_SaturatesAtIntMax)
+{
+    ResourceStock stock{ INT_MAX - 1, 3600, START_MS };
+    stock.Settle(START_MS + HOUR_MS);
+
+    CHECK(stock.amount == INT_MAX);
+    CHECK(stock.settledAtMs == START_MS + HOUR_MS);
+}
+
+TEST(ResourceStock_LongAbsenceDoesNotOverflow)
+{
+    // Dix ans au debit maximal : le calcul heures / reste tient dans un int64
+    ResourceStock stock{ 0, INT_MAX, START_MS };
+    stock.Settle(START_MS + 10 * 365 * 24 * HOUR_MS);
+
+    CHECK(stock.amount == INT_MAX);
+}
+
+TEST(ResourceStock_SetRateSettlesAtOldRateFirst)
+{
+    ResourceStock stock{ 0, 3600, START_MS };
+    stock.SetRate(7200, START_MS + 10'000);
+    stock.Settle(START_MS + 20'000);
+
+    CHECK(stock.amount == 10 + 20);
+}
+
+TEST(ResourceStock_AddClampsAtBothEnds)
+{
+    ResourceStock stock{ 5, 0, START_MS };
+    stock.Add(-10);
+    CHECK(stock.amount == 0);
+
+    stock.amount = INT_MAX - 1;
+    stock.Add(10);
+    CHECK(stock.amount == INT_MAX);
+}
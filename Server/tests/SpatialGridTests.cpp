@@ -0,0 +1,252 @@
+#include "TestFramework.h"
+#include "world/SpatialGrid.h"
+#include "ecs/PlayerComponents.h"
+#include <algorithm>
+#include <vector>
+
+using MMO::Core::SpatialGrid;
+using MMO::Core::LodAggregate;
+using MMO::ECS::PositionComponent;
+
+
+namespace
+{
+    constexpr float CELL_SIZE = 100.0f;
+    constexpr float MAP_SIZE = 1000.0f;
+
+    entt::entity Entity(uint32_t id)
+    {
+        return static_cast<entt::entity>(id);
+    }
+
+    std::vector<entt::entity> Sorted(std::vector<entt::entity> entities)
+    {
+        std::sort(entities.begin(), entities.end());
+        return entities;
+    }
+
+    // Les deux stockages doivent repondre de la meme facon
+    std::vector<SpatialGrid> MakeGrids()
+    {
+        std::vector<SpatialGrid> grids;
+        grids.emplace_back(CELL_SIZE);
+        grids.emplace_back(CELL_SIZE, MAP_SIZE, MAP_SIZE);
+        return grids;
+    }
+
+    std::vector<entt::entity> QueryRadius(const SpatialGrid& grid, float x, float y, float radius)
+    {
+        std::vector<entt::entity> out;
+        grid.QueryRadius(x, y, radius, out);
+        return Sorted(std::move(out));
+    }
+}
+
+TEST(SpatialGrid_QueryRadiusFiltersExactDistance)
+{
+    for (SpatialGrid& grid : MakeGrids())
+    {
+        grid.Insert(Entity(1), 250.0f, 250.0f);
+        grid.Insert(Entity(2), 350.0f, 250.0f);     // Exactement au rayon, cellule voisine
+        grid.Insert(Entity(3), 321.0f, 321.0f);     // Dans le carre englobant, hors du cercle
+        grid.Insert(Entity(4), 450.0f, 250.0f);
+
+        CHECK((QueryRadius(grid, 250.0f, 250.0f, 100.0f) == std::vector<entt::entity>{ Entity(1), Entity(2) }));
+        CHECK(QueryRadius(grid, 250.0f, 250.0f, -1.0f).empty());
+    }
+}
+
+TEST(SpatialGrid_QueryRectIncludesBounds)
+{
+    for (SpatialGrid& grid : MakeGrids())
+    {
+        grid.Insert(Entity(1), 100.0f, 100.0f);
+        grid.Insert(Entity(2), 300.0f, 200.0f);
+        grid.Insert(Entity(3), 300.5f, 200.0f);
+
+        std::vector<entt::entity> out;
+        grid.QueryRect(100.0f, 100.0f, 300.0f, 200.0f, out);
+        CHECK((Sorted(out) == std::vector<entt::entity>{ Entity(1), Entity(2) }));
+
+        // Rectangle inverse : rien
+        out.clear();
+        grid.QueryRect(300.0f, 200.0f, 100.0f, 100.0f, out);
+        CHECK(out.empty());
+    }
+}
+
+TEST(SpatialGrid_QueryNeighborsCoversThreeByThreeCells)
+{
+    for (SpatialGrid& grid : MakeGrids())
+    {
+        grid.Insert(Entity(1), 450.0f, 450.0f);     // Cellule centrale (4, 4)
+        grid.Insert(Entity(2), 301.0f, 599.0f);     // Coin de la zone (3, 5)
+        grid.Insert(Entity(3), 299.0f, 450.0f);     // Cellule (2, 4), hors zone
+        grid.Insert(Entity(4), 450.0f, 600.0f);     // Cellule (4, 6), hors zone
+
+        std::vector<entt::entity> out;
+        grid.QueryNeighbors(450.0f, 450.0f, out);
+        CHECK((Sorted(out) == std::vector<entt::entity>{ Entity(1), Entity(2) }));
+    }
+}
+
+TEST(SpatialGrid_MoveUpdatesCellAndStoredPosition)
+{
+    for (SpatialGrid& grid : MakeGrids())
+    {
+        grid.Insert(Entity(1), 50.0f, 50.0f);
+
+        // Meme cellule : seule la position stockee change, le filtre exact la voit
+        grid.Move(Entity(1), 90.0f, 90.0f);
+        CHECK(QueryRadius(grid, 50.0f, 50.0f, 10.0f).empty());
+        CHECK((QueryRadius(grid, 90.0f, 90.0f, 1.0f) == std::vector<entt::entity>{ Entity(1) }));
+
+        // Autre cellule
+        grid.Move(Entity(1), 950.0f, 950.0f);
+        CHECK(QueryRadius(grid, 90.0f, 90.0f, 200.0f).empty());
+        CHECK((QueryRadius(grid, 950.0f, 950.0f, 1.0f) == std::vector<entt::entity>{ Entity(1) }));
+
+        // Entite absente : Move l'insere
+        grid.Move(Entity(2), 500.0f, 500.0f);
+        CHECK((QueryRadius(grid, 500.0f, 500.0f, 1.0f) == std::vector<entt::entity>{ Entity(2) }));
+    }
+}
+
+TEST(SpatialGrid_RemoveKeepsOtherEntitiesOfTheCell)
+{
+    for (SpatialGrid& grid : MakeGrids())
+    {
+        grid.Insert(Entity(1), 10.0f, 10.0f);
+        grid.Insert(Entity(2), 20.0f, 20.0f);
+        grid.Insert(Entity(3), 30.0f, 30.0f);
+
+        // Retrait par swap : la derniere entite de la cellule prend la place de la premiere
+        grid.Remove(Entity(1));
+        grid.Remove(Entity(1));
+        CHECK((QueryRadius(grid, 20.0f, 20.0f, 50.0f) == std::vector<entt::entity>{ Entity(2), Entity(3) }));
+
+        grid.Move(Entity(3), 35.0f, 35.0f);
+        CHECK((QueryRadius(grid, 35.0f, 35.0f, 1.0f) == std::vector<entt::entity>{ Entity(3) }));
+
+        grid.Clear();
+        CHECK(QueryRadius(grid, 20.0f, 20.0f, 50.0f).empty());
+    }
+}
+
+TEST(SpatialGrid_DenseKeepsPositionsOutsideMapOnBorder)
+{
+    SpatialGrid grid(CELL_SIZE, MAP_SIZE, MAP_SIZE);
+    REQUIRE(grid.IsDense());
+
+    grid.Insert(Entity(1), -50.0f, 2000.0f);
+
+    // Rangee dans la cellule du bord, position exacte conservee pour les filtres
+    std::vector<entt::entity> out;
+    grid.QueryNeighbors(0.0f, MAP_SIZE - 1.0f, out);
+    CHECK((out == std::vector<entt::entity>{ Entity(1) }));
+
+    CHECK((QueryRadius(grid, -50.0f, 2000.0f, 1.0f) == std::vector<entt::entity>{ Entity(1) }));
+    CHECK(QueryRadius(grid, 0.0f, MAP_SIZE - 1.0f, 10.0f).empty());
+}
+
+TEST(SpatialGrid_DenseIgnoresStaleVersionOfRecycledEntity)
+{
+    entt::registry registry;
+    entt::entity stale = registry.create();
+    registry.destroy(stale);
+    entt::entity current = registry.create();
+    REQUIRE(entt::to_entity(stale) == entt::to_entity(current));
+    REQUIRE(stale != current);
+
+    SpatialGrid grid(CELL_SIZE, MAP_SIZE, MAP_SIZE);
+    grid.Insert(stale, 100.0f, 100.0f);
+    grid.Insert(current, 700.0f, 700.0f);
+
+    // L'ancienne version ne doit ni rester dans la grille ni retirer la nouvelle
+    grid.Remove(stale);
+    CHECK(QueryRadius(grid, 100.0f, 100.0f, 10.0f).empty());
+    CHECK((QueryRadius(grid, 700.0f, 700.0f, 10.0f) == std::vector<entt::entity>{ current }));
+}
+
+TEST(SpatialGrid_ApplyBatchFollowsPositionSignals)
+{
+    for (SpatialGrid& grid : MakeGrids())
+    {
+        entt::registry registry;
+        grid.Connect(registry);
+
+        entt::entity a = registry.create();
+        entt::entity b = registry.create();
+        registry.emplace<PositionComponent>(a, 100.0f, 100.0f);
+        registry.emplace<PositionComponent>(b, 500.0f, 500.0f);
+
+        // Rien n'est applique avant le lot
+        CHECK(QueryRadius(grid, 100.0f, 100.0f, 1.0f).empty());
+        grid.ApplyBatch(registry);
+        CHECK(grid.GetPendingCount() == 0);
+        CHECK((QueryRadius(grid, 100.0f, 100.0f, 1.0f) == std::vector<entt::entity>{ a }));
+
+        // Plusieurs patchs dans le tick : seule la derniere position compte
+        registry.patch<PositionComponent>(a, [](PositionComponent& position) { position.x = 300.0f; });
+        registry.patch<PositionComponent>(a, [](PositionComponent& position) { position.x = 800.0f; });
+
+        // Position retiree puis remise dans le meme tick : une mise a jour, pas un retrait
+        registry.remove<PositionComponent>(b);
+        registry.emplace<PositionComponent>(b, 520.0f, 500.0f);
+        grid.ApplyBatch(registry);
+
+        CHECK(QueryRadius(grid, 300.0f, 100.0f, 1.0f).empty());
+        CHECK((QueryRadius(grid, 800.0f, 100.0f, 1.0f) == std::vector<entt::entity>{ a }));
+        CHECK((QueryRadius(grid, 520.0f, 500.0f, 1.0f) == std::vector<entt::entity>{ b }));
+
+        registry.destroy(a);
+        grid.ApplyBatch(registry);
+        CHECK(QueryRadius(grid, 800.0f, 100.0f, 1.0f).empty());
+
+        grid.Disconnect(registry);
+    }
+}
+
+TEST(SpatialGrid_QueryLodAggregatesWideViews)
+{
+    constexpr float WIDE_MAP = 6400.0f;    // 64 x 64 cellules
+    SpatialGrid grid(CELL_SIZE, WIDE_MAP, WIDE_MAP);
+
+    uint32_t count = 0;
+    for (float y = 50.0f; y < WIDE_MAP; y += 640.0f)
+    {
+        for (float x = 50.0f; x < WIDE_MAP; x += 320.0f)
+        {
+            grid.Insert(Entity(++count), x, y);
+        }
+    }
+
+    // Vue etroite (3 x 3 cellules) : entites exactes
+    std::vector<entt::entity> entities;
+    std::vector<LodAggregate> aggregates;
+    CHECK(grid.QueryLod(0.0f, 0.0f, 250.0f, 250.0f, 16, entities, aggregates) == 0);
+    CHECK(entities.size() == 1);
+    CHECK(aggregates.empty());
+
+    // Carte entiere avec 16 noeuds : niveau 4 (4 x 4 noeuds de 16 cellules)
+    entities.clear();
+    CHECK(grid.QueryLod(0.0f, 0.0f, WIDE_MAP - 1.0f, WIDE_MAP - 1.0f, 16, entities, aggregates) == 4);
+    CHECK(entities.empty());
+    CHECK(aggregates.size() == 16);
+
+    uint32_t total = 0;
+    for (const LodAggregate& aggregate : aggregates)
+    {
+        total += aggregate.count;
+        CHECK(aggregate.x >= aggregate.minX && aggregate.x < aggregate.maxX);
+        CHECK(aggregate.y >= aggregate.minY && aggregate.y < aggregate.maxY);
+    }
+    CHECK(total == count);
+
+    // Deplacement entre deux noeuds : les compteurs suivent
+    grid.Move(Entity(1), WIDE_MAP - 50.0f, WIDE_MAP - 50.0f);
+    aggregates.clear();
+    grid.QueryLod(0.0f, 0.0f, 1599.0f, 1599.0f, 1, entities, aggregates);
+    REQUIRE(aggregates.size() == 1);
+    CHECK(aggregates[0].count == 3 * 5 - 1);    // 5 colonnes x 3 lignes dans le premier noeud, moins l'entite partie
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+
+// Mini framework de tests : TEST enregistre un cas, CHECK note l'echec sans interrompre le cas
+// xmake test (ou xmake build ServerTests && xmake run ServerTests [filtre])
+namespace MMO::Tests
+{
+    struct TestCase
+    {
+        const char* name;
+        std::function<void()> body;
+    };
+
+    inline std::vector<TestCase>& GetTests()
+    {
+        static std::vector<TestCase> tests;
+        return tests;
+    }
+
+    // Echecs du cas en cours
+    inline int& CurrentFailures()
+    {
+        static int failures = 0;
+        return failures;
+    }
+
+    struct TestRegistrar
+    {
+        TestRegistrar(const char* name, std::function<void()> body)
+        {
+            GetTests().push_back(TestCase{ name, std::move(body) });
+        }
+    };
+
+    inline void ReportFailure(const char* file, int line, const char* expression)
+    {
+        std::printf("  %s:%d: CHECK(%s) echoue\n", file, line, expression);
+        ++CurrentFailures();
+    }
+}
+
+#define MMO_TEST_CONCAT_INNER(a, b) a##b
+#define MMO_TEST_CONCAT(a, b) MMO_TEST_CONCAT_INNER(a, b)
+
+#define TEST(name)                                                                              \
+    static void name();                                                                         \
+    static MMO::Tests::TestRegistrar MMO_TEST_CONCAT(s_registrar_, name)(#name, &name);         \
+    static void name()
+
+#define CHECK(expression)                                                                       \
+    do                                                                                          \
+    {                                                                                           \
+        if (!(expression))                                                                      \
+            MMO::Tests::ReportFailure(__FILE__, __LINE__, #expression);                         \
+    } while (0)
+
+// Arrete le cas : la suite n'a pas de sens si la condition est fausse
+#define REQUIRE(expression)                                                                     \
+    do                                                                                          \
+    {                                                                                           \
+        if (!(expression))                                                                      \
+        {                                                                                       \
+            MMO::Tests::ReportFailure(__FILE__, __LINE__, #expression);                         \
+            return;                                                                             \
+        }                                                                                       \
+    } while (0)
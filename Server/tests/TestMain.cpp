@@ -0,0 +1,43 @@
+#include "TestFramework.h"
+#include <cstring>
+#include <exception>
+
+
+// Execute tous les cas (ou ceux dont le nom contient argv[1]), code de sortie = nombre de cas en echec
+int main(int argc, char** argv)
+{
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+
+    int run = 0;
+    int failed = 0;
+    for (const auto& test : MMO::Tests::GetTests())
+    {
+        if (filter && !std::strstr(test.name, filter))
+            continue;
+
+        MMO::Tests::CurrentFailures() = 0;
+        try
+        {
+            test.body();
+        }
+        catch (const std::exception& e)
+        {
+            std::printf("  exception: %s\n", e.what());
+            ++MMO::Tests::CurrentFailures();
+        }
+
+        ++run;
+        if (MMO::Tests::CurrentFailures() > 0)
+        {
+            ++failed;
+            std::printf("[ECHEC] %s\n", test.name);
+        }
+        else
+        {
+            std::printf("[OK]    %s\n", test.name);
+        }
+    }
+
+    std::printf("\n%d test(s), %d echec(s)\n", run, failed);
+    return failed;
+}
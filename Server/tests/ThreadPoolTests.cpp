@@ -0,0 +1,47 @@
+#include "TestFramework.h"
+#include "utils/ThreadPool.h"
+#include <atomic>
+#include <stdexcept>
+
+using MMO::Utils::ThreadPool;
+
+
+TEST(ThreadPool_ParallelForRunsEveryIndex)
+{
+    ThreadPool pool(3);
+    std::atomic<size_t> sum{ 0 };
+
+    pool.ParallelFor(100, [&sum](size_t i) { sum.fetch_add(i); });
+
+    CHECK(sum.load() == 4950);
+}
+
+TEST(ThreadPool_ParallelForRethrowsWithoutHanging)
+{
+    ThreadPool pool(3);
+    std::atomic<size_t> runCount{ 0 };
+    bool hasThrown = false;
+
+    // Un indice qui leve ne doit pas bloquer la barriere : les autres s'executent, l'exception revient a l'appelant
+    try
+    {
+        pool.ParallelFor(64, [&runCount](size_t i)
+        {
+            runCount.fetch_add(1);
+            if (i == 7)
+                throw std::runtime_error("job en echec");
+        });
+    }
+    catch (const std::runtime_error&)
+    {
+        hasThrown = true;
+    }
+
+    CHECK(hasThrown);
+    CHECK(runCount.load() == 64);
+
+    // Le pool reste utilisable apres l'echec
+    std::atomic<size_t> count{ 0 };
+    pool.ParallelFor(10, [&count](size_t) { count.fetch_add(1); });
+    CHECK(count.load() == 10);
+}
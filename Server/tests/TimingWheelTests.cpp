@@ -0,0 +1,161 @@
+#include "TestFramework.h"
+#include "world/TimingWheel.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using MMO::Core::TimingWheel;
+using MMO::Core::TimerEvent;
+using MMO::Core::ScheduledTimerEvent;
+
+
+namespace
+{
+    // Une unite par seconde : les delais des tests se lisent directement en unites de la roue
+    constexpr float ONE_SECOND_MS = 1000.0f;
+
+    constexpr uint64_t LEVEL_1 = uint64_t{ 1 } << 8;
+    constexpr uint64_t LEVEL_2 = uint64_t{ 1 } << 16;
+    constexpr uint64_t LEVEL_3 = uint64_t{ 1 } << 24;
+
+    // Chaque timer doit rester en attente jusqu'a l'unite precedant son echeance, puis expirer sur elle
+    void CheckExactExpiry(uint64_t start)
+    {
+        TimingWheel wheel(ONE_SECOND_MS);
+        wheel.Advance(static_cast<float>(start));
+
+        // Bords de chaque niveau : juste avant, sur et juste apres un tour complet du niveau inferieur
+        const std::vector<uint64_t> delays = {
+            1, LEVEL_1 - 1, LEVEL_1, LEVEL_1 + 1,
+            LEVEL_2 - 1, LEVEL_2, LEVEL_2 + 1,
+            LEVEL_3 - 1, LEVEL_3, LEVEL_3 + 1, LEVEL_3 + LEVEL_2 + 3 };
+
+        std::vector<uint64_t> fired;
+        for (uint64_t delay : delays)
+        {
+            wheel.Schedule(static_cast<double>(delay), [&fired, delay] { fired.push_back(delay); });
+        }
+
+        uint64_t elapsed = 0;
+        for (size_t i = 0; i < delays.size(); ++i)
+        {
+            wheel.Advance(static_cast<float>(delays[i] - 1 - elapsed));
+            CHECK(fired.size() == i);
+
+            wheel.Advance(1.0f);
+            REQUIRE(fired.size() == i + 1);
+            CHECK(fired.back() == delays[i]);
+            elapsed = delays[i];
+        }
+
+        CHECK(wheel.GetPendingCount() == 0);
+    }
+}
+
+TEST(TimingWheel_CascadeFiresAtExactUnitOnEveryLevel)
+{
+    CheckExactExpiry(0);
+}
+
+TEST(TimingWheel_CascadeFiresAtExactUnitFromUnalignedStart)
+{
+    // Depart au milieu d'un tour de chaque niveau : les cases superieures sont deja entamees
+    CheckExactExpiry(LEVEL_2 + LEVEL_1 + 37);
+}
+
+TEST(TimingWheel_FiresInExpiryOrderWithinOneAdvance)
+{
+    TimingWheel wheel(ONE_SECOND_MS);
+
+    std::vector<int> order;
+    wheel.Schedule(70'000.0, [&order] { order.push_back(3); });
+    wheel.Schedule(300.0, [&order] { order.push_back(2); });
+    wheel.Schedule(5.0, [&order] { order.push_back(1); });
+
+    wheel.Advance(70'000.0f);
+    CHECK((order == std::vector<int>{ 1, 2, 3 }));
+}
+
+TEST(TimingWheel_CancelledHandleIsStale)
+{
+    TimingWheel wheel(ONE_SECOND_MS);
+
+    int firstCount = 0;
+    int secondCount = 0;
+    auto first = wheel.Schedule(10.0, [&firstCount] { ++firstCount; });
+    CHECK(wheel.Cancel(first));
+    CHECK(!wheel.Cancel(first));
+    CHECK(!wheel.IsPending(first));
+    CHECK(wheel.GetRemaining(first) == 0.0f);
+
+    // Le noeud libere est reutilise : l'ancien handle ne doit pas designer le nouveau timer
+    auto second = wheel.Schedule(10.0, [&secondCount] { ++secondCount; });
+    REQUIRE(second.index == first.index);
+    CHECK(second.generation != first.generation);
+    CHECK(!wheel.IsPending(first));
+    CHECK(!wheel.Cancel(first));
+    CHECK(wheel.IsPending(second));
+
+    wheel.Advance(10.0f);
+    CHECK(firstCount == 0);
+    CHECK(secondCount == 1);
+}
+
+TEST(TimingWheel_ExpiredHandleIsStale)
+{
+    TimingWheel wheel(ONE_SECOND_MS);
+
+    auto handle = wheel.Schedule(LEVEL_1 + 4.0, [] {});
+    wheel.Advance(4.0f);
+    CHECK(wheel.GetRemaining(handle) == static_cast<float>(LEVEL_1));
+
+    wheel.Advance(static_cast<float>(LEVEL_1));
+    CHECK(!wheel.IsPending(handle));
+    CHECK(!wheel.Cancel(handle));
+    CHECK(wheel.GetRemaining(handle) == 0.0f);
+    CHECK(wheel.GetPendingCount() == 0);
+}
+
+TEST(TimingWheel_CallbackCancelsTimerOfSameSlot)
+{
+    TimingWheel wheel(ONE_SECOND_MS);
+
+    // Meme echeance : le premier declenche annule l'autre, qui ne doit plus partir
+    int fireCount = 0;
+    TimingWheel::Handle first;
+    TimingWheel::Handle second;
+    first = wheel.Schedule(3.0, [&] { ++fireCount; CHECK(wheel.Cancel(second)); });
+    second = wheel.Schedule(3.0, [&] { ++fireCount; CHECK(wheel.Cancel(first)); });
+
+    wheel.Advance(3.0f);
+    CHECK(fireCount == 1);
+    CHECK(wheel.GetPendingCount() == 0);
+}
+
+TEST(TimingWheel_CollectEventsSkipsCallbacks)
+{
+    TimingWheel wheel(ONE_SECOND_MS);
+
+    std::vector<uint32_t> delivered;
+    wheel.SetEventHandler(7, [&delivered](const TimerEvent& event) { delivered.push_back(event.data); });
+    wheel.ScheduleEvent(LEVEL_2 + 10.0, TimerEvent{ 7, entt::null, 42 });
+    wheel.Schedule(20.0, [] {});
+    wheel.Advance(10.0f);
+
+    std::vector<ScheduledTimerEvent> events;
+    wheel.CollectEvents(events);
+    REQUIRE(events.size() == 1);
+    CHECK(events[0].event.type == 7);
+    CHECK(events[0].event.data == 42);
+    CHECK(events[0].remainingSeconds == static_cast<double>(LEVEL_2));
+
+    // Rechargement dans une roue neuve (snapshot) : meme echeance relative
+    TimingWheel restored(ONE_SECOND_MS);
+    restored.SetEventHandler(7, [&delivered](const TimerEvent& event) { delivered.push_back(event.data); });
+    restored.ScheduleEvent(events[0].remainingSeconds, events[0].event);
+
+    restored.Advance(static_cast<float>(LEVEL_2 - 1));
+    CHECK(delivered.empty());
+    restored.Advance(1.0f);
+    CHECK((delivered == std::vector<uint32_t>{ 42 }));
+}
@@ -0,0 +1,256 @@
+#include "TestFramework.h"
+#include "world/WorldSnapshot.h"
+#include "ecs/PlayerComponents.h"
+#include "ecs/MovementComponents.h"
+#include "ecs/CombatComponents.h"
+#include "utils/StringInterner.h"
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+using namespace MMO;
+using Core::TimingWheel;
+using Core::TimerEvent;
+using Core::ScheduledTimerEvent;
+
+
+namespace
+{
+    constexpr int KINGDOM_ID = 7;
+
+    // Deux joueurs (dont un en marche sur un chemin), une entite sans joueur et un evenement en attente
+    std::vector<uint8_t> CaptureSample(entt::registry& registry, TimingWheel& timers, bool isClean)
+    {
+        entt::entity walker = registry.create();
+        registry.emplace<ECS::PlayerInfoComponent>(walker, ECS::PlayerInfoComponent{ 42, 1001, Utils::Intern("Alice") });
+        registry.emplace<ECS::PositionComponent>(walker, 120.5f, 340.25f);
+        registry.emplace<ECS::VelocityComponent>(walker, 3.0f, -4.0f);
+        registry.emplace<ECS::MoveTargetComponent>(walker, 150.0f, 300.0f);
+        registry.emplace<ECS::PathComponent>(walker, ECS::PathComponent{ { { 150.0f, 300.0f }, { 400.0f, 80.0f } }, 1, 7.5f });
+
+        ECS::ResourcesComponent resources;
+        resources.food = ECS::ResourceStock{ 1234, 60, 1'700'000'000'000 };
+        resources.gold.ratePerHour = -5;
+        registry.emplace<ECS::ResourcesComponent>(walker, resources);
+
+        ECS::ArmyComponent army;
+        army.troops = 640;
+        army.deployed = 200;
+        army.wounded = 90;
+        army.attack = 12.0f;
+        registry.emplace<ECS::ArmyComponent>(walker, army);
+
+        entt::entity removed = registry.create();
+
+        entt::entity idle = registry.create();
+        registry.emplace<ECS::PlayerInfoComponent>(idle, ECS::PlayerInfoComponent{ 43, 1002, Utils::Intern("Bob") });
+        registry.emplace<ECS::PositionComponent>(idle, 900.0f, 10.0f);
+        registry.emplace<ECS::ResourcesComponent>(idle);
+
+        entt::entity marker = registry.create();
+        registry.emplace<ECS::PositionComponent>(marker, 5.0f, 5.0f);
+
+        // Un trou dans les identifiants : les entites doivent garder le leur
+        registry.destroy(removed);
+
+        timers.ScheduleEvent(600.0, TimerEvent{ static_cast<uint16_t>(Core::TimerEventType::TroopRecovery), walker, 90 });
+        timers.Schedule(30.0, [] {});     // Callback : jamais sauvegarde
+
+        return Core::CaptureWorldSnapshot(registry, timers, KINGDOM_ID, isClean);
+    }
+
+    bool SameStock(const ECS::ResourceStock& a, const ECS::ResourceStock& b)
+    {
+        return a.amount == b.amount && a.ratePerHour == b.ratePerHour && a.settledAtMs == b.settledAtMs;
+    }
+
+    // Payload modifie : le checksum est recalcule comme le ferait un fichier forge ou corrompu avant ecriture
+    uint32_t PayloadChecksum(const std::vector<uint8_t>& buffer)
+    {
+        uint32_t hash = 2166136261u;
+        for (size_t i = sizeof(Core::WorldSnapshotHeader); i < buffer.size(); ++i)
+        {
+            hash ^= buffer[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+}
+
+TEST(WorldSnapshot_CaptureThenLoadRestoresRegistry)
+{
+    entt::registry source;
+    TimingWheel sourceTimers;
+    std::vector<uint8_t> buffer = CaptureSample(source, sourceTimers, true);
+
+    entt::registry registry;
+    TimingWheel timers;
+    Core::WorldSnapshotInfo info;
+    REQUIRE(Core::LoadWorldSnapshot(buffer, "test", registry, timers, KINGDOM_ID, info));
+    CHECK(info.isClean);
+    CHECK(info.entityCount == 3);
+
+    size_t entityCount = 0;
+    for (auto [entity, position] : source.view<ECS::PositionComponent>().each())
+    {
+        ++entityCount;
+        REQUIRE(registry.valid(entity));
+
+        const auto& loadedPosition = registry.get<ECS::PositionComponent>(entity);
+        CHECK(loadedPosition.x == position.x && loadedPosition.y == position.y);
+
+        CHECK(source.all_of<ECS::PlayerInfoComponent>(entity) == registry.all_of<ECS::PlayerInfoComponent>(entity));
+        if (const auto* player = source.try_get<ECS::PlayerInfoComponent>(entity))
+        {
+            // Le pseudo repasse par l'interner, le joueur revient hors ligne
+            const auto& loaded = registry.get<ECS::PlayerInfoComponent>(entity);
+            CHECK(loaded.accountID == player->accountID);
+            CHECK(Utils::Resolve(loaded.username) == Utils::Resolve(player->username));
+            CHECK(loaded.playerID == ECS::PlayerInfoComponent{}.playerID);
+        }
+
+        CHECK(source.all_of<ECS::ResourcesComponent>(entity) == registry.all_of<ECS::ResourcesComponent>(entity));
+        if (const auto* resources = source.try_get<ECS::ResourcesComponent>(entity))
+        {
+            const auto& loaded = registry.get<ECS::ResourcesComponent>(entity);
+            CHECK(SameStock(loaded.food, resources->food));
+            CHECK(SameStock(loaded.wood, resources->wood));
+            CHECK(SameStock(loaded.stone, resources->stone));
+            CHECK(SameStock(loaded.gold, resources->gold));
+        }
+
+        CHECK(source.all_of<ECS::PathComponent>(entity) == registry.all_of<ECS::PathComponent>(entity));
+        if (const auto* path = source.try_get<ECS::PathComponent>(entity))
+        {
+            const auto& loaded = registry.get<ECS::PathComponent>(entity);
+            REQUIRE(loaded.waypoints.size() == path->waypoints.size());
+            for (size_t i = 0; i < path->waypoints.size(); ++i)
+            {
+                CHECK(loaded.waypoints[i].x == path->waypoints[i].x && loaded.waypoints[i].y == path->waypoints[i].y);
+            }
+            CHECK(loaded.next == path->next);
+            CHECK(loaded.speed == path->speed);
+
+            const auto& velocity = registry.get<ECS::VelocityComponent>(entity);
+            const auto& target = registry.get<ECS::MoveTargetComponent>(entity);
+            CHECK(velocity.x == 3.0f && velocity.y == -4.0f);
+            CHECK(target.x == 150.0f && target.y == 300.0f);
+        }
+
+        CHECK(source.all_of<ECS::ArmyComponent>(entity) == registry.all_of<ECS::ArmyComponent>(entity));
+        if (const auto* army = source.try_get<ECS::ArmyComponent>(entity))
+        {
+            // Les batailles ne sont pas sauvegardees : plus aucune troupe engagee
+            const auto& loaded = registry.get<ECS::ArmyComponent>(entity);
+            CHECK(loaded.troops == army->troops);
+            CHECK(loaded.wounded == army->wounded);
+            CHECK(loaded.deployed == 0);
+            CHECK(loaded.attack == army->attack);
+            CHECK(loaded.defense == army->defense);
+            CHECK(loaded.health == army->health);
+        }
+    }
+    CHECK(entityCount == 3);
+
+    // Seul l'evenement suit le royaume, avec son delai restant et son entite
+    std::vector<ScheduledTimerEvent> sourceEvents;
+    std::vector<ScheduledTimerEvent> events;
+    sourceTimers.CollectEvents(sourceEvents);
+    timers.CollectEvents(events);
+    CHECK(timers.GetPendingCount() == 1);
+    REQUIRE(events.size() == 1);
+    CHECK(events[0].event.type == sourceEvents[0].event.type);
+    CHECK(events[0].event.entity == sourceEvents[0].event.entity);
+    CHECK(events[0].event.data == 90);
+    CHECK(events[0].remainingSeconds == 600.0);
+}
+
+TEST(WorldSnapshot_CaptureIsDeterministic)
+{
+    entt::registry registry;
+    TimingWheel timers;
+    std::vector<uint8_t> first = CaptureSample(registry, timers, false);
+    std::vector<uint8_t> second = Core::CaptureWorldSnapshot(registry, timers, KINGDOM_ID, false);
+
+    // Seule l'heure de capture peut differer
+    constexpr size_t SAVED_AT = offsetof(Core::WorldSnapshotHeader, savedAtMs);
+    std::memset(first.data() + SAVED_AT, 0, sizeof(int64_t));
+    std::memset(second.data() + SAVED_AT, 0, sizeof(int64_t));
+    CHECK(first == second);
+}
+
+TEST(WorldSnapshot_RejectsTruncatedBuffer)
+{
+    entt::registry source;
+    TimingWheel sourceTimers;
+    std::vector<uint8_t> buffer = CaptureSample(source, sourceTimers, false);
+
+    for (size_t size : { size_t{ 0 }, sizeof(Core::WorldSnapshotHeader) - 1, sizeof(Core::WorldSnapshotHeader), buffer.size() - 1 })
+    {
+        entt::registry registry;
+        TimingWheel timers;
+        Core::WorldSnapshotInfo info;
+        CHECK(!Core::LoadWorldSnapshot(std::span<const uint8_t>(buffer.data(), size), "test", registry, timers, KINGDOM_ID, info));
+        CHECK(registry.view<ECS::PositionComponent>().size() == 0);
+        CHECK(timers.GetPendingCount() == 0);
+    }
+}
+
+TEST(WorldSnapshot_RejectsBadChecksum)
+{
+    entt::registry source;
+    TimingWheel sourceTimers;
+    std::vector<uint8_t> buffer = CaptureSample(source, sourceTimers, false);
+    buffer.back() ^= 0x01;
+
+    entt::registry registry;
+    TimingWheel timers;
+    Core::WorldSnapshotInfo info;
+    CHECK(!Core::LoadWorldSnapshot(buffer, "test", registry, timers, KINGDOM_ID, info));
+    CHECK(registry.view<ECS::PositionComponent>().size() == 0);
+    CHECK(timers.GetPendingCount() == 0);
+}
+
+TEST(WorldSnapshot_RejectsForeignHeader)
+{
+    entt::registry source;
+    TimingWheel sourceTimers;
+    const std::vector<uint8_t> buffer = CaptureSample(source, sourceTimers, false);
+
+    entt::registry registry;
+    TimingWheel timers;
+    Core::WorldSnapshotInfo info;
+    CHECK(!Core::LoadWorldSnapshot(buffer, "test", registry, timers, KINGDOM_ID + 1, info));
+
+    std::vector<uint8_t> otherVersion = buffer;
+    uint16_t version = Core::WORLD_SNAPSHOT_VERSION - 1;
+    std::memcpy(otherVersion.data() + offsetof(Core::WorldSnapshotHeader, version), &version, sizeof(version));
+    CHECK(!Core::LoadWorldSnapshot(otherVersion, "test", registry, timers, KINGDOM_ID, info));
+
+    std::vector<uint8_t> otherMagic = buffer;
+    otherMagic[0] = 'X';
+    CHECK(!Core::LoadWorldSnapshot(otherMagic, "test", registry, timers, KINGDOM_ID, info));
+
+    CHECK(registry.view<ECS::PositionComponent>().size() == 0);
+}
+
+TEST(WorldSnapshot_RejectsInconsistentPayloadWithValidChecksum)
+{
+    entt::registry source;
+    TimingWheel sourceTimers;
+    std::vector<uint8_t> buffer = CaptureSample(source, sourceTimers, false);
+
+    // Octets en trop apres les timers, checksum et taille a jour : l'archive ne finit pas au bout du payload
+    buffer.push_back(0);
+    uint64_t payloadSize = buffer.size() - sizeof(Core::WorldSnapshotHeader);
+    uint32_t checksum = PayloadChecksum(buffer);
+    std::memcpy(buffer.data() + offsetof(Core::WorldSnapshotHeader, payloadSize), &payloadSize, sizeof(payloadSize));
+    std::memcpy(buffer.data() + offsetof(Core::WorldSnapshotHeader, checksum), &checksum, sizeof(checksum));
+
+    entt::registry registry;
+    TimingWheel timers;
+    Core::WorldSnapshotInfo info;
+    CHECK(!Core::LoadWorldSnapshot(buffer, "test", registry, timers, KINGDOM_ID, info));
+    CHECK(registry.view<ECS::PositionComponent>().size() == 0);
+    CHECK(timers.GetPendingCount() == 0);
+}
@@ -47,4 +47,41 @@ target("MobileGameServer")
 
     after_build(function (target)
         os.cp("kingdoms.json", target:targetdir())
-    end)
\ No newline at end of file
+    end)
+
+-- ==========================================/
+-- Benchmarks (hors build par defaut)
+-- ==========================================/
+target("SpatialGridBench")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("bench/SpatialGridBench.cpp", "src/private/world/SpatialGrid.cpp")
+    add_includedirs("src/public")
+    add_packages("entt")
+    add_defines("NOMINMAX")
+
+    if is_mode("release") then
+        set_optimize("fastest")
+        add_defines("NDEBUG")
+    end
+
+-- ==========================================/
+-- Tests unitaires (xmake test)
+-- ==========================================/
+target("ServerTests")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("tests/*.cpp")
+    add_files("src/private/world/TimingWheel.cpp",
+              "src/private/world/SpatialGrid.cpp",
+              "src/private/world/WorldSnapshot.cpp",
+              "src/private/world/WorldMap.cpp",
+              "src/private/world/PathfindingService.cpp",
+              "src/private/utils/MappedFile.cpp",
+              "src/private/utils/StringInterner.cpp")
+    add_includedirs("src/public")
+    add_packages("entt")
+    add_defines("NOMINMAX")
+    add_tests("default")